@@ -12,6 +12,7 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "include/HyperionTypes.hpp"
 #include "include/HyperionMessages.hpp"
@@ -20,7 +21,7 @@
 
 namespace Hyperion {
 
-HyperionCall::HyperionCall() noexcept : fn(nullptr), ptr(0), statusLastCall(Status::Ok) {
+HyperionCall::HyperionCall() noexcept : fn(nullptr), ptr(0), batching(false), batchCalls(0), statusLastCall(Status::Ok) {
 }
 
 void HyperionCall::SetFnPtr(FunctionDirect fn_, intptr_t ptr_) noexcept {
@@ -33,6 +34,12 @@ bool HyperionCall::IsValid() const noexcept {
 }
 
 intptr_t HyperionCall::Call(Message msg, uintptr_t wParam, intptr_t lParam) {
+	if (batching) {
+		const BatchCall call { msg, 0, wParam, lParam };
+		batch.append(reinterpret_cast<const char *>(&call), sizeof(call));
+		batchCalls++;
+		return 0;
+	}
 	if (!fn)
 		throw Failure(Status::Failure);
 	int status = 0;
@@ -52,6 +59,10 @@ intptr_t HyperionCall::CallString(Message msg, uintptr_t wParam, const char *s)
 }
 
 std::string HyperionCall::CallReturnString(Message msg, uintptr_t wParam) {
+	if (batching) {
+		// The text would be written after the string returned is gone
+		throw Failure(Status::Failure);
+	}
 	const size_t len = CallPointer(msg, wParam, nullptr);
 	if (len) {
 		std::string value(len, '\0');
@@ -62,6 +73,36 @@ std::string HyperionCall::CallReturnString(Message msg, uintptr_t wParam) {
 	}
 }
 
+void HyperionCall::BeginBatch() {
+	batching = true;
+}
+
+void HyperionCall::QueueCall(Message msg, uintptr_t wParam, std::string_view payload) {
+	const BatchCall call { msg, static_cast<unsigned int>(payload.length()), wParam, 0 };
+	batch.append(reinterpret_cast<const char *>(&call), sizeof(call));
+	if (!payload.empty()) {
+		batch.append(payload);
+		// Terminate the payload so it can be read as a C string then pad to the next call
+		const size_t lengthTerminated = payload.length() + 1;
+		batch.append(1 + (sizeof(intptr_t) - lengthTerminated % sizeof(intptr_t)) % sizeof(intptr_t), '\0');
+	}
+	batchCalls++;
+	batching = true;
+}
+
+std::vector<intptr_t> HyperionCall::EndBatch() {
+	batching = false;
+	std::vector<intptr_t> results(batchCalls);
+	std::string calls;
+	calls.swap(batch);
+	batchCalls = 0;
+	if (!calls.empty()) {
+		Batch callBatch { calls.data(), static_cast<Position>(calls.length()), results.data() };
+		results.resize(CallBatch(&callBatch));
+	}
+	return results;
+}
+
 // Common APIs made more structured and type-safe
 
 Position HyperionCall::LineStart(Line line) {
@@ -101,6 +142,9 @@ int HyperionCall::UnsignedStyleAt(Position position) {
 }
 
 std::string HyperionCall::StringOfSpan(Span span) {
+	if (batching) {
+		throw Failure(Status::Failure);
+	}
 	if (span.Length() == 0) {
 		return std::string();
 	} else {
@@ -112,6 +156,9 @@ std::string HyperionCall::StringOfSpan(Span span) {
 }
 
 std::string HyperionCall::StringOfRange(Span span) {
+	if (batching) {
+		throw Failure(Status::Failure);
+	}
 	if (span.Length() == 0) {
 		return std::string();
 	} else {
@@ -767,6 +814,18 @@ void HyperionCall::SetStylingEx(Position length, const char *styles) {
 	CallString(Message::SetStylingEx, length, styles);
 }
 
+void HyperionCall::SetSemanticTokenStyle(int tokenType, int style) {
+	Call(Message::SetSemanticTokenStyle, tokenType, style);
+}
+
+int HyperionCall::SemanticTokenStyle(int tokenType) {
+	return static_cast<int>(Call(Message::GetSemanticTokenStyle, tokenType));
+}
+
+Position HyperionCall::ApplySemanticTokens(Position length, const unsigned int *tokens) {
+	return Call(Message::ApplySemanticTokens, length, reinterpret_cast<intptr_t>(tokens));
+}
+
 void HyperionCall::StyleSetVisible(int style, bool visible) {
 	Call(Message::StyleSetVisible, style, visible);
 }
@@ -1151,6 +1210,10 @@ Position HyperionCall::LineIndentPosition(Line line) {
 	return Call(Message::GetLineIndentPosition, line);
 }
 
+void HyperionCall::NormalizeWhitespace(Hyperion::Normalize options, int indentLevels) {
+	Call(Message::NormalizeWhitespace, static_cast<uintptr_t>(options), indentLevels);
+}
+
 Position HyperionCall::Column(Position pos) {
 	return Call(Message::GetColumn, pos);
 }
@@ -1539,6 +1602,10 @@ Position HyperionCall::ReplaceTargetMinimal(Position length, const char *text) {
 	return CallString(Message::ReplaceTargetMinimal, length, text);
 }
 
+Position HyperionCall::ReloadText(Position length, const char *text) {
+	return CallString(Message::ReloadText, length, text);
+}
+
 Position HyperionCall::SearchInTarget(Position length, const char *text) {
 	return CallString(Message::SearchInTarget, length, text);
 }
@@ -2083,6 +2150,22 @@ void HyperionCall::LineReverse() {
 	Call(Message::LineReverse);
 }
 
+void HyperionCall::LineSort(Hyperion::LineSort options) {
+	Call(Message::LineSort, static_cast<uintptr_t>(options));
+}
+
+void HyperionCall::LineUnique() {
+	Call(Message::LineUnique);
+}
+
+void HyperionCall::LineKeepMatching(Position length, const char *text) {
+	CallString(Message::LineKeepMatching, length, text);
+}
+
+void HyperionCall::LineDropMatching(Position length, const char *text) {
+	CallString(Message::LineDropMatching, length, text);
+}
+
 void HyperionCall::LineDuplicate() {
 	Call(Message::LineDuplicate);
 }
@@ -2183,6 +2266,18 @@ Position HyperionCall::BraceMatchNext(Position pos, Position startPos) {
 	return Call(Message::BraceMatchNext, pos, startPos);
 }
 
+Position HyperionCall::BraceEnclosing(Position pos, int style) {
+	return Call(Message::BraceEnclosing, pos, style);
+}
+
+void HyperionCall::SetBraceIndex(bool indexed) {
+	Call(Message::SetBraceIndex, indexed);
+}
+
+bool HyperionCall::BraceIndex() {
+	return Call(Message::GetBraceIndex);
+}
+
 bool HyperionCall::ViewEOL() {
 	return Call(Message::GetViewEOL);
 }
@@ -3391,6 +3486,138 @@ Position HyperionCall::IndexPositionFromLine(Line line, Hyperion::LineCharacterI
 	return Call(Message::IndexPositionFromLine, line, static_cast<intptr_t>(lineCharacterIndex));
 }
 
+Position HyperionCall::ConvertPositions(PositionConversion *conversion) {
+	return CallPointer(Message::ConvertPositions, 0, conversion);
+}
+
+void HyperionCall::SetTextCountIndex(bool indexed) {
+	Call(Message::SetTextCountIndex, indexed);
+}
+
+bool HyperionCall::TextCountIndex() {
+	return Call(Message::GetTextCountIndex);
+}
+
+Position HyperionCall::GetTextStatistics(TextStatistics *statistics) {
+	return CallPointer(Message::GetTextStatistics, 0, statistics);
+}
+
+void HyperionCall::SetContentHashIndex(bool indexed) {
+	Call(Message::SetContentHashIndex, indexed);
+}
+
+bool HyperionCall::ContentHashIndex() {
+	return Call(Message::GetContentHashIndex);
+}
+
+Position HyperionCall::GetContentHash(TextHash *textHash) {
+	return CallPointer(Message::GetContentHash, 0, textHash);
+}
+
+bool HyperionCall::ContentModified() {
+	return Call(Message::GetContentModified);
+}
+
+Position HyperionCall::DiffDocument(Hyperion::DiffOption options, IDocumentEditable *docOther) {
+	return CallPointer(Message::DiffDocument, static_cast<uintptr_t>(options), docOther);
+}
+
+void HyperionCall::SetDiffTimeout(int milliseconds) {
+	Call(Message::SetDiffTimeout, milliseconds);
+}
+
+int HyperionCall::DiffTimeout() {
+	return static_cast<int>(Call(Message::GetDiffTimeout));
+}
+
+bool HyperionCall::DiffGetHunk(Position hunk, DiffHunk *diffHunk) {
+	return CallPointer(Message::DiffGetHunk, hunk, diffHunk);
+}
+
+Line HyperionCall::DiffAlignedLine(Line line) {
+	return Call(Message::DiffAlignedLine, line);
+}
+
+Position HyperionCall::DiffIndicate(int indicator) {
+	return Call(Message::DiffIndicate, indicator);
+}
+
+Line HyperionCall::DiffPadAnnotations(int style) {
+	return Call(Message::DiffPadAnnotations, style);
+}
+
+void HyperionCall::SetElasticTabstops(int padding) {
+	Call(Message::SetElasticTabstops, padding);
+}
+
+int HyperionCall::ElasticTabstops() {
+	return static_cast<int>(Call(Message::GetElasticTabstops));
+}
+
+void HyperionCall::AutoCSetMaxResults(int results) {
+	Call(Message::AutoCSetMaxResults, results);
+}
+
+int HyperionCall::AutoCGetMaxResults() {
+	return static_cast<int>(Call(Message::AutoCGetMaxResults));
+}
+
+void HyperionCall::SetWordIndex(bool indexed) {
+	Call(Message::SetWordIndex, indexed);
+}
+
+bool HyperionCall::WordIndex() {
+	return Call(Message::GetWordIndex);
+}
+
+void HyperionCall::AutoCSetWordRanking(Hyperion::WordRanking ranking) {
+	Call(Message::AutoCSetWordRanking, static_cast<uintptr_t>(ranking));
+}
+
+WordRanking HyperionCall::AutoCGetWordRanking() {
+	return static_cast<Hyperion::WordRanking>(Call(Message::AutoCGetWordRanking));
+}
+
+int HyperionCall::AutoCGetDocumentWords(const char *prefix, char *words) {
+	return static_cast<int>(CallPointer(Message::AutoCGetDocumentWords, reinterpret_cast<uintptr_t>(prefix), words));
+}
+
+std::string HyperionCall::AutoCGetDocumentWords(const char *prefix) {
+	return CallReturnString(Message::AutoCGetDocumentWords, reinterpret_cast<uintptr_t>(prefix));
+}
+
+bool HyperionCall::AutoCShowDocumentWords(Position lengthEntered) {
+	return Call(Message::AutoCShowDocumentWords, lengthEntered);
+}
+
+Position HyperionCall::ExportSelection(bool allowLineCopy, TextExport *textExport) {
+	return CallPointer(Message::ExportSelection, allowLineCopy, textExport);
+}
+
+Position HyperionCall::ExportRange(TextExport *textExport) {
+	return CallPointer(Message::ExportRange, 0, textExport);
+}
+
+void HyperionCall::SetLogMode(bool logMode) {
+	Call(Message::SetLogMode, logMode);
+}
+
+bool HyperionCall::LogMode() {
+	return Call(Message::GetLogMode);
+}
+
+void HyperionCall::SetLogLineLimit(Line lines) {
+	Call(Message::SetLogLineLimit, lines);
+}
+
+Line HyperionCall::LogLineLimit() {
+	return Call(Message::GetLogLineLimit);
+}
+
+Position HyperionCall::CallBatch(Batch *batch) {
+	return CallPointer(Message::CallBatch, 0, batch);
+}
+
 void HyperionCall::StartRecord() {
 	Call(Message::StartRecord);
 }
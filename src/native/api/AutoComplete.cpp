@@ -21,6 +21,12 @@
 #include <algorithm>
 #include <memory>
 
+#include "../platform/CpuFeatures.hpp"
+
+#if defined(HYPERION_SSE2)
+#include <emmintrin.h>
+#endif
+
 #include "../include/HyperionTypes.hpp"
 #include "../include/HyperionMessages.hpp"
 #include "../platform/Debugging.hpp"
@@ -38,6 +44,11 @@ AutoComplete::AutoComplete() :
 	active(false),
 	separator(' '),
 	typesep('?'),
+	listOrder(Ordering::PreSorted),
+	narrowedFuzzy(false),
+	narrowedIgnoreCase(false),
+	narrowedFirst(0),
+	narrowedLast(0),
 	ignoreCase(false),
 	chooseSingle(false),
 	options(AutoCompleteOption::Normal),
@@ -50,7 +61,9 @@ AutoComplete::AutoComplete() :
 	ignoreCaseBehaviour(CaseInsensitiveBehaviour::RespectCase),
 	widthLBDefault(100),
 	heightLBDefault(100),
-	autoSort(Ordering::PreSorted) {
+	maxResults(100),
+	autoSort(Ordering::PreSorted),
+	wordRanking(WordRanking::Frequency) {
 	lb = ListBox::Allocate();
 }
 
@@ -112,112 +125,208 @@ char AutoComplete::GetTypesep() const noexcept {
 
 namespace {
 
-struct Sorter {
-	const bool ignoreCase;
-	const char *list;
-	std::vector<int> indices;
-
-	Sorter(const AutoComplete *ac, const char *list_) : ignoreCase(ac->ignoreCase), list(list_) {
-		int i = 0;
-		if (!list[i]) {
-			// Empty list has a single empty member
-			indices.push_back(i); // word start
-			indices.push_back(i); // word end
+constexpr char FoldedCase(char ch) noexcept {
+	return MakeUpperCase(ch);
+}
+
+constexpr uint64_t CharBit(char ch) noexcept {
+	return 1ULL << (static_cast<unsigned char>(ch) & 0x3f);
+}
+
+uint64_t CharSet(std::string_view text) noexcept {
+	uint64_t set = 0;
+	for (const char ch : text) {
+		set |= CharBit(ch);
+	}
+	return set;
+}
+
+// Position of ch in text at or after start.
+size_t FindChar(std::string_view text, size_t start, char ch) noexcept {
+	size_t i = start;
+#if defined(HYPERION_SSE2)
+	// Skip blocks of 16 bytes without ch
+	const __m128i needle = _mm_set1_epi8(ch);
+	for (; i + 16 <= text.length(); i += 16) {
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle))) {
+			break;
 		}
-		const char separator = ac->GetSeparator();
-		const char typesep = ac->GetTypesep();
-		while (list[i]) {
-			indices.push_back(i); // word start
-			while (list[i] != typesep && list[i] != separator && list[i])
-				++i;
-			indices.push_back(i); // word end
-			if (list[i] == typesep) {
-				while (list[i] != separator && list[i])
-					++i;
-			}
-			if (list[i] == separator) {
-				++i;
-				// preserve trailing separator as blank entry
-				if (!list[i]) {
-					indices.push_back(i);
-					indices.push_back(i);
-				}
-			}
+	}
+#endif
+	for (; i < text.length(); i++) {
+		if (text[i] == ch) {
+			return i;
 		}
-		indices.push_back(i); // index of last position
 	}
+	return std::string_view::npos;
+}
 
-	bool operator()(int a, int b) const noexcept {
-		const unsigned indexA = a * 2;
-		const unsigned indexB = b * 2;
-		const int lenA = indices[indexA + 1] - indices[indexA];
-		const int lenB = indices[indexB + 1] - indices[indexB];
-		const int len  = std::min(lenA, lenB);
-		int cmp;
-		if (ignoreCase)
-			cmp = CompareNCaseInsensitive(list + indices[indexA], list + indices[indexB], len);
-		else
-			cmp = strncmp(list + indices[indexA], list + indices[indexB], len);
-		if (cmp == 0)
-			cmp = lenA - lenB;
-		return cmp < 0;
+// A word starts after punctuation or at a change from lower to upper case or to a digit.
+bool StartsWord(std::string_view text, size_t position) noexcept {
+	if (position == 0) {
+		return true;
 	}
-};
+	const unsigned char chPrevious = text[position - 1];
+	const unsigned char ch = text[position];
+	return !IsAlphaNumeric(chPrevious) ||
+		(IsLowerCase(chPrevious) && IsUpperCase(ch)) ||
+		(!IsADigit(chPrevious) && IsADigit(ch));
+}
 
-void FillSortMatrix(std::vector<int> &sortMatrix, int itemCount) {
-	sortMatrix.clear();
-	for (int i = 0; i < itemCount; i++) {
-		sortMatrix.push_back(i);
+// Score pattern as a subsequence of the folded word, -1 if it is not one.
+// Matches that start words or follow the previous match score more and skipped bytes score less.
+int FuzzyScore(std::string_view folded, std::string_view word, std::string_view pattern) noexcept {
+	constexpr int scoreMatch = 16;
+	constexpr int bonusFirst = 24;
+	constexpr int bonusWordStart = 12;
+	constexpr int bonusConsecutive = 10;
+	constexpr size_t maxGapPenalty = 8;
+	int score = 0;
+	size_t position = 0;
+	for (size_t i = 0; i < pattern.length(); i++) {
+		const size_t found = FindChar(folded, position, pattern[i]);
+		if (found == std::string_view::npos) {
+			return -1;
+		}
+		score += scoreMatch;
+		if (found == 0) {
+			score += bonusFirst;
+		} else if (StartsWord(word, found)) {
+			score += bonusWordStart;
+		}
+		if ((i > 0) && (found == position)) {
+			score += bonusConsecutive;
+		}
+		score -= static_cast<int>(std::min(found - position, maxGapPenalty));
+		position = found + 1;
 	}
+	return score;
 }
 
 }
 
-void AutoComplete::SetList(const char *list) {
-	if (autoSort == Ordering::PreSorted) {
-		lb->SetList(list, separator, typesep);
-		FillSortMatrix(sortMatrix, lb->Length());
-		return;
+void AutoComplete::IndexList(const char *text) {
+	list = text;
+	listFolded = list;
+	for (char &ch : listFolded) {
+		ch = FoldedCase(ch);
 	}
+	charSets.clear();
+	items.clear();
+	size_t i = 0;
+	if (list.empty()) {
+		// Empty list has a single empty member
+		items.push_back({ 0, 0, 0 });
+	}
+	while (i < list.length()) {
+		const size_t start = i;
+		while ((i < list.length()) && (list[i] != typesep) && (list[i] != separator)) {
+			i++;
+		}
+		const size_t endWord = i;
+		if ((i < list.length()) && (list[i] == typesep)) {
+			while ((i < list.length()) && (list[i] != separator)) {
+				i++;
+			}
+		}
+		items.push_back({ start, endWord - start, i - start });
+		if ((i < list.length()) && (list[i] == separator)) {
+			i++;
+			// preserve trailing separator as blank entry
+			if (i == list.length()) {
+				items.push_back({ i, 0, 0 });
+			}
+		}
+	}
+}
+
+std::string_view AutoComplete::Key(int item, bool folded) const noexcept {
+	const Item &it = items[item];
+	const std::string_view text = folded ? listFolded : list;
+	return text.substr(it.start, it.lengthWord);
+}
+
+bool AutoComplete::Filtering() const noexcept {
+	return FlagSet(options, AutoCompleteOption::Filter | AutoCompleteOption::Fuzzy);
+}
 
-	const Sorter IndexSort(this, list);
-	FillSortMatrix(sortMatrix, static_cast<int>(IndexSort.indices.size() / 2));
-	std::sort(sortMatrix.begin(), sortMatrix.end(), IndexSort);
-	if (autoSort == Ordering::Custom || sortMatrix.size() < 2) {
-		lb->SetList(list, separator, typesep);
-		PLATFORM_ASSERT(lb->Length() == static_cast<int>(sortMatrix.size()));
+void AutoComplete::ShowItems(const std::vector<int> &itemsShown) {
+	shown = itemsShown;
+	if (shown.empty()) {
+		lb->Clear();
 		return;
 	}
+	std::string text;
+	for (const int item : shown) {
+		if (!text.empty()) {
+			text += separator;
+		}
+		text.append(list, items[item].start, items[item].lengthItem);
+	}
+	lb->SetList(text.c_str(), separator, typesep);
+}
 
-	std::string sortedList;
-	for (size_t i = 0; i < sortMatrix.size(); ++i) {
-		const unsigned index = sortMatrix[i] * 2;
-		sortMatrix[i] = static_cast<int>(i);
-		// word length include trailing typesep and separator
-		const int wordLen = IndexSort.indices[index + 2] - IndexSort.indices[index];
-		const std::string_view item(list + IndexSort.indices[index], wordLen);
-		sortedList += item;
-		if ((i + 1) == sortMatrix.size()) {
-			// Last item so remove separator if present
-			if (!item.empty() && item.back() == separator) {
-				sortedList.pop_back();
-			}
-		} else {
-			// Item before last needs a separator
-			if (item.empty() || item.back() != separator) {
+void AutoComplete::SetList(const char *listText) {
+	IndexList(listText);
+	listOrder = autoSort;
+	wordNarrowed.clear();
+	narrowedFuzzy = false;
+	narrowedFirst = 0;
+	narrowedLast = static_cast<int>(items.size());
+	fuzzyMatches.clear();
+
+	sortMatrix.clear();
+	for (size_t item = 0; item < items.size(); item++) {
+		sortMatrix.push_back(static_cast<int>(item));
+	}
+	if (listOrder != Ordering::PreSorted) {
+		const bool folded = ignoreCase;
+		std::stable_sort(sortMatrix.begin(), sortMatrix.end(), [this, folded](int a, int b) noexcept {
+			return Key(a, folded) < Key(b, folded);
+		});
+	}
+	if ((listOrder == Ordering::PerformSort) && (sortMatrix.size() >= 2)) {
+		// The list box shows the sorted list so index that instead
+		std::string sortedList;
+		for (size_t i = 0; i < sortMatrix.size(); i++) {
+			if (i > 0) {
 				sortedList += separator;
 			}
+			const Item &item = items[sortMatrix[i]];
+			sortedList.append(list, item.start, item.lengthItem);
 		}
+		IndexList(sortedList.c_str());
+		for (size_t i = 0; i < sortMatrix.size(); i++) {
+			sortMatrix[i] = static_cast<int>(i);
+		}
+	}
+
+	if (Filtering()) {
+		std::vector<int> itemsShown;
+		for (size_t item = 0; (item < items.size()) && (static_cast<int>(item) < maxResults); item++) {
+			itemsShown.push_back(static_cast<int>(item));
+		}
+		ShowItems(itemsShown);
+	} else {
+		shown.clear();
+		lb->SetList(list.c_str(), separator, typesep);
 	}
-	lb->SetList(sortedList.c_str(), separator, typesep);
 }
 
 int AutoComplete::GetSelection() const {
-	return lb->GetSelection();
+	const int row = lb->GetSelection();
+	if (Filtering() && (row >= 0)) {
+		return (static_cast<size_t>(row) < shown.size()) ? shown[row] : -1;
+	}
+	return row;
 }
 
 std::string AutoComplete::GetValue(int item) const {
-	return lb->GetValue(item);
+	if ((item < 0) || (static_cast<size_t>(item) >= items.size())) {
+		return {};
+	}
+	return std::string(Key(item, false));
 }
 
 void AutoComplete::Show(bool show) {
@@ -231,6 +340,16 @@ void AutoComplete::Cancel() noexcept {
 		lb->Clear();
 		lb->Destroy();
 		active = false;
+		list.clear();
+		listFolded.clear();
+		items.clear();
+		charSets.clear();
+		sortMatrix.clear();
+		wordNarrowed.clear();
+		narrowedFirst = 0;
+		narrowedLast = 0;
+		fuzzyMatches.clear();
+		shown.clear();
 	}
 }
 
@@ -246,68 +365,163 @@ void AutoComplete::Move(int delta) {
 	lb->Select(current);
 }
 
+void AutoComplete::SelectFuzzy(std::string_view word) {
+	std::string pattern(word);
+	for (char &ch : pattern) {
+		ch = FoldedCase(ch);
+	}
+	if (charSets.size() != items.size()) {
+		charSets.clear();
+		for (size_t item = 0; item < items.size(); item++) {
+			charSets.push_back(CharSet(Key(static_cast<int>(item), true)));
+		}
+	}
+
+	// Items matching a longer pattern are a subset of those matching its prefix
+	const bool narrow = narrowedFuzzy && !wordNarrowed.empty() && (pattern.compare(0, wordNarrowed.length(), wordNarrowed) == 0);
+	std::vector<int> candidates;
+	if (narrow) {
+		candidates = std::move(fuzzyMatches);
+	} else {
+		for (size_t item = 0; item < items.size(); item++) {
+			candidates.push_back(static_cast<int>(item));
+		}
+	}
+	const uint64_t patternSet = CharSet(pattern);
+	struct Scored {
+		int score;
+		int item;
+	};
+	std::vector<Scored> scored;
+	fuzzyMatches.clear();
+	for (const int item : candidates) {
+		if ((charSets[item] & patternSet) != patternSet) {
+			continue;
+		}
+		const int score = FuzzyScore(Key(item, true), Key(item, false), pattern);
+		if (score >= 0) {
+			scored.push_back({ score, item });
+			fuzzyMatches.push_back(item);
+		}
+	}
+	wordNarrowed = pattern;
+	narrowedFuzzy = true;
+
+	// Best score then shorter word then list order
+	const size_t results = std::min(scored.size(), static_cast<size_t>(std::max(maxResults, 1)));
+	const bool preferShort = !pattern.empty();
+	std::partial_sort(scored.begin(), scored.begin() + results, scored.end(), [this, preferShort](const Scored &a, const Scored &b) noexcept {
+		if (a.score != b.score) {
+			return a.score > b.score;
+		}
+		if (preferShort && (items[a.item].lengthWord != items[b.item].lengthWord)) {
+			return items[a.item].lengthWord < items[b.item].lengthWord;
+		}
+		return a.item < b.item;
+	});
+	std::vector<int> itemsShown;
+	for (size_t i = 0; i < results; i++) {
+		itemsShown.push_back(scored[i].item);
+	}
+	ShowItems(itemsShown);
+	if (itemsShown.empty()) {
+		if (autoHide)
+			Cancel();
+		else
+			lb->Select(-1);
+	} else {
+		lb->Select(0);
+	}
+}
+
 void AutoComplete::Select(const char *word) {
-	const size_t lenWord = strlen(word);
+	if (FlagSet(options, AutoCompleteOption::Fuzzy)) {
+		SelectFuzzy(word);
+		return;
+	}
+
+	std::string key(word);
+	if (ignoreCase) {
+		for (char &ch : key) {
+			ch = FoldedCase(ch);
+		}
+	}
+	const size_t lenWord = key.length();
+
+	// Items starting with a longer word are in the range that started with its prefix
+	int start = 0;
+	int end = static_cast<int>(sortMatrix.size());
+	if (!narrowedFuzzy && (narrowedIgnoreCase == ignoreCase) && (key.compare(0, wordNarrowed.length(), wordNarrowed) == 0)) {
+		start = narrowedFirst;
+		end = narrowedLast;
+	}
+	const auto itFirst = std::partition_point(sortMatrix.begin() + start, sortMatrix.begin() + end,
+		[this, &key](int item) noexcept {
+		return Key(item, ignoreCase) < key;
+	});
+	start = static_cast<int>(itFirst - sortMatrix.begin());
+	const auto itLast = std::partition_point(itFirst, sortMatrix.begin() + end, [this, &key, lenWord](int item) noexcept {
+		return Key(item, ignoreCase).substr(0, lenWord) == key;
+	});
+	end = static_cast<int>(itLast - sortMatrix.begin());
+	wordNarrowed = key;
+	narrowedFuzzy = false;
+	narrowedIgnoreCase = ignoreCase;
+	narrowedFirst = start;
+	narrowedLast = end;
+
+	const std::string_view wordExact(word);
+	const auto matchesExact = [this, wordExact](int item) noexcept {
+		return Key(item, false).substr(0, wordExact.length()) == wordExact;
+	};
 	int location = -1;
-	int start = 0; // lower bound of the api array block to search
-	int end = lb->Length() - 1; // upper bound of the api array block to search
-	while ((start <= end) && (location == -1)) { // Binary searching loop
-		int pivot = (start + end) / 2;
-		std::string item = GetValue(sortMatrix[pivot]);
-		int cond;
-		if (ignoreCase)
-			cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-		else
-			cond = strncmp(word, item.c_str(), lenWord);
-		if (!cond) {
-			// Find first match
-			while (pivot > start) {
-				item = lb->GetValue(sortMatrix[pivot-1]);
-				if (ignoreCase)
-					cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-				else
-					cond = strncmp(word, item.c_str(), lenWord);
-				if (0 != cond)
+	if (start < end) {
+		location = start;
+		if (ignoreCase
+			&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
+			// Check for exact-case match
+			for (int pivot = start; pivot < end; pivot++) {
+				if (matchesExact(sortMatrix[pivot])) {
+					location = pivot;
 					break;
-				--pivot;
-			}
-			location = pivot;
-			if (ignoreCase
-				&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
-				// Check for exact-case match
-				for (; pivot <= end; pivot++) {
-					item = lb->GetValue(sortMatrix[pivot]);
-					if (!strncmp(word, item.c_str(), lenWord)) {
-						location = pivot;
-						break;
-					}
-					if (CompareNCaseInsensitive(word, item.c_str(), lenWord))
-						break;
 				}
 			}
-		} else if (cond < 0) {
-			end = pivot - 1;
-		} else { // cond > 0
-			start = pivot + 1;
+		}
+		if (listOrder == Ordering::Custom) {
+			// Check for a logically earlier match
+			for (int i = location + 1; i < end; ++i) {
+				if (sortMatrix[i] < sortMatrix[location] && matchesExact(sortMatrix[i]))
+					location = i;
+			}
 		}
 	}
+
+	if (Filtering()) {
+		// Show the first matches in list order
+		std::vector<int> itemsShown(sortMatrix.begin() + start, sortMatrix.begin() + end);
+		const size_t results = std::min(itemsShown.size(), static_cast<size_t>(std::max(maxResults, 1)));
+		std::partial_sort(itemsShown.begin(), itemsShown.begin() + results, itemsShown.end());
+		itemsShown.resize(results);
+		if (location != -1) {
+			// Keep the selected item visible even when it is not among the first matches
+			const int item = sortMatrix[location];
+			if (!std::binary_search(itemsShown.begin(), itemsShown.end(), item)) {
+				itemsShown.back() = item;
+				std::sort(itemsShown.begin(), itemsShown.end());
+			}
+		}
+		ShowItems(itemsShown);
+	}
+
 	if (location == -1) {
 		if (autoHide)
 			Cancel();
 		else
 			lb->Select(-1);
+	} else if (Filtering()) {
+		const int item = sortMatrix[location];
+		lb->Select(static_cast<int>(std::lower_bound(shown.begin(), shown.end(), item) - shown.begin()));
 	} else {
-		if (autoSort == Ordering::Custom) {
-			// Check for a logically earlier match
-			for (int i = location + 1; i <= end; ++i) {
-				const std::string item = lb->GetValue(sortMatrix[i]);
-				if (CompareNCaseInsensitive(word, item.c_str(), lenWord))
-					break;
-				if (sortMatrix[i] < sortMatrix[location] && !strncmp(word, item.c_str(), lenWord))
-					location = i;
-			}
-		}
 		lb->Select(sortMatrix[location]);
 	}
 }
-
@@ -17,7 +17,33 @@ class AutoComplete {
 	std::string fillUpChars;
 	char separator;
 	char typesep; // Type separator
+	/// Index of the list as given to the list box so items are compared without copying them
+	struct Item {
+		size_t start;
+		size_t lengthWord;
+		size_t lengthItem;	///< Including any type suffix
+	};
+	std::string list;
+	std::string listFolded;	///< list with ASCII folded to upper case as CompareNCaseInsensitive does
+	std::vector<Item> items;
+	std::vector<uint64_t> charSets;	///< Bit set of the folded bytes in each item for fuzzy matching
 	std::vector<int> sortMatrix;
+	Hyperion::Ordering listOrder;	///< autoSort when the list was set
+	/// Range of sortMatrix matching the previous word so a longer word searches only that range
+	std::string wordNarrowed;
+	bool narrowedFuzzy;
+	bool narrowedIgnoreCase;
+	int narrowedFirst;
+	int narrowedLast;
+	std::vector<int> fuzzyMatches;	///< Items matching wordNarrowed in fuzzy mode
+	/// Item shown in each row of the list box when filtering
+	std::vector<int> shown;
+
+	void IndexList(const char *text);
+	std::string_view Key(int item, bool folded) const noexcept;
+	bool Filtering() const noexcept;
+	void ShowItems(const std::vector<int> &itemsShown);
+	void SelectFuzzy(std::string_view word);
 
 public:
 
@@ -35,11 +61,15 @@ public:
 	Hyperion::CaseInsensitiveBehaviour ignoreCaseBehaviour;
 	int widthLBDefault;
 	int heightLBDefault;
+	/// Most items given to the list box when filtering or taken from the document
+	int maxResults;
 	/** Ordering::PreSorted:   Assume the list is presorted; selection will fail if it is not alphabetical<br />
 	 *  Ordering::PerformSort: Sort the list alphabetically; start up performance cost for sorting<br />
 	 *  Ordering::Custom:      Handle non-alphabetical entries; start up performance cost for generating a sorted lookup table
 	 */
 	Hyperion::Ordering autoSort;
+	/// Order of the words from the document shown by AutoCShowDocumentWords
+	Hyperion::WordRanking wordRanking;
 
 	AutoComplete();
 	// Deleted so AutoComplete objects can not be copied.
@@ -76,7 +106,7 @@ public:
 	/// The list string contains a sequence of words separated by the separator character
 	void SetList(const char *list);
 
-	/// Return the position of the currently selected list item
+	/// Return the position of the currently selected list item in the whole list
 	int GetSelection() const;
 
 	/// Return the value of an item in the list
@@ -88,7 +118,8 @@ public:
 	/// Move the current list element by delta, scrolling appropriately
 	void Move(int delta);
 
-	/// Select a list element that starts with word as the current element
+	/// Select a list element that starts with word as the current element.
+	/// When filtering, only the matching elements are shown.
 	void Select(const char *word);
 };
 
@@ -63,6 +63,10 @@
 #include "../syntax/UniConversion.hpp"
 #include "../syntax/DBCS.hpp"
 #include "../core/Selection.hpp"
+#include "../core/LineOperations.hpp"
+#include "../core/LineDiff.hpp"
+#include "../core/DocumentDiff.hpp"
+#include "../core/TextExport.hpp"
 #include "../view/PositionCache.hpp"
 #include "../core/EditModel.hpp"
 #include "../view/MarginView.hpp"
@@ -117,6 +121,12 @@ constexpr bool IsAllSpacesOrTabs(std::string_view sv) noexcept {
 	return true;
 }
 
+// Bytes, UTF-32 or UTF-16 optionally combined with Line
+constexpr bool ValidPositionUnit(PositionUnit unit) noexcept {
+	const int base = static_cast<int>(unit) & ~static_cast<int>(PositionUnit::Line);
+	return (static_cast<int>(unit) & ~(static_cast<int>(PositionUnit::Line) | 3)) == 0 && base != 3;
+}
+
 }
 
 Timer::Timer() noexcept :
@@ -208,6 +218,14 @@ Editor::Editor() : durationWrapOneByte(0.000001, 0.00000001, 0.00001) {
 
 	convertPastes = true;
 
+	diffTimeout = 0;
+	diffPadStyle = 0;
+
+	logMode = false;
+	logUndoCollection = true;
+	logChangeHistory = ChangeHistoryOption::Disabled;
+	logLineLimit = 0;
+
 	SetRepresentations();
 }
 
@@ -235,6 +253,7 @@ void Editor::InvalidateStyleData() noexcept {
 	DropGraphics();
 	view.llc.Invalidate(LineLayout::ValidLevel::invalid);
 	view.posCache->Clear();
+	view.ElasticTabstopsChanged(0, pdoc->LinesTotal());
 }
 
 void Editor::InvalidateStyleRedraw() {
@@ -1658,6 +1677,7 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 // wsIdle: wrap one page + 100 lines
 // Return true if wrapping occurred.
 bool Editor::WrapLines(WrapScope ws) {
+	UpdateElasticTabstops();
 	Sci::Line goodTopLine = topLine;
 	bool wrapOccurred = false;
 	if (!Wrapping()) {
@@ -1760,8 +1780,455 @@ bool Editor::WrapLines(WrapScope ws) {
 		SetVerticalScrollPos();
 		insideWrapScroll = false;
 	}
-
-	return wrapOccurred;
+
+	return wrapOccurred;
+}
+
+/**
+ * Measure the lines changed since elastic tabstops were last placed and move the stops
+ * of their blocks.
+ * @return true if any stops moved.
+ */
+bool Editor::UpdateElasticTabstops() {
+	if (!view.ElasticTabstopsNeedUpdate()) {
+		return false;
+	}
+	RefreshStyleData();
+	AutoSurface surface(this);
+	if (!surface) {
+		return false;
+	}
+	const Range linesMoved = view.UpdateElasticTabstops(surface, *this, vs);
+	if (linesMoved.Empty()) {
+		return false;
+	}
+	NeedWrapping(linesMoved.start, linesMoved.end);
+	Redraw();
+	return true;
+}
+
+namespace {
+
+// Appended text held for more than this is added without waiting for the next frame
+constexpr size_t logPendingMaximum = 0x100000;
+
+}
+
+void Editor::AppendLog(const char *text, Sci::Position length) {
+	if (length <= 0) {
+		return;
+	}
+	logPending.append(text, length);
+	if (logPending.length() >= logPendingMaximum) {
+		FlushLog();
+	} else {
+		QueueIdleWork(WorkItems::appendLog);
+	}
+}
+
+/**
+ * Add the text appended in log mode since the last frame as one insertion, keeping the caret
+ * and view at the end when they were there, then trim the oldest lines over the limit.
+ * @return true if the document changed.
+ */
+bool Editor::FlushLog() {
+	if (logPending.empty()) {
+		return false;
+	}
+	const bool caretAtEnd = (sel.Count() == 1) && sel.Empty() && (sel.MainCaret() == pdoc->Length());
+	const bool viewAtEnd = topLine >= MaxScrollPos();
+	std::string text;
+	text.swap(logPending);
+	if ((pdoc->InsertString(pdoc->Length(), text) == 0) && !pdoc->IsReadOnly()) {
+		// Called while the document is being modified so try again later
+		logPending.insert(0, text);
+		return false;
+	}
+	if (logLineLimit > 0) {
+		// Trimming moves all the remaining text so wait for an eighth of the limit to gather
+		// beyond it, which keeps the cost for each appended line constant on average.
+		const Sci::Line lines = pdoc->LinesTotal();
+		if (lines > logLineLimit + logLineLimit / 8) {
+			const Sci::Position lengthTrim = pdoc->LineStart(lines - logLineLimit);
+			const Sci::Position endStyled = pdoc->GetEndStyled();
+			pdoc->DeleteChars(0, lengthTrim);
+			// Styles are removed along with the text so what remains need not be styled again
+			pdoc->StartStyling(std::max<Sci::Position>(endStyled - lengthTrim, 0));
+		}
+	}
+	if (caretAtEnd) {
+		SetEmptySelection(pdoc->Length());
+	}
+	if (viewAtEnd) {
+		ScrollTo(MaxScrollPos());
+	}
+	return true;
+}
+
+/**
+ * Whether a message reads or changes the text of the document or positions, lines or
+ * selections within it so the text held back in log mode has to be added first.
+ * Other messages, like those setting styles or options, leave the text waiting for the next frame.
+ */
+bool Editor::MessageUsesText(Message iMessage) noexcept {
+	switch (iMessage) {
+	// Text, styles and line state
+	case Message::AddText:
+	case Message::AddStyledText:
+	case Message::InsertText:
+	case Message::ChangeInsertion:
+	case Message::ClearAll:
+	case Message::DeleteRange:
+	case Message::ClearDocumentStyle:
+	case Message::GetLength:
+	case Message::GetCharAt:
+	case Message::GetStyleAt:
+	case Message::GetStyleIndexAt:
+	case Message::GetStyledText:
+	case Message::GetStyledTextFull:
+	case Message::GetCurLine:
+	case Message::GetEndStyled:
+	case Message::ConvertEOLs:
+	case Message::StartStyling:
+	case Message::SetStyling:
+	case Message::SetStylingEx:
+	case Message::ApplySemanticTokens:
+	case Message::SetLineState:
+	case Message::GetLineState:
+	case Message::GetMaxLineState:
+	case Message::SetLineIndentation:
+	case Message::GetLineIndentation:
+	case Message::GetLineIndentPosition:
+	case Message::GetColumn:
+	case Message::CountCharacters:
+	case Message::CountCodeUnits:
+	case Message::GetLineEndPosition:
+	case Message::GetLine:
+	case Message::GetLineCount:
+	case Message::GetModify:
+	case Message::GetSelText:
+	case Message::GetTextRange:
+	case Message::GetTextRangeFull:
+	case Message::LineFromPosition:
+	case Message::PositionFromLine:
+	case Message::ReplaceSel:
+	case Message::SetReadOnly:
+	case Message::SetText:
+	case Message::GetText:
+	case Message::GetTextLength:
+	case Message::GetCharacterPointer:
+	case Message::GetRangePointer:
+	case Message::GetGapPosition:
+	case Message::LinesJoin:
+	case Message::LinesSplit:
+	case Message::LineLength:
+	case Message::WordStartPosition:
+	case Message::WordEndPosition:
+	case Message::IsRangeWord:
+	case Message::PositionBefore:
+	case Message::PositionAfter:
+	case Message::PositionRelative:
+	case Message::PositionRelativeCodeUnits:
+	case Message::FindColumn:
+	case Message::TargetAsUTF8:
+	case Message::ReplaceRectangular:
+	case Message::AllocateLineCharacterIndex:
+	case Message::LineFromIndexPosition:
+	case Message::IndexPositionFromLine:
+	case Message::ConvertPositions:
+	case Message::GetTextStatistics:
+	case Message::GetContentHash:
+	case Message::GetContentModified:
+	case Message::AutoCGetDocumentWords:
+	case Message::AutoCShowDocumentWords:
+	case Message::ExportSelection:
+	case Message::ExportRange:
+	case Message::SetLogMode:
+	case Message::SetDocPointer:
+	case Message::Colourise:
+	case Message::ChangeLexerState:
+	case Message::PrivateLexerCall:
+	case Message::SetILexer:
+	// Undo history and clipboard
+	case Message::Undo:
+	case Message::Redo:
+	case Message::CanUndo:
+	case Message::CanRedo:
+	case Message::SetSavePoint:
+	case Message::AddUndoAction:
+	case Message::Cut:
+	case Message::Copy:
+	case Message::Paste:
+	case Message::Clear:
+	case Message::CopyRange:
+	case Message::CopyText:
+	case Message::LineCopy:
+	case Message::SelectionDuplicate:
+	// Searching, targets and comparing
+	case Message::FindText:
+	case Message::FindTextFull:
+	case Message::SetTargetStart:
+	case Message::GetTargetStart:
+	case Message::SetTargetStartVirtualSpace:
+	case Message::GetTargetStartVirtualSpace:
+	case Message::SetTargetEnd:
+	case Message::GetTargetEnd:
+	case Message::SetTargetEndVirtualSpace:
+	case Message::GetTargetEndVirtualSpace:
+	case Message::SetTargetRange:
+	case Message::GetTargetText:
+	case Message::TargetFromSelection:
+	case Message::TargetWholeDocument:
+	case Message::ReplaceTarget:
+	case Message::ReplaceTargetRE:
+	case Message::ReplaceTargetMinimal:
+	case Message::ReloadText:
+	case Message::SearchInTarget:
+	case Message::SearchAnchor:
+	case Message::SearchNext:
+	case Message::SearchPrev:
+	case Message::BraceHighlight:
+	case Message::BraceBadLight:
+	case Message::BraceMatch:
+	case Message::BraceMatchNext:
+	case Message::BraceEnclosing:
+	case Message::DiffDocument:
+	case Message::DiffGetHunk:
+	case Message::DiffAlignedLine:
+	case Message::DiffIndicate:
+	case Message::DiffPadAnnotations:
+	// Per line and per range decorations
+	case Message::MarkerLineFromHandle:
+	case Message::MarkerHandleFromLine:
+	case Message::MarkerNumberFromLine:
+	case Message::MarkerAdd:
+	case Message::MarkerDelete:
+	case Message::MarkerGet:
+	case Message::MarkerNext:
+	case Message::MarkerPrevious:
+	case Message::MarkerAddSet:
+	case Message::IndicatorFillRange:
+	case Message::IndicatorClearRange:
+	case Message::IndicatorAllOnFor:
+	case Message::IndicatorValueAt:
+	case Message::IndicatorStart:
+	case Message::IndicatorEnd:
+	case Message::MarginSetText:
+	case Message::MarginGetText:
+	case Message::MarginSetStyle:
+	case Message::MarginGetStyle:
+	case Message::MarginSetStyles:
+	case Message::MarginGetStyles:
+	case Message::AnnotationSetText:
+	case Message::AnnotationGetText:
+	case Message::AnnotationSetStyle:
+	case Message::AnnotationGetStyle:
+	case Message::AnnotationSetStyles:
+	case Message::AnnotationGetStyles:
+	case Message::AnnotationGetLines:
+	case Message::EOLAnnotationSetText:
+	case Message::EOLAnnotationGetText:
+	case Message::EOLAnnotationSetStyle:
+	case Message::EOLAnnotationGetStyle:
+	// Folding and display lines
+	case Message::VisibleFromDocLine:
+	case Message::DocLineFromVisible:
+	case Message::WrapCount:
+	case Message::SetFoldLevel:
+	case Message::GetFoldLevel:
+	case Message::GetLastChild:
+	case Message::GetFoldParent:
+	case Message::ShowLines:
+	case Message::HideLines:
+	case Message::GetLineVisible:
+	case Message::GetAllLinesVisible:
+	case Message::SetFoldExpanded:
+	case Message::GetFoldExpanded:
+	case Message::ToggleFold:
+	case Message::ToggleFoldShowText:
+	case Message::FoldLine:
+	case Message::FoldChildren:
+	case Message::ExpandChildren:
+	case Message::FoldAll:
+	case Message::ContractedFoldNext:
+	case Message::EnsureVisible:
+	case Message::EnsureVisibleEnforcePolicy:
+	// Caret, selection and scrolling
+	case Message::GetCurrentPos:
+	case Message::GetAnchor:
+	case Message::SelectAll:
+	case Message::PositionFromPoint:
+	case Message::PositionFromPointClose:
+	case Message::CharPositionFromPoint:
+	case Message::CharPositionFromPointClose:
+	case Message::PointXFromPosition:
+	case Message::PointYFromPosition:
+	case Message::GotoLine:
+	case Message::GotoPos:
+	case Message::SetAnchor:
+	case Message::SetCurrentPos:
+	case Message::SetSelectionStart:
+	case Message::GetSelectionStart:
+	case Message::SetSelectionEnd:
+	case Message::GetSelectionEnd:
+	case Message::SetEmptySelection:
+	case Message::SetSel:
+	case Message::SetSelectionSerialized:
+	case Message::GetSelectionSerialized:
+	case Message::SetSelectionMode:
+	case Message::ChangeSelectionMode:
+	case Message::GetLineSelStartPosition:
+	case Message::GetLineSelEndPosition:
+	case Message::GetSelections:
+	case Message::GetSelectionEmpty:
+	case Message::ClearSelections:
+	case Message::SetSelection:
+	case Message::AddSelection:
+	case Message::SelectionFromPoint:
+	case Message::DropSelectionN:
+	case Message::SetMainSelection:
+	case Message::SetSelectionNCaret:
+	case Message::GetSelectionNCaret:
+	case Message::SetSelectionNAnchor:
+	case Message::GetSelectionNAnchor:
+	case Message::SetSelectionNCaretVirtualSpace:
+	case Message::GetSelectionNCaretVirtualSpace:
+	case Message::SetSelectionNAnchorVirtualSpace:
+	case Message::GetSelectionNAnchorVirtualSpace:
+	case Message::SetSelectionNStart:
+	case Message::GetSelectionNStart:
+	case Message::GetSelectionNStartVirtualSpace:
+	case Message::SetSelectionNEnd:
+	case Message::GetSelectionNEndVirtualSpace:
+	case Message::GetSelectionNEnd:
+	case Message::SetRectangularSelectionCaret:
+	case Message::GetRectangularSelectionCaret:
+	case Message::SetRectangularSelectionAnchor:
+	case Message::GetRectangularSelectionAnchor:
+	case Message::SetRectangularSelectionCaretVirtualSpace:
+	case Message::GetRectangularSelectionCaretVirtualSpace:
+	case Message::SetRectangularSelectionAnchorVirtualSpace:
+	case Message::GetRectangularSelectionAnchorVirtualSpace:
+	case Message::RotateSelection:
+	case Message::SwapMainAnchorCaret:
+	case Message::MultipleSelectAddNext:
+	case Message::MultipleSelectAddEach:
+	case Message::MoveSelectedLinesUp:
+	case Message::MoveSelectedLinesDown:
+	case Message::MoveCaretInsideView:
+	case Message::ChooseCaretX:
+	case Message::VerticalCentreCaret:
+	case Message::GetFirstVisibleLine:
+	case Message::SetFirstVisibleLine:
+	case Message::LineScroll:
+	case Message::ScrollVertical:
+	case Message::ScrollCaret:
+	case Message::ScrollRange:
+	case Message::ScrollToStart:
+	case Message::ScrollToEnd:
+	case Message::FindIndicatorShow:
+	case Message::FindIndicatorFlash:
+	case Message::CallTipShow:
+	case Message::AutoCShow:
+	case Message::AutoCComplete:
+	case Message::AutoCPosStart:
+	case Message::UserListShow:
+	case Message::FormatRange:
+	case Message::FormatRangeFull:
+	// Keyboard commands and line operations
+	case Message::LineDown:
+	case Message::LineDownExtend:
+	case Message::ParaDown:
+	case Message::ParaDownExtend:
+	case Message::LineUp:
+	case Message::LineUpExtend:
+	case Message::ParaUp:
+	case Message::ParaUpExtend:
+	case Message::CharLeft:
+	case Message::CharLeftExtend:
+	case Message::CharRight:
+	case Message::CharRightExtend:
+	case Message::WordLeft:
+	case Message::WordLeftExtend:
+	case Message::WordRight:
+	case Message::WordRightExtend:
+	case Message::WordLeftEnd:
+	case Message::WordLeftEndExtend:
+	case Message::WordRightEnd:
+	case Message::WordRightEndExtend:
+	case Message::Home:
+	case Message::HomeExtend:
+	case Message::LineEnd:
+	case Message::LineEndExtend:
+	case Message::HomeWrap:
+	case Message::HomeWrapExtend:
+	case Message::LineEndWrap:
+	case Message::LineEndWrapExtend:
+	case Message::DocumentStart:
+	case Message::DocumentStartExtend:
+	case Message::DocumentEnd:
+	case Message::DocumentEndExtend:
+	case Message::StutteredPageUp:
+	case Message::StutteredPageUpExtend:
+	case Message::StutteredPageDown:
+	case Message::StutteredPageDownExtend:
+	case Message::PageUp:
+	case Message::PageUpExtend:
+	case Message::PageDown:
+	case Message::PageDownExtend:
+	case Message::DeleteBack:
+	case Message::Tab:
+	case Message::LineIndent:
+	case Message::BackTab:
+	case Message::LineDedent:
+	case Message::NewLine:
+	case Message::FormFeed:
+	case Message::VCHome:
+	case Message::VCHomeExtend:
+	case Message::VCHomeWrap:
+	case Message::VCHomeWrapExtend:
+	case Message::VCHomeDisplay:
+	case Message::VCHomeDisplayExtend:
+	case Message::DelWordLeft:
+	case Message::DelWordRight:
+	case Message::DelWordRightEnd:
+	case Message::DelLineLeft:
+	case Message::DelLineRight:
+	case Message::LineCut:
+	case Message::LineDelete:
+	case Message::LineTranspose:
+	case Message::LineReverse:
+	case Message::LineDuplicate:
+	case Message::LowerCase:
+	case Message::UpperCase:
+	case Message::LineScrollDown:
+	case Message::LineScrollUp:
+	case Message::WordPartLeft:
+	case Message::WordPartLeftExtend:
+	case Message::WordPartRight:
+	case Message::WordPartRightExtend:
+	case Message::DeleteBackNotLine:
+	case Message::HomeDisplay:
+	case Message::HomeDisplayExtend:
+	case Message::LineEndDisplay:
+	case Message::LineEndDisplayExtend:
+	case Message::LineDownRectExtend:
+	case Message::LineUpRectExtend:
+	case Message::CharLeftRectExtend:
+	case Message::CharRightRectExtend:
+	case Message::HomeRectExtend:
+	case Message::VCHomeRectExtend:
+	case Message::LineEndRectExtend:
+	case Message::PageUpRectExtend:
+	case Message::PageDownRectExtend:
+	case Message::LineSort:
+	case Message::LineUnique:
+	case Message::LineKeepMatching:
+	case Message::LineDropMatching:
+		return true;
+	default:
+		return false;
+	}
 }
 
 void Editor::LinesJoin() {
@@ -1880,6 +2347,13 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 
 	paintAbandonedByStyling = false;
 
+	// Text appended in log mode since the last frame
+	if (FlushLog()) {
+		if (AbandonPaint()) {
+			return;
+		}
+	}
+
 	StyleAreaBounded(rcArea, false);
 
 	const PRectangle rcClient = GetClientRectangle();
@@ -1890,6 +2364,13 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 		RefreshStyleData();
 	}
 
+	// Moving elastic tabstops may move text outside the area being painted.
+	if (UpdateElasticTabstops()) {
+		if (AbandonPaint()) {
+			return;
+		}
+	}
+
 	// Wrap the visible lines if needed.
 	if (WrapLines(WrapScope::wsVisible)) {
 		// The wrapping process has changed the height of some lines so
@@ -2091,43 +2572,35 @@ void Editor::InsertCharacter(std::string_view sv, CharacterSource charSource) {
 	{
 		UndoGroup ug(pdoc, (sel.Count() > 1) || !sel.Empty() || inOverstrike);
 
-		// Vector elements point into selection in order to change selection.
-		std::vector<SelectionRange *> selPtrs;
-		for (size_t r = 0; r < sel.Count(); r++) {
-			selPtrs.push_back(&sel.Range(r));
-		}
-		// Order selections by position in document.
-		std::sort(selPtrs.begin(), selPtrs.end(),
-			[](const SelectionRange *a, const SelectionRange *b) noexcept {return *a < *b;});
-
-		// Loop in reverse to avoid disturbing positions of selections yet to be processed.
-		for (std::vector<SelectionRange *>::reverse_iterator rit = selPtrs.rbegin();
-			rit != selPtrs.rend(); ++rit) {
-			SelectionRange *currentSel = *rit;
-			if (!RangeContainsProtected(*currentSel)) {
-				Sci::Position positionInsert = currentSel->Start().Position();
-				if (!currentSel->Empty()) {
-					ClearSelectionRange(*currentSel);
-				} else if (inOverstrike) {
-					if (positionInsert < pdoc->Length()) {
-						if (!pdoc->IsPositionInLineEnd(positionInsert)) {
-							pdoc->DelChar(positionInsert);
-							currentSel->ClearVirtualSpace();
+		{
+			// Edit from the end of the document to avoid disturbing positions of selections yet to be processed.
+			SelectionEditFromEnd editFromEnd(sel);
+			while (SelectionRange *currentSel = editFromEnd.Next()) {
+				if (!RangeContainsProtected(*currentSel)) {
+					Sci::Position positionInsert = currentSel->Start().Position();
+					if (!currentSel->Empty()) {
+						ClearSelectionRange(*currentSel);
+					} else if (inOverstrike) {
+						if (positionInsert < pdoc->Length()) {
+							if (!pdoc->IsPositionInLineEnd(positionInsert)) {
+								pdoc->DelChar(positionInsert);
+								currentSel->ClearVirtualSpace();
+							}
 						}
 					}
-				}
-				positionInsert = RealizeVirtualSpace(positionInsert, currentSel->caret.VirtualSpace());
-				const Sci::Position lengthInserted = pdoc->InsertString(positionInsert, sv);
-				if (lengthInserted > 0) {
-					*currentSel = SelectionRange(positionInsert + lengthInserted);
-				}
-				currentSel->ClearVirtualSpace();
-				// If in wrap mode rewrap current line so EnsureCaretVisible has accurate information
-				if (Wrapping()) {
-					AutoSurface surface(this);
-					if (surface) {
-						if (WrapOneLine(surface, pdoc->SciLineFromPosition(positionInsert))) {
-							wrapOccurred = true;
+					positionInsert = RealizeVirtualSpace(positionInsert, currentSel->caret.VirtualSpace());
+					const Sci::Position lengthInserted = pdoc->InsertString(positionInsert, sv);
+					if (lengthInserted > 0) {
+						*currentSel = SelectionRange(positionInsert + lengthInserted);
+					}
+					currentSel->ClearVirtualSpace();
+					// If in wrap mode rewrap current line so EnsureCaretVisible has accurate information
+					if (Wrapping()) {
+						AutoSurface surface(this);
+						if (surface) {
+							if (WrapOneLine(surface, pdoc->SciLineFromPosition(positionInsert))) {
+								wrapOccurred = true;
+							}
 						}
 					}
 				}
@@ -2257,12 +2730,16 @@ void Editor::ClearSelection(bool retainMultipleSelections) {
 	if (!sel.IsRectangular() && !retainMultipleSelections)
 		FilterSelections();
 	UndoGroup ug(pdoc);
-	for (size_t r=0; r<sel.Count(); r++) {
-		if (!sel.Range(r).Empty()) {
-			if (!RangeContainsProtected(sel.Range(r))) {
-				pdoc->DeleteChars(sel.Range(r).Start().Position(),
-					sel.Range(r).Length());
-				sel.Range(r) = SelectionRange(sel.Range(r).Start());
+	{
+		// Edit from the end of the document to avoid disturbing positions of selections yet to be processed.
+		SelectionEditFromEnd editFromEnd(sel);
+		while (SelectionRange *currentSel = editFromEnd.Next()) {
+			if (!currentSel->Empty()) {
+				if (!RangeContainsProtected(*currentSel)) {
+					pdoc->DeleteChars(currentSel->Start().Position(),
+						currentSel->Length());
+					*currentSel = SelectionRange(currentSel->Start());
+				}
 			}
 		}
 	}
@@ -2386,20 +2863,22 @@ void Editor::Clear() {
 			singleVirtual = true;
 		}
 		UndoGroup ug(pdoc, (sel.Count() > 1) || singleVirtual);
-		for (size_t r=0; r<sel.Count(); r++) {
-			if (!RangeContainsProtected(sel.Range(r).caret.Position(), sel.Range(r).caret.Position() + 1)) {
-				if (sel.Range(r).Start().VirtualSpace()) {
-					if (sel.Range(r).anchor < sel.Range(r).caret)
-						sel.Range(r) = SelectionRange(RealizeVirtualSpace(sel.Range(r).anchor.Position(), sel.Range(r).anchor.VirtualSpace()));
+		// Edit from the end of the document to avoid disturbing positions of selections yet to be processed.
+		SelectionEditFromEnd editFromEnd(sel);
+		while (SelectionRange *currentSel = editFromEnd.Next()) {
+			if (!RangeContainsProtected(currentSel->caret.Position(), currentSel->caret.Position() + 1)) {
+				if (currentSel->Start().VirtualSpace()) {
+					if (currentSel->anchor < currentSel->caret)
+						*currentSel = SelectionRange(RealizeVirtualSpace(currentSel->anchor.Position(), currentSel->anchor.VirtualSpace()));
 					else
-						sel.Range(r) = SelectionRange(RealizeVirtualSpace(sel.Range(r).caret.Position(), sel.Range(r).caret.VirtualSpace()));
+						*currentSel = SelectionRange(RealizeVirtualSpace(currentSel->caret.Position(), currentSel->caret.VirtualSpace()));
 				}
-				if ((sel.Count() == 1) || !pdoc->IsPositionInLineEnd(sel.Range(r).caret.Position())) {
-					pdoc->DelChar(sel.Range(r).caret.Position());
-					sel.Range(r).ClearVirtualSpace();
+				if ((sel.Count() == 1) || !pdoc->IsPositionInLineEnd(currentSel->caret.Position())) {
+					pdoc->DelChar(currentSel->caret.Position());
+					currentSel->ClearVirtualSpace();
 				}  // else multiple selection so don't eat line ends
 			} else {
-				sel.Range(r).ClearVirtualSpace();
+				currentSel->ClearVirtualSpace();
 			}
 		}
 	} else {
@@ -2466,33 +2945,37 @@ void Editor::DelCharBack(bool allowLineStartDeletion) {
 		allowLineStartDeletion = false;
 	UndoGroup ug(pdoc, (sel.Count() > 1) || !sel.Empty());
 	if (sel.Empty()) {
-		for (size_t r=0; r<sel.Count(); r++) {
-			if (!RangeContainsProtected(sel.Range(r).caret.Position() - 1, sel.Range(r).caret.Position())) {
-				if (sel.Range(r).caret.VirtualSpace()) {
-					sel.Range(r).caret.SetVirtualSpace(sel.Range(r).caret.VirtualSpace() - 1);
-					sel.Range(r).anchor.SetVirtualSpace(sel.Range(r).caret.VirtualSpace());
-				} else {
-					const Sci::Line lineCurrentPos =
-						pdoc->SciLineFromPosition(sel.Range(r).caret.Position());
-					if (allowLineStartDeletion || (pdoc->LineStart(lineCurrentPos) != sel.Range(r).caret.Position())) {
-						if (pdoc->GetColumn(sel.Range(r).caret.Position()) <= pdoc->GetLineIndentation(lineCurrentPos) &&
-								pdoc->GetColumn(sel.Range(r).caret.Position()) > 0 && pdoc->backspaceUnindents) {
-							UndoGroup ugInner(pdoc, !ug.Needed());
-							const int indentation = pdoc->GetLineIndentation(lineCurrentPos);
-							const int indentationStep = pdoc->IndentSize();
-							int indentationChange = indentation % indentationStep;
-							if (indentationChange == 0)
-								indentationChange = indentationStep;
-							const Sci::Position posSelect = pdoc->SetLineIndentation(lineCurrentPos, indentation - indentationChange);
-							// SetEmptySelection
-							sel.Range(r) = SelectionRange(posSelect);
-						} else {
-							pdoc->DelCharBack(sel.Range(r).caret.Position());
+		{
+			// Edit from the end of the document to avoid disturbing positions of selections yet to be processed.
+			SelectionEditFromEnd editFromEnd(sel);
+			while (SelectionRange *currentSel = editFromEnd.Next()) {
+				if (!RangeContainsProtected(currentSel->caret.Position() - 1, currentSel->caret.Position())) {
+					if (currentSel->caret.VirtualSpace()) {
+						currentSel->caret.SetVirtualSpace(currentSel->caret.VirtualSpace() - 1);
+						currentSel->anchor.SetVirtualSpace(currentSel->caret.VirtualSpace());
+					} else {
+						const Sci::Line lineCurrentPos =
+							pdoc->SciLineFromPosition(currentSel->caret.Position());
+						if (allowLineStartDeletion || (pdoc->LineStart(lineCurrentPos) != currentSel->caret.Position())) {
+							if (pdoc->GetColumn(currentSel->caret.Position()) <= pdoc->GetLineIndentation(lineCurrentPos) &&
+									pdoc->GetColumn(currentSel->caret.Position()) > 0 && pdoc->backspaceUnindents) {
+								UndoGroup ugInner(pdoc, !ug.Needed());
+								const int indentation = pdoc->GetLineIndentation(lineCurrentPos);
+								const int indentationStep = pdoc->IndentSize();
+								int indentationChange = indentation % indentationStep;
+								if (indentationChange == 0)
+									indentationChange = indentationStep;
+								const Sci::Position posSelect = pdoc->SetLineIndentation(lineCurrentPos, indentation - indentationChange);
+								// SetEmptySelection
+								*currentSel = SelectionRange(posSelect);
+							} else {
+								pdoc->DelCharBack(currentSel->caret.Position());
+							}
 						}
 					}
+				} else {
+					currentSel->ClearVirtualSpace();
 				}
-			} else {
-				sel.Range(r).ClearVirtualSpace();
 			}
 		}
 		ThinRectangularRange();
@@ -2722,6 +3205,7 @@ void Editor::CheckModificationForWrap(DocModification mh) {
 		view.llc.Invalidate(LineLayout::ValidLevel::checkTextAndStyle);
 		const Sci::Line lineDoc = pdoc->SciLineFromPosition(mh.position);
 		const Sci::Line lines = std::max(static_cast<Sci::Line>(0), mh.linesAdded);
+		view.ElasticTabstopsChanged(lineDoc, lineDoc + lines + 1);
 		if (Wrapping()) {
 			// Check if this modification crosses any of the wrap points
 			if (wrapPending.NeedsWrap()) {
@@ -2803,6 +3287,8 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 		}
 		if (FlagSet(mh.modificationType, ModificationFlags::ChangeStyle)) {
 			view.llc.Invalidate(LineLayout::ValidLevel::checkTextAndStyle);
+			view.ElasticTabstopsChanged(pdoc->SciLineFromPosition(mh.position),
+				pdoc->SciLineFromPosition(mh.position + mh.length) + 1);
 		}
 	} else {
 		if (FlagSet(undoSelectionHistoryOption, UndoSelectionHistoryOption::Enabled) &&
@@ -3042,6 +3528,11 @@ void Editor::NotifyMacroRecord(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::LineDelete:
 	case Message::LineTranspose:
 	case Message::LineReverse:
+	case Message::LineSort:
+	case Message::LineUnique:
+	case Message::LineKeepMatching:
+	case Message::LineDropMatching:
+	case Message::NormalizeWhitespace:
 	case Message::LineDuplicate:
 	case Message::LowerCase:
 	case Message::UpperCase:
@@ -3216,6 +3707,67 @@ void Editor::LineTranspose() {
 	}
 }
 
+// Reorder or filter the lines from lineStart to lineEnd then replace only the lines that changed.
+// Line ends stay in place so the block keeps its final line end or lack of one.
+template <typename Operation>
+void Editor::RearrangeLines(Sci::Line lineStart, Sci::Line lineEnd, Operation operation) {
+	const Sci::Position start = pdoc->LineStart(lineStart);
+	const Sci::Position end = pdoc->LineStart(lineEnd + 1);
+	const std::string_view text(pdoc->RangePointer(start, end - start), end - start);
+	std::vector<LineSpan> layout;
+	layout.reserve(lineEnd - lineStart + 1);
+	for (Sci::Line line = lineStart; line <= lineEnd; line++) {
+		const Sci::Position lineBegin = pdoc->LineStart(line);
+		const Sci::Position lineContentsEnd = pdoc->LineEnd(line);
+		layout.push_back({
+			static_cast<size_t>(lineBegin - start),
+			static_cast<size_t>(lineContentsEnd - lineBegin),
+			static_cast<size_t>(pdoc->LineStart(line + 1) - lineContentsEnd)});
+	}
+	std::vector<LineSpan> lines = layout;
+	operation(text, lines);
+	const std::string replacement = JoinLineSpans(text, layout, lines);
+
+	// Leading and trailing lines that are unchanged, including their line ends
+	const auto lineEndAt = [&](size_t line) noexcept {
+		return ((line == lines.size() - 1) ? layout.back() : layout[line]).End(text);
+	};
+	const auto sameLine = [&](size_t line, size_t lineOriginal) noexcept {
+		return (lines[line].Contents(text) == layout[lineOriginal].Contents(text)) &&
+			(lineEndAt(line) == layout[lineOriginal].End(text));
+	};
+	const size_t linesCommon = std::min(layout.size(), lines.size());
+	size_t linesBefore = 0;
+	while ((linesBefore < linesCommon) && sameLine(linesBefore, linesBefore)) {
+		linesBefore++;
+	}
+	size_t linesAfter = 0;
+	while ((linesBefore + linesAfter < linesCommon) &&
+		sameLine(lines.size() - 1 - linesAfter, layout.size() - 1 - linesAfter)) {
+		linesAfter++;
+	}
+	const size_t lengthBefore = (linesBefore < layout.size()) ? layout[linesBefore].start : text.length();
+	const size_t lengthAfter = text.length() -
+		((linesAfter > 0) ? layout[layout.size() - linesAfter].start : text.length());
+	const size_t lengthRemove = text.length() - lengthBefore - lengthAfter;
+	const size_t lengthInsert = replacement.length() - lengthBefore - lengthAfter;
+	if (lengthRemove > 0 || lengthInsert > 0) {
+		UndoGroup ug(pdoc);
+		pdoc->DeleteChars(start + lengthBefore, lengthRemove);
+		pdoc->InsertString(start + lengthBefore, replacement.data() + lengthBefore, lengthInsert);
+	}
+	// Wholly select all affected lines
+	sel.RangeMain() = SelectionRange(start, start + replacement.length());
+}
+
+void Editor::LinesForOperation(Sci::Line &lineStart, Sci::Line &lineEnd) const noexcept {
+	// The lines touched by the main selection or the whole document when it is empty
+	const SelectionRange &rangeMain = sel.RangeMain();
+	const bool whole = rangeMain.Empty();
+	lineStart = whole ? 0 : pdoc->SciLineFromPosition(rangeMain.Start().Position());
+	lineEnd = pdoc->SciLineFromPosition((whole ? pdoc->Length() : rangeMain.End().Position()) - 1);
+}
+
 void Editor::LineReverse() {
 	const Sci::Line lineStart =
 		pdoc->SciLineFromPosition(sel.RangeMain().Start().Position());
@@ -3224,25 +3776,147 @@ void Editor::LineReverse() {
 	const Sci::Line lineDiff = lineEnd - lineStart;
 	if (lineDiff <= 0)
 		return;
-	UndoGroup ug(pdoc);
-	for (Sci::Line i=(lineDiff+1)/2-1; i>=0; --i) {
-		const Sci::Line lineNum2 = lineEnd - i;
-		const Sci::Line lineNum1 = lineStart + i;
-		Sci::Position lineStart2 = pdoc->LineStart(lineNum2);
-		const Sci::Position lineStart1 = pdoc->LineStart(lineNum1);
-		const std::string line2 = RangeText(lineStart2, pdoc->LineEnd(lineNum2));
-		const std::string line1 = RangeText(lineStart1, pdoc->LineEnd(lineNum1));
-		const Sci::Position lineLen2 = line2.length();
-		const Sci::Position lineLen1 = line1.length();
-		pdoc->DeleteChars(lineStart2, lineLen2);
-		pdoc->DeleteChars(lineStart1, lineLen1);
-		lineStart2 -= lineLen1;
-		pdoc->InsertString(lineStart2, line1);
-		pdoc->InsertString(lineStart1, line2);
+	RearrangeLines(lineStart, lineEnd, [](std::string_view, std::vector<LineSpan> &lines) {
+		std::reverse(lines.begin(), lines.end());
+	});
+}
+
+void Editor::SortLines(LineSort options) {
+	Sci::Line lineStart = 0;
+	Sci::Line lineEnd = 0;
+	LinesForOperation(lineStart, lineEnd);
+	if (lineEnd <= lineStart)
+		return;
+	std::unique_ptr<CaseFolder> pcf;
+	if (FlagSet(options, LineSort::CaseInsensitive)) {
+		pcf = CaseFolderForEncoding();
 	}
-	// Wholly select all affected lines
-	sel.RangeMain() = SelectionRange(pdoc->LineStart(lineStart),
-		pdoc->LineStart(lineEnd+1));
+	RearrangeLines(lineStart, lineEnd, [options, &pcf](std::string_view text, std::vector<LineSpan> &lines) {
+		SortLineSpans(text, lines, options, pcf.get());
+	});
+}
+
+void Editor::UniqueLines() {
+	Sci::Line lineStart = 0;
+	Sci::Line lineEnd = 0;
+	LinesForOperation(lineStart, lineEnd);
+	if (lineEnd <= lineStart)
+		return;
+	RearrangeLines(lineStart, lineEnd, [](std::string_view text, std::vector<LineSpan> &lines) {
+		UniqueLineSpans(text, lines);
+	});
+}
+
+void Editor::FilterLines(const char *text, Sci::Position length, bool keep) {
+	Sci::Line lineStart = 0;
+	Sci::Line lineEnd = 0;
+	LinesForOperation(lineStart, lineEnd);
+	if (lineEnd < lineStart)
+		return;
+
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+	// Search the block once, continuing from the line after each match
+	std::vector<bool> matched(lineEnd - lineStart + 1);
+	try {
+		const Sci::Position end = pdoc->LineStart(lineEnd + 1);
+		Sci::Position pos = pdoc->LineStart(lineStart);
+		while (pos < end) {
+			Sci::Position lengthFound = length;
+			const Sci::Position found = pdoc->FindText(pos, end, text, searchFlags, &lengthFound);
+			if (found < 0)
+				break;
+			const Sci::Line line = pdoc->SciLineFromPosition(found);
+			if (line > lineEnd)
+				break;
+			matched[line - lineStart] = true;
+			pos = pdoc->LineStart(line + 1);
+		}
+	} catch (RegexError &) {
+		errorStatus = Status::RegEx;
+		return;
+	}
+
+	RearrangeLines(lineStart, lineEnd, [&matched, keep](std::string_view, std::vector<LineSpan> &lines) {
+		std::vector<LineSpan> kept;
+		for (size_t line = 0; line < lines.size(); line++) {
+			if (matched[line] == keep) {
+				kept.push_back(lines[line]);
+			}
+		}
+		lines = std::move(kept);
+	});
+}
+
+// Fill indicator with the current value over the changed text found by the last
+// comparison and clear it elsewhere.
+Sci::Position Editor::DiffIndicate(int indicator) {
+	if ((indicator < 0) || (indicator > IndicatorMax)) {
+		return 0;
+	}
+	const int indicatorCurrent = pdoc->decorations->GetCurrentIndicator();
+	pdoc->decorations->SetCurrentIndicator(indicator);
+	const Sci::Position length = pdoc->Length();
+	pdoc->DecorationFillRange(0, 0, length);
+	Sci::Position ranges = 0;
+	if (diff) {
+		const int value = pdoc->decorations->GetCurrentValue();
+		for (const Range &change : diff->changes) {
+			// The document may have changed since it was compared
+			const Sci::Position start = pdoc->MovePositionOutsideChar(std::min(change.start, length), -1);
+			const Sci::Position end = pdoc->MovePositionOutsideChar(std::min(change.end, length), 1);
+			if (start < end) {
+				pdoc->DecorationFillRange(start, value, end - start);
+				ranges++;
+			}
+		}
+	}
+	pdoc->decorations->SetCurrentIndicator(indicatorCurrent);
+	return ranges;
+}
+
+// Replace the annotations with blank lines under each hunk that has fewer lines than
+// in the other document so aligned lines are shown at the same height.
+// Annotations go below lines so lines inserted before the first line can not be padded.
+namespace {
+
+bool IsDiffPadding(const StyledText &annotation, int style) noexcept {
+	if (!annotation.text || annotation.multipleStyles || (annotation.style != static_cast<size_t>(style))) {
+		return false;
+	}
+	return std::all_of(annotation.text, annotation.text + annotation.length, [](char ch) noexcept {
+		return ch == '\n';
+	});
+}
+
+}
+
+Sci::Line Editor::DiffPadAnnotations(int style) {
+	// Take back the padding added before, leaving any annotations set by the application
+	for (const Sci::Line line : diffPaddedLines) {
+		if ((line < pdoc->LinesTotal()) && IsDiffPadding(pdoc->AnnotationStyledText(line), diffPadStyle)) {
+			pdoc->AnnotationSetText(line, nullptr);
+		}
+	}
+	diffPaddedLines.clear();
+	diffPadStyle = style;
+	if (!diff) {
+		return 0;
+	}
+	constexpr size_t maximumAnnotationLines = 0x7fff;
+	Sci::Line padded = 0;
+	for (const Internal::DiffHunk &hunk : diff->hunks) {
+		const Sci::Line line = static_cast<Sci::Line>(hunk.startA + hunk.lengthA) - 1;
+		if ((hunk.lengthB > hunk.lengthA) && (line >= 0) && !pdoc->AnnotationStyledText(line).text) {
+			const size_t padding = std::min(hunk.lengthB - hunk.lengthA, maximumAnnotationLines);
+			const std::string blank(padding - 1, '\n');
+			pdoc->AnnotationSetStyle(line, style);
+			pdoc->AnnotationSetText(line, blank.c_str());
+			diffPaddedLines.push_back(line);
+			padded += padding;
+		}
+	}
+	return padded;
 }
 
 void Editor::Duplicate(bool forLine) {
@@ -4440,7 +5114,7 @@ bool Editor::CopyLineRange(SelectionText *ss, bool allowProtected) {
 	if (allowProtected || !RangeContainsProtected(start, end)) {
 		std::string text = RangeText(start, end);
 		text.append(pdoc->EOLString());
-		ss->Copy(text, pdoc->dbcsCodePage,
+		ss->Copy(std::move(text), pdoc->dbcsCodePage,
 			vs.styles[StyleDefault].characterSet, false, true);
 		return true;
 	}
@@ -4453,21 +5127,61 @@ void Editor::CopySelectionRange(SelectionText *ss, bool allowLineCopy) {
 			CopyLineRange(ss);
 		}
 	} else {
+		// Gather the text straight from the document instead of copying each range first
 		std::string text;
+		Sci::Position lengthSelected = 0;
+		for (size_t r = 0; r < sel.Count(); r++) {
+			lengthSelected += sel.Range(r).Length();
+		}
+		text.reserve(lengthSelected);
+		TextExport textExport {};
+		textExport.write = [](void *context, const char *s, Position length) noexcept -> int {
+			static_cast<std::string *>(context)->append(s, length);
+			return 1;
+		};
+		textExport.context = &text;
+		ExportSelectionRange(textExport, false);
+		ss->Copy(std::move(text), pdoc->dbcsCodePage,
+			vs.styles[StyleDefault].characterSet, textExport.rectangular, textExport.lineCopy);
+	}
+}
+
+// Write the text that would be copied to the clipboard to the sink of textExport without
+// holding all of it in memory. Returns the number of bytes written.
+Sci::Position Editor::ExportSelectionRange(TextExport &textExport, bool allowLineCopy) {
+	TextExporter exporter(textExport);
+	const SplitView view = pdoc->AllView();
+	textExport.rectangular = false;
+	textExport.lineCopy = false;
+	if (sel.Empty()) {
+		if (allowLineCopy) {
+			const Sci::Line currentLine = pdoc->SciLineFromPosition(sel.MainCaret());
+			if (exporter.Range(view, pdoc->LineStart(currentLine), pdoc->LineEnd(currentLine))) {
+				exporter.Text(pdoc->EOLString());
+			}
+			textExport.lineCopy = true;
+		}
+	} else {
 		std::vector<SelectionRange> rangesInOrder = sel.RangesCopy();
 		if (sel.selType == Selection::SelTypes::rectangle)
 			std::sort(rangesInOrder.begin(), rangesInOrder.end());
 		const std::string_view separator = (sel.selType == Selection::SelTypes::rectangle) ? pdoc->EOLString() : copySeparator;
 		for (size_t part = 0; part < rangesInOrder.size(); part++) {
-			text.append(RangeText(rangesInOrder[part].Start().Position(), rangesInOrder[part].End().Position()));
+			if (!exporter.Range(view, rangesInOrder[part].Start().Position(), rangesInOrder[part].End().Position())) {
+				break;
+			}
 			if ((sel.selType == Selection::SelTypes::rectangle) || (part < rangesInOrder.size() - 1)) {
 				// Append unless simple selection or last part of multiple selection
-				text.append(separator);
+				if (!exporter.Text(separator)) {
+					break;
+				}
 			}
 		}
-		ss->Copy(text, pdoc->dbcsCodePage,
-			vs.styles[StyleDefault].characterSet, sel.IsRectangular(), sel.selType == Selection::SelTypes::lines);
+		textExport.rectangular = sel.IsRectangular();
+		textExport.lineCopy = sel.selType == Selection::SelTypes::lines;
 	}
+	exporter.Finish();
+	return exporter.Written();
 }
 
 void Editor::CopyRangeToClipboard(Sci::Position start, Sci::Position end) {
@@ -4475,7 +5189,7 @@ void Editor::CopyRangeToClipboard(Sci::Position start, Sci::Position end) {
 	end = pdoc->ClampPositionIntoDocument(end);
 	SelectionText selectedText;
 	std::string text = RangeText(start, end);
-	selectedText.Copy(text,
+	selectedText.Copy(std::move(text),
 		pdoc->dbcsCodePage, vs.styles[StyleDefault].characterSet, false, false);
 	CopyToClipboard(selectedText);
 }
@@ -5435,6 +6149,9 @@ void Editor::IdleStyle() {
 void Editor::IdleWork() {
 	// Style the line after the modification as this allows modifications that change just the
 	// line of the modification to heal instead of propagating to the rest of the window.
+	if (FlagSet(workNeeded.items, WorkItems::appendLog)) {
+		FlushLog();
+	}
 	if (FlagSet(workNeeded.items, WorkItems::style)) {
 		StyleToPositionInView(pdoc->LineStart(pdoc->LineFromPosition(workNeeded.upTo) + 2));
 	}
@@ -5560,6 +6277,7 @@ void Editor::SetDocPointer(Document *document) {
 	SetRepresentations();
 
 	scrollToAfterWrap.reset();
+	diff.reset();
 
 	// Reset the contraction state to fully shown.
 	pcs->Clear();
@@ -6261,6 +6979,49 @@ sptr_t Editor::BytesResult(Hyperion::sptr_t lParam, std::string_view sv) noexcep
 	return sv.length();
 }
 
+/**
+ * Make each call packed into batch.calls in order, as if each was sent on its own, storing
+ * what each returns in batch.results. Stops after a call that fails. A payload that is not
+ * terminated or a nested batch, which could recurse without end, fails.
+ * @return the number of calls made.
+ */
+Sci::Position Editor::CallBatch(const Batch &batch) {
+	Sci::Position calls = 0;
+	const size_t length = batch.length;
+	size_t offset = 0;
+	while (offset + sizeof(BatchCall) <= length) {
+		// The buffer may not be aligned so copy each call out of it
+		BatchCall call {};
+		memcpy(&call, batch.calls + offset, sizeof(BatchCall));
+		char *payload = batch.calls + offset + sizeof(BatchCall);
+		offset += sizeof(BatchCall);
+		if (call.payloadLength > 0) {
+			const size_t lengthTerminated = static_cast<size_t>(call.payloadLength) + 1;
+			if ((lengthTerminated > length - offset) || (payload[call.payloadLength] != '\0')) {
+				errorStatus = Status::Failure;
+				break;
+			}
+			offset += std::min(length - offset,
+				lengthTerminated + (sizeof(sptr_t) - lengthTerminated % sizeof(sptr_t)) % sizeof(sptr_t));
+		}
+		sptr_t result = 0;
+		if (call.message == Message::CallBatch) {
+			errorStatus = Status::Failure;
+		} else {
+			const sptr_t lParam = (call.payloadLength > 0) ? reinterpret_cast<sptr_t>(payload) : call.lParam;
+			result = WndProc(call.message, call.wParam, lParam);
+		}
+		if (batch.results) {
+			batch.results[calls] = result;
+		}
+		calls++;
+		if ((errorStatus > Status::Ok) && (errorStatus < Status::WarnStart)) {
+			break;
+		}
+	}
+	return calls;
+}
+
 sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	//Platform::DebugPrintf("S start wnd proc %d %d %d\n",iMessage, wParam, lParam);
 
@@ -6339,6 +7100,29 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		CopyText(wParam, ConstCharPtrFromSPtr(lParam));
 		break;
 
+	case Message::ExportSelection: {
+			TextExport *textExport = static_cast<TextExport *>(PtrFromSPtr(lParam));
+			if (!textExport) {
+				return 0;
+			}
+			return ExportSelectionRange(*textExport, wParam != 0);
+		}
+
+	case Message::ExportRange: {
+			TextExport *textExport = static_cast<TextExport *>(PtrFromSPtr(lParam));
+			if (!textExport) {
+				return 0;
+			}
+			const Sci::Position length = pdoc->Length();
+			const Sci::Position start = std::clamp<Sci::Position>(textExport->chrg.cpMin, 0, length);
+			const Sci::Position end = (textExport->chrg.cpMax < 0) ? length :
+				std::clamp<Sci::Position>(textExport->chrg.cpMax, start, length);
+			TextExporter exporter(*textExport);
+			exporter.Range(pdoc->AllView(), start, end);
+			exporter.Finish();
+			return exporter.Written();
+		}
+
 	case Message::Paste:
 		Paste();
 		if ((caretSticky == CaretSticky::Off) || (caretSticky == CaretSticky::WhiteSpace)) {
@@ -6535,6 +7319,10 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		PLATFORM_ASSERT(lParam);
 		return ReplaceTarget(ReplaceType::minimal, ViewFromParams(lParam, wParam));
 
+	case Message::ReloadText:
+		PLATFORM_ASSERT(lParam);
+		return pdoc->ReloadText(ViewFromParams(lParam, wParam));
+
 	case Message::SearchInTarget:
 		PLATFORM_ASSERT(lParam);
 		return SearchInTarget(ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
@@ -6709,10 +7497,54 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		return 0;
 
 	case Message::AppendText:
-		pdoc->InsertString(pdoc->Length(),
-			ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
+		if (logMode) {
+			AppendLog(ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
+		} else {
+			pdoc->InsertString(pdoc->Length(),
+				ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
+		}
 		return 0;
 
+	case Message::SetLogMode:
+		if ((wParam != 0) == logMode) {
+			break;
+		}
+		logMode = wParam != 0;
+		if (logMode) {
+			// Log text is not undone so do not keep any history for it
+			logUndoCollection = pdoc->IsCollectingUndo();
+			logChangeHistory = changeHistoryOption;
+			pdoc->SetUndoCollection(false);
+			pdoc->DeleteUndoHistory();
+			changeHistoryOption = ChangeHistoryOption::Disabled;
+			pdoc->ChangeHistorySet(false);
+		} else {
+			// History starts again from the text at the end of log mode
+			pdoc->SetUndoCollection(logUndoCollection);
+			changeHistoryOption = logChangeHistory;
+			pdoc->ChangeHistorySet(FlagSet(changeHistoryOption, ChangeHistoryOption::Enabled));
+		}
+		Redraw();
+		break;
+
+	case Message::GetLogMode:
+		return logMode;
+
+	case Message::SetLogLineLimit:
+		logLineLimit = std::max<Sci::Line>(LineFromUPtr(wParam), 0);
+		break;
+
+	case Message::GetLogLineLimit:
+		return logLineLimit;
+
+	case Message::CallBatch: {
+			const Batch *batch = static_cast<const Batch *>(PtrFromSPtr(lParam));
+			if (!batch || !batch->calls || (batch->length < 0)) {
+				return 0;
+			}
+			return CallBatch(*batch);
+		}
+
 	case Message::ClearAll:
 		ClearAll();
 		return 0;
@@ -7070,6 +7902,24 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->SetStyles(PositionFromUPtr(wParam), ConstCharPtrFromSPtr(lParam));
 		break;
 
+	case Message::SetSemanticTokenStyle:
+		if (wParam < 0x10000) {
+			if (semanticTokenStyles.size() <= wParam) {
+				semanticTokenStyles.resize(wParam + 1, -1);
+			}
+			semanticTokenStyles[wParam] = (lParam >= 0 && lParam <= static_cast<sptr_t>(StylesCommon::Max)) ? static_cast<int>(lParam) : -1;
+		}
+		break;
+
+	case Message::GetSemanticTokenStyle:
+		return (wParam < semanticTokenStyles.size()) ? semanticTokenStyles[wParam] : -1;
+
+	case Message::ApplySemanticTokens:
+		if (lParam == 0)
+			return 0;
+		return pdoc->ApplySemanticTokens(static_cast<const unsigned int *>(PtrFromSPtr(lParam)),
+			wParam, semanticTokenStyles);
+
 	case Message::SetBufferedDraw:
 		view.bufferedDraw = wParam != 0;
 		break;
@@ -7171,6 +8021,14 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetLineIndentPosition:
 		return pdoc->GetLineIndentPosition(LineFromUPtr(wParam));
 
+	case Message::NormalizeWhitespace: {
+			Sci::Line lineStart = 0;
+			Sci::Line lineEnd = 0;
+			LinesForOperation(lineStart, lineEnd);
+			pdoc->NormalizeWhitespace(lineStart, lineEnd, static_cast<Normalize>(wParam), static_cast<int>(lParam));
+		}
+		break;
+
 	case Message::SetTabIndents:
 		pdoc->tabIndents = wParam != 0;
 		break;
@@ -7310,6 +8168,21 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		LinesSplit(static_cast<int>(wParam));
 		break;
 
+	case Message::LineSort:
+		SortLines(static_cast<LineSort>(wParam));
+		break;
+
+	case Message::LineUnique:
+		UniqueLines();
+		break;
+
+	case Message::LineKeepMatching:
+	case Message::LineDropMatching:
+		PLATFORM_ASSERT(lParam);
+		FilterLines(ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam),
+			iMessage == Message::LineKeepMatching);
+		break;
+
 	case Message::TextWidth:
 		PLATFORM_ASSERT(wParam < vs.styles.size());
 		PLATFORM_ASSERT(lParam);
@@ -7441,6 +8314,112 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::IndexPositionFromLine:
 		return pdoc->IndexLineStart(LineFromUPtr(wParam), static_cast<LineCharacterIndexType>(lParam));
 
+	case Message::ConvertPositions: {
+			const PositionConversion *conversion = static_cast<PositionConversion *>(PtrFromSPtr(lParam));
+			if (!conversion || !conversion->positionsFrom || !conversion->positionsTo || conversion->count <= 0 ||
+				!ValidPositionUnit(conversion->unitsFrom) || !ValidPositionUnit(conversion->unitsTo)) {
+				return 0;
+			}
+			return pdoc->ConvertPositions(conversion->unitsFrom, conversion->unitsTo,
+				conversion->positionsFrom, conversion->positionsTo, conversion->count);
+		}
+
+	case Message::SetTextCountIndex:
+		pdoc->SetTextCountIndexed(wParam != 0);
+		break;
+
+	case Message::GetTextCountIndex:
+		return pdoc->TextCountIndexed();
+
+	case Message::GetTextStatistics: {
+			TextStatistics *statistics = static_cast<TextStatistics *>(PtrFromSPtr(lParam));
+			if (!statistics) {
+				return 0;
+			}
+			const Sci::Position length = pdoc->Length();
+			const Sci::Position start = std::clamp<Sci::Position>(statistics->chrg.cpMin, 0, length);
+			const Sci::Position end = (statistics->chrg.cpMax < 0) ? length :
+				std::clamp<Sci::Position>(statistics->chrg.cpMax, start, length);
+			const TextCounts counts = pdoc->CountText(start, end);
+			statistics->characters = counts.characters;
+			statistics->codeUnits = counts.codeUnits;
+			statistics->words = counts.words;
+			statistics->lines = pdoc->SciLineFromPosition(end) - pdoc->SciLineFromPosition(start) + 1;
+			return counts.characters;
+		}
+
+	case Message::SetContentHashIndex:
+		pdoc->SetContentHashIndexed(wParam != 0);
+		break;
+
+	case Message::GetContentHashIndex:
+		return pdoc->ContentHashIndexed();
+
+	case Message::GetContentHash: {
+			TextHash *textHash = static_cast<TextHash *>(PtrFromSPtr(lParam));
+			if (!textHash) {
+				return 0;
+			}
+			const Sci::Position length = pdoc->Length();
+			const Sci::Position start = std::clamp<Sci::Position>(textHash->chrg.cpMin, 0, length);
+			const Sci::Position end = (textHash->chrg.cpMax < 0) ? length :
+				std::clamp<Sci::Position>(textHash->chrg.cpMax, start, length);
+			textHash->hash = pdoc->ContentHash(start, end);
+			return end - start;
+		}
+
+	case Message::GetContentModified:
+		return pdoc->ContentModified();
+
+	case Message::DiffDocument: {
+			diff.reset();
+			Document *docOther = static_cast<Document *>(static_cast<IDocumentEditable *>(PtrFromSPtr(lParam)));
+			if (!docOther) {
+				return 0;
+			}
+			const DiffOption options = static_cast<DiffOption>(wParam);
+			diff = std::make_unique<DocumentDiff>(pdoc, docOther, FlagSet(options, DiffOption::Minimal),
+				!FlagSet(options, DiffOption::LinesOnly), diffTimeout / 1000.0);
+			return diff->hunks.size();
+		}
+
+	case Message::SetDiffTimeout:
+		diffTimeout = std::max(static_cast<int>(wParam), 0);
+		break;
+
+	case Message::GetDiffTimeout:
+		return diffTimeout;
+
+	case Message::DiffGetHunk: {
+			Hyperion::DiffHunk *diffHunk = static_cast<Hyperion::DiffHunk *>(PtrFromSPtr(lParam));
+			if (!diffHunk || !diff || (wParam >= diff->hunks.size())) {
+				return 0;
+			}
+			const Internal::DiffHunk &hunk = diff->hunks[wParam];
+			diffHunk->line = hunk.startA;
+			diffHunk->lines = hunk.lengthA;
+			diffHunk->lineOther = hunk.startB;
+			diffHunk->linesOther = hunk.lengthB;
+			return 1;
+		}
+
+	case Message::DiffAlignedLine:
+		return diff ? diff->AlignedLine(LineFromUPtr(wParam)) : -1;
+
+	case Message::DiffIndicate:
+		return DiffIndicate(static_cast<int>(wParam));
+
+	case Message::DiffPadAnnotations:
+		return DiffPadAnnotations(static_cast<int>(wParam));
+
+	case Message::SetElasticTabstops:
+		view.SetElasticTabstops(static_cast<int>(wParam));
+		InvalidateStyleRedraw();
+		break;
+
+	case Message::GetElasticTabstops:
+		return view.GetElasticTabstops();
+
 		// Marker definition and setting
 	case Message::MarkerDefine:
 		if (wParam <= MarkerMax) {
@@ -8360,6 +9339,23 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::BraceMatchNext:
 		return pdoc->BraceMatch(PositionFromUPtr(wParam), 0, lParam, true);
 
+	case Message::BraceEnclosing:
+		return pdoc->BraceEnclosing(PositionFromUPtr(wParam), static_cast<int>(lParam));
+
+	case Message::SetBraceIndex:
+		pdoc->SetBraceIndexed(wParam != 0);
+		break;
+
+	case Message::GetBraceIndex:
+		return pdoc->BraceIndexed();
+
+	case Message::SetWordIndex:
+		pdoc->SetWordIndexed(wParam != 0);
+		break;
+
+	case Message::GetWordIndex:
+		return pdoc->WordIndexed();
+
 	case Message::GetViewEOL:
 		return vs.viewEOL;
 
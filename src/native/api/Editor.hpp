@@ -8,6 +8,8 @@
 #pragma once
 namespace Hyperion::Internal {
 
+class DocumentDiff;
+
 /**
  */
 class Timer {
@@ -39,7 +41,8 @@ public:
 enum class WorkItems {
 	none = 0,
 	style = 1,
-	updateUI = 2
+	updateUI = 2,
+	appendLog = 4
 };
 
 class WorkNeeded {
@@ -77,8 +80,8 @@ public:
 		codePage = 0;
 		characterSet = Hyperion::CharacterSet::Ansi;
 	}
-	void Copy(const std::string &s_, int codePage_, Hyperion::CharacterSet characterSet_, bool rectangular_, bool lineCopy_) {
-		s = s_;
+	void Copy(std::string s_, int codePage_, Hyperion::CharacterSet characterSet_, bool rectangular_, bool lineCopy_) {
+		s = std::move(s_);
 		codePage = codePage_;
 		characterSet = characterSet_;
 		rectangular = rectangular_;
@@ -290,6 +293,23 @@ protected:	// HyperionBase subclass needs access to much of Editor
 
 	bool convertPastes;
 
+	/// Style for each semantic token type or -1 to leave tokens of that type unstyled.
+	std::vector<int> semanticTokenStyles;
+
+	/// Differences from the document most recently compared with by DiffDocument.
+	std::unique_ptr<DocumentDiff> diff;
+	int diffTimeout;	///< Milliseconds allowed for comparing lines, 0 for no limit
+	/// Lines given blank annotations by DiffPadAnnotations and their style, so only those are cleared.
+	std::vector<Sci::Line> diffPaddedLines;
+	int diffPadStyle;
+
+	/// In log mode text appended is held until the next frame and the oldest lines are trimmed.
+	bool logMode;
+	bool logUndoCollection;	///< Undo collection before log mode, restored when it ends
+	Hyperion::ChangeHistoryOption logChangeHistory;	///< Change history before log mode
+	Sci::Line logLineLimit;	///< Most lines kept in log mode, 0 for no limit
+	std::string logPending;	///< Text appended in log mode but not yet added to the document
+
 	Editor();
 	// Deleted so Editor objects can not be copied.
 	Editor(const Editor &) = delete;
@@ -412,6 +432,10 @@ protected:	// HyperionBase subclass needs access to much of Editor
 	bool WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToWrapEnd);
 	enum class WrapScope {wsAll, wsVisible, wsIdle};
 	bool WrapLines(WrapScope ws);
+	bool UpdateElasticTabstops();
+	void AppendLog(const char *text, Sci::Position length);
+	bool FlushLog();
+	static bool MessageUsesText(Hyperion::Message iMessage) noexcept;
 	void LinesJoin();
 	void LinesSplit(int pixelWidth);
 
@@ -496,7 +520,15 @@ protected:	// HyperionBase subclass needs access to much of Editor
 	void ChangeCaseOfSelection(CaseMapping caseMapping);
 	void LineDelete();
 	void LineTranspose();
+	template <typename Operation>
+	void RearrangeLines(Sci::Line lineStart, Sci::Line lineEnd, Operation operation);
+	void LinesForOperation(Sci::Line &lineStart, Sci::Line &lineEnd) const noexcept;
 	void LineReverse();
+	void SortLines(LineSort options);
+	void UniqueLines();
+	void FilterLines(const char *text, Sci::Position length, bool keep);
+	Sci::Position DiffIndicate(int indicator);
+	Sci::Line DiffPadAnnotations(int style);
 	void Duplicate(bool forLine);
 	virtual void CancelModes();
 	void NewLine();
@@ -531,6 +563,7 @@ protected:	// HyperionBase subclass needs access to much of Editor
 	std::string RangeText(Sci::Position start, Sci::Position end) const;
 	bool CopyLineRange(SelectionText *ss, bool allowProtected=true);
 	void CopySelectionRange(SelectionText *ss, bool allowLineCopy=false);
+	Sci::Position ExportSelectionRange(Hyperion::TextExport &textExport, bool allowLineCopy);
 	void CopyRangeToClipboard(Sci::Position start, Sci::Position end);
 	void CopyText(size_t length, const char *text);
 	void SetDragPosition(SelectionPosition newPos);
@@ -632,6 +665,8 @@ protected:	// HyperionBase subclass needs access to much of Editor
 	void SetSelectionNMessage(Hyperion::Message iMessage, Hyperion::uptr_t wParam, Hyperion::sptr_t lParam);
 	void SetSelectionMode(uptr_t wParam, bool setMoveExtends);
 
+	Sci::Position CallBatch(const Hyperion::Batch &batch);
+
 	// Coercion functions for transforming WndProc parameters into pointers
 	static void *PtrFromSPtr(Hyperion::sptr_t lParam) noexcept {
 		return reinterpret_cast<void *>(lParam);
@@ -371,6 +371,33 @@ void HyperionBase::AutoCompleteStart(Sci::Position lenEntered, const char *list)
 	}
 }
 
+// Words from the document starting with prefix as a list for the list box
+std::string HyperionBase::AutoCompleteDocumentWords(std::string_view prefix) {
+	const std::vector<std::string> words = pdoc->WordsWithPrefix(prefix, ac.wordRanking, sel.MainCaret(), ac.maxResults);
+	std::string list;
+	for (const std::string &word : words) {
+		if (!list.empty()) {
+			list += ac.GetSeparator();
+		}
+		list += word;
+	}
+	return list;
+}
+
+bool HyperionBase::AutoCompleteShowDocumentWords(Sci::Position lenEntered) {
+	const Sci::Position caret = sel.MainCaret();
+	const std::string list = AutoCompleteDocumentWords(RangeText(caret - lenEntered, caret));
+	if (list.empty()) {
+		return false;
+	}
+	// The list is in ranked order so it needs a sorted lookup table
+	const Ordering order = ac.autoSort;
+	ac.autoSort = Ordering::Custom;
+	AutoCompleteStart(lenEntered, list.c_str());
+	ac.autoSort = order;
+	return true;
+}
+
 void HyperionBase::AutoCompleteCancel() {
 	if (ac.Active()) {
 		NotificationData scn = {};
@@ -387,7 +414,9 @@ void HyperionBase::AutoCompleteMove(int delta) {
 }
 
 void HyperionBase::AutoCompleteMoveToCurrentWord() {
-	if (FlagSet(ac.options, AutoCompleteOption::SelectFirstItem))
+	// Filtered lists are rebuilt as the word changes
+	if (FlagSet(ac.options, AutoCompleteOption::SelectFirstItem) &&
+		!FlagSet(ac.options, AutoCompleteOption::Filter | AutoCompleteOption::Fuzzy))
 		return;
 	std::string wordCurrent = RangeText(ac.posStart - ac.startLen, sel.MainCaret());
 	ac.Select(wordCurrent.c_str());
@@ -838,6 +867,11 @@ void HyperionBase::NotifyStyleToNeeded(Sci::Position endStyleNeeded) {
 }
 
 sptr_t HyperionBase::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
+	// All messages arrive here first so add any text held back in log mode before one sees it
+	if (MessageUsesText(iMessage)) {
+		FlushLog();
+	}
+
 	switch (iMessage) {
 	case Message::AutoCShow:
 		listType = 0;
@@ -958,6 +992,29 @@ sptr_t HyperionBase::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::AutoCGetMaxHeight:
 		return ac.lb->GetVisibleRows();
 
+	case Message::AutoCSetMaxResults:
+		ac.maxResults = std::max(static_cast<int>(wParam), 1);
+		break;
+
+	case Message::AutoCGetMaxResults:
+		return ac.maxResults;
+
+	case Message::AutoCSetWordRanking:
+		ac.wordRanking = static_cast<WordRanking>(wParam);
+		break;
+
+	case Message::AutoCGetWordRanking:
+		return static_cast<sptr_t>(ac.wordRanking);
+
+	case Message::AutoCGetDocumentWords: {
+			// No prefix lists every word
+			const char *prefix = ConstCharPtrFromUPtr(wParam);
+			return StringResult(lParam, AutoCompleteDocumentWords(prefix ? prefix : "").c_str());
+		}
+
+	case Message::AutoCShowDocumentWords:
+		return AutoCompleteShowDocumentWords(PositionFromUPtr(wParam));
+
 	case Message::AutoCSetMaxWidth:
 		maxListWidth = static_cast<int>(wParam);
 		break;
@@ -76,6 +76,8 @@ protected:
 
 	void AutoCompleteInsert(Sci::Position startPos, Sci::Position removeLen, std::string_view text);
 	void AutoCompleteStart(Sci::Position lenEntered, const char *list);
+	std::string AutoCompleteDocumentWords(std::string_view prefix);
+	bool AutoCompleteShowDocumentWords(Sci::Position lenEntered);
 	void AutoCompleteCancel();
 	void AutoCompleteMove(int delta);
 	int AutoCompleteGetCurrent() const;
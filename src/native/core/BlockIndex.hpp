@@ -0,0 +1,291 @@
+// Hyperion source code edit control
+/** @file BlockIndex.hpp
+ ** Divide a document into blocks with a summary of each block so indexes over the text
+ ** only examine the blocks a change touches.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * A tree over a sequence of summaries that combines any range of them in logarithmic time.
+ * Combine must be associative with a default constructed Summary as its identity. It need
+ * not be commutative as ranges are combined in order.
+ */
+template <typename Summary, Summary (*Combine)(Summary, Summary) noexcept>
+class SummaryTree {
+	std::vector<Summary> nodes;	///< Leaves start at half the size
+	bool valid = false;
+
+public:
+	bool Valid() const noexcept {
+		return valid;
+	}
+	void Invalidate() noexcept {
+		valid = false;
+	}
+	size_t Leaves() const noexcept {
+		return nodes.size() / 2;
+	}
+	const Summary &Node(size_t node) const noexcept {
+		return nodes[node];
+	}
+
+	/// Build the tree over count summaries with summaryAt(index) returning each.
+	template <typename SummaryAt>
+	void Build(size_t count, SummaryAt summaryAt) {
+		size_t leaves = 1;
+		while (leaves < count) {
+			leaves *= 2;
+		}
+		nodes.assign(2 * leaves, Summary());
+		for (size_t index = 0; index < count; index++) {
+			nodes[leaves + index] = summaryAt(index);
+		}
+		for (size_t node = leaves - 1; node > 0; node--) {
+			nodes[node] = Combine(nodes[2 * node], nodes[2 * node + 1]);
+		}
+		valid = true;
+	}
+
+	/// Replace one summary and the nodes above it. Does nothing when the tree is to be built again.
+	void Update(size_t index, const Summary &summary) noexcept {
+		if (!valid) {
+			return;
+		}
+		size_t node = Leaves() + index;
+		nodes[node] = summary;
+		while (node > 1) {
+			node /= 2;
+			nodes[node] = Combine(nodes[2 * node], nodes[2 * node + 1]);
+		}
+	}
+
+	/// Combine the summaries from first up to but not including last.
+	Summary Sum(size_t first, size_t last) const noexcept {
+		// The left and right parts are kept separate so the summaries combine in order
+		Summary left;
+		Summary right;
+		const size_t leaves = Leaves();
+		for (first += leaves, last += leaves; first < last; first /= 2, last /= 2) {
+			if (first & 1) {
+				left = Combine(left, nodes[first++]);
+			}
+			if (last & 1) {
+				right = Combine(nodes[--last], right);
+			}
+		}
+		return Combine(left, right);
+	}
+};
+
+/**
+ * Divides a document into blocks, splitting a block when it grows past twice blockSize and
+ * merging blocks whose start is deleted into the block before. Owner chooses where blocks
+ * may start and is told of each change to the blocks through:
+ *   Sci::Position SplitPosition(Sci::Position position) - the first position at or after
+ *     position where a block may start
+ *   void BlocksInserted(Sci::Position block, Sci::Position count) - after block-1 was split
+ *   void BlocksRemoved(Sci::Position block, Sci::Position count)
+ *   void BlockChanged(Sci::Position block) - the text of block has changed
+ * Owner starts with a single empty block and inserts the initial text.
+ */
+template <typename Owner>
+class BlockPartitioning {
+	Owner &owner;
+	Partitioning<Sci::Position> blocks;
+	Sci::Position blockSize;
+
+	void Changed(Sci::Position block) {
+		const Sci::Position end = BlockStart(block + 1);
+		Sci::Position start = BlockStart(block);
+		Sci::Position added = 0;
+		while (end - start > 2 * blockSize) {
+			const Sci::Position split = owner.SplitPosition(start + blockSize);
+			if (split >= end) {
+				break;
+			}
+			added++;
+			blocks.InsertPartition(block + added, split);
+			start = split;
+		}
+		if (added > 0) {
+			owner.BlocksInserted(block + 1, added);
+		}
+		owner.BlockChanged(block);
+	}
+
+public:
+	BlockPartitioning(Owner &owner_, Sci::Position blockSize_) : owner(owner_), blocks(256), blockSize(blockSize_) {
+	}
+
+	Sci::Position Blocks() const noexcept {
+		return blocks.Partitions();
+	}
+	Sci::Position BlockStart(Sci::Position block) const noexcept {
+		return blocks.PositionFromPartition(block);
+	}
+	Sci::Position BlockFromPosition(Sci::Position position) const noexcept {
+		return blocks.PartitionFromPosition(position);
+	}
+
+	void InsertText(Sci::Position position, Sci::Position length) {
+		const Sci::Position block = blocks.PartitionFromPosition(position);
+		blocks.InsertText(block, length);
+		Changed(block);
+	}
+
+	void DeleteText(Sci::Position position, Sci::Position length) {
+		// The text before each remaining block start is not deleted so it is still a
+		// position where a block may start.
+		const Sci::Position block = blocks.PartitionFromPosition(position);
+		Sci::Position removed = 0;
+		while ((block + 1 < blocks.Partitions()) && (BlockStart(block + 1) <= position + length)) {
+			blocks.RemovePartition(block + 1);
+			removed++;
+		}
+		blocks.InsertText(block, -length);
+		if (removed > 0) {
+			owner.BlocksRemoved(block + 1, removed);
+		}
+		if ((block > 0) && (BlockStart(block + 1) == BlockStart(block))) {
+			// Deleted to the end of the document from the start of the last block
+			blocks.RemovePartition(block);
+			owner.BlocksRemoved(block, 1);
+		} else {
+			Changed(block);
+		}
+	}
+};
+
+/**
+ * Keeps a summary of each block, made by Owner when next needed after a change touches the
+ * block. When Combine is given, a tree of the summaries combines the summary of any range.
+ * Besides SplitPosition, Owner provides:
+ *   void Summarize(Sci::Position start, Sci::Position end, Summary &summary) - replace
+ *     summary with a summary of the text from start up to end
+ *   void Release(Summary &summary) - called before the summary of a block is dropped
+ */
+template <typename Owner, typename Summary, Summary (*Combine)(Summary, Summary) noexcept = nullptr>
+class BlockIndex {
+	struct Block {
+		Summary summary;
+		bool valid = false;
+	};
+	Owner &owner;
+	BlockPartitioning<BlockIndex> blocks;
+	std::vector<Block> entries;
+	SummaryTree<Summary, Combine> tree;
+	bool allValid = false;
+
+	friend BlockPartitioning<BlockIndex>;
+	Sci::Position SplitPosition(Sci::Position position) const {
+		return owner.SplitPosition(position);
+	}
+	void BlocksInserted(Sci::Position block, Sci::Position count) {
+		entries.insert(entries.begin() + block, count, Block());
+		allValid = false;
+		tree.Invalidate();
+	}
+	void BlocksRemoved(Sci::Position block, Sci::Position count) {
+		for (Sci::Position index = block; index < block + count; index++) {
+			owner.Release(entries[index].summary);
+		}
+		entries.erase(entries.begin() + block, entries.begin() + block + count);
+		tree.Invalidate();
+	}
+	void BlockChanged(Sci::Position block) noexcept {
+		entries[block].valid = false;
+		allValid = false;
+	}
+
+public:
+	BlockIndex(Owner &owner_, Sci::Position blockSize) : owner(owner_), blocks(*this, blockSize), entries(1) {
+	}
+
+	Sci::Position Blocks() const noexcept {
+		return blocks.Blocks();
+	}
+	Sci::Position BlockStart(Sci::Position block) const noexcept {
+		return blocks.BlockStart(block);
+	}
+	Sci::Position BlockFromPosition(Sci::Position position) const noexcept {
+		return blocks.BlockFromPosition(position);
+	}
+	/// The summary of block which is current after Validate.
+	const Summary &BlockSummary(Sci::Position block) const noexcept {
+		return entries[block].summary;
+	}
+
+	void InsertText(Sci::Position position, Sci::Position length) {
+		blocks.InsertText(position, length);
+	}
+	void DeleteText(Sci::Position position, Sci::Position length) {
+		blocks.DeleteText(position, length);
+	}
+	/// Summarize every block again when next needed.
+	void Invalidate() noexcept {
+		for (Block &entry : entries) {
+			entry.valid = false;
+		}
+		allValid = false;
+	}
+
+	/// Summarize the blocks changed since last validated and bring the tree up to date.
+	void Validate() {
+		if (!allValid) {
+			for (size_t block = 0; block < entries.size(); block++) {
+				Block &entry = entries[block];
+				if (!entry.valid) {
+					owner.Summarize(BlockStart(block), BlockStart(block + 1), entry.summary);
+					entry.valid = true;
+					if constexpr (Combine != nullptr) {
+						tree.Update(block, entry.summary);
+					}
+				}
+			}
+			allValid = true;
+		}
+		if constexpr (Combine != nullptr) {
+			if (!tree.Valid()) {
+				tree.Build(entries.size(), [this](size_t block) {
+					return entries[block].summary;
+				});
+			}
+		}
+	}
+
+	/// Summary of the text from start up to end. Parts of blocks at either end are
+	/// summarized directly and the whole blocks between are combined by the tree.
+	Summary Range(Sci::Position start, Sci::Position end) {
+		Validate();
+		const Sci::Position blockFirst = BlockFromPosition(start);
+		const Sci::Position blockLast = BlockFromPosition(end);
+		Summary summaryStart;
+		Sci::Position first = blockFirst;
+		if (start > BlockStart(blockFirst)) {
+			if (blockFirst == blockLast) {
+				owner.Summarize(start, end, summaryStart);
+				return summaryStart;
+			}
+			owner.Summarize(start, BlockStart(blockFirst + 1), summaryStart);
+			first++;
+		}
+		Summary summaryEnd;
+		Sci::Position last = blockLast;
+		if (end == BlockStart(blockLast + 1)) {
+			// Only at the end of the document
+			last++;
+		} else if (end > BlockStart(blockLast)) {
+			owner.Summarize(BlockStart(blockLast), end, summaryEnd);
+		}
+		if (first < last) {
+			summaryStart = Combine(summaryStart, tree.Sum(first, last));
+		}
+		return Combine(summaryStart, summaryEnd);
+	}
+};
+
+}
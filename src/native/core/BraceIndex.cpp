@@ -0,0 +1,343 @@
+// Hyperion source code edit control
+/** @file BraceIndex.cpp
+ ** Summarize brace depth over blocks of a document so matching braces can be found
+ ** without examining all the text between them.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../platform/Position.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "CellBuffer.hpp"
+#include "BlockIndex.hpp"
+#include "BraceIndex.hpp"
+
+using namespace Hyperion::Internal;
+
+namespace {
+
+// Braces are summarized over blocks of about this size.
+constexpr Sci::Position blockSize = 0x2000;
+
+// Summaries are kept for this many brace pair and style combinations, the least recently
+// searched being dropped when another is needed.
+constexpr size_t maximumPairs = 8;
+
+// Depth returns to zero inside a range entered at depth when moving forward.
+constexpr bool ReachesZeroForward(BraceIndex::Summary summary, Sci::Position depth) noexcept {
+	return depth + summary.minPrefix <= 0;
+}
+
+// Moving backward, closing braces increase depth so the lowest depth reached is after
+// the suffix with the greatest net which is net - minPrefix.
+constexpr bool ReachesZeroBackward(BraceIndex::Summary summary, Sci::Position depth) noexcept {
+	return depth - (summary.net - summary.minPrefix) <= 0;
+}
+
+// Call f for each contiguous piece of [start, end) in view.
+template <typename Function>
+void ForEachSegment(const SplitView &view, size_t start, size_t end, Function f) {
+	if (start < view.length1) {
+		const size_t endFirst = std::min(end, view.length1);
+		f(view.segment1, start, endFirst);
+		start = endFirst;
+	}
+	if (start < end) {
+		f(view.segment2, start, end);
+	}
+}
+
+}
+
+BraceIndex::BraceIndex(const CellBuffer *pcb_) : pcb(pcb_), blocks(*this, blockSize) {
+	blocks.InsertText(0, pcb->Length());
+}
+
+BraceIndex::Summary BraceIndex::Combine(Summary a, Summary b) noexcept {
+	return { a.net + b.net, std::min(a.minPrefix, a.net + b.minPrefix) };
+}
+
+Sci::Position BraceIndex::BlockStart(Sci::Position block) const noexcept {
+	return blocks.BlockStart(block);
+}
+
+Sci::Position BraceIndex::SplitPosition(Sci::Position position) const noexcept {
+	return position;
+}
+
+void BraceIndex::BlocksInserted(Sci::Position block, Sci::Position count) {
+	for (PairIndex &pair : pairs) {
+		pair.summaries.insert(pair.summaries.begin() + block, count, Summary());
+		for (Sci::Position piece = block; piece < block + count; piece++) {
+			pair.summaries[piece] = Summarize(pair, piece);
+		}
+		pair.tree.Invalidate();
+	}
+}
+
+void BraceIndex::BlocksRemoved(Sci::Position block, Sci::Position count) {
+	for (PairIndex &pair : pairs) {
+		pair.summaries.erase(pair.summaries.begin() + block, pair.summaries.begin() + block + count);
+		pair.tree.Invalidate();
+	}
+}
+
+void BraceIndex::BlockChanged(Sci::Position block) noexcept {
+	for (PairIndex &pair : pairs) {
+		const Summary summary = Summarize(pair, block);
+		pair.summaries[block] = summary;
+		pair.tree.Update(block, summary);
+	}
+}
+
+BraceIndex::Summary BraceIndex::Summarize(const PairIndex &pair, Sci::Position block) const noexcept {
+	Summary summary;
+	const SplitView view = pcb->AllView();
+	const char open = pair.open;
+	const char close = pair.close;
+	ForEachSegment(view, BlockStart(block), BlockStart(block + 1), [&](const char *segment, size_t start, size_t end) {
+		for (size_t position = start; position < end; position++) {
+			const char ch = segment[position];
+			if ((ch == open || ch == close) &&
+				((pair.style < 0) || (static_cast<unsigned char>(pcb->StyleAt(position)) == pair.style))) {
+				summary.net += (ch == open) ? 1 : -1;
+				summary.minPrefix = std::min(summary.minPrefix, summary.net);
+			}
+		}
+	});
+	return summary;
+}
+
+void BraceIndex::BuildTree(PairIndex &pair) {
+	pair.tree.Build(pair.summaries.size(), [&pair](size_t block) noexcept {
+		return pair.summaries[block];
+	});
+}
+
+BraceIndex::PairIndex &BraceIndex::Pair(char open, char close, int style) {
+	useClock++;
+	for (PairIndex &pair : pairs) {
+		if (pair.open == open && pair.close == close && pair.style == style) {
+			pair.lastUse = useClock;
+			return pair;
+		}
+	}
+	if (pairs.size() >= maximumPairs) {
+		pairs.erase(std::min_element(pairs.begin(), pairs.end(), [](const PairIndex &a, const PairIndex &b) noexcept {
+			return a.lastUse < b.lastUse;
+		}));
+	}
+	PairIndex &pair = pairs.emplace_back();
+	pair.open = open;
+	pair.close = close;
+	pair.style = style;
+	pair.lastUse = useClock;
+	const Sci::Position blockCount = blocks.Blocks();
+	pair.summaries.resize(blockCount);
+	for (Sci::Position block = 0; block < blockCount; block++) {
+		pair.summaries[block] = Summarize(pair, block);
+	}
+	return pair;
+}
+
+void BraceIndex::InsertText(Sci::Position position, Sci::Position length) {
+	blocks.InsertText(position, length);
+}
+
+void BraceIndex::DeleteText(Sci::Position position, Sci::Position length) {
+	blocks.DeleteText(position, length);
+}
+
+void BraceIndex::StylesChanged(Sci::Position position, Sci::Position length) {
+	if (pairs.empty() || (length <= 0)) {
+		return;
+	}
+	const Sci::Position blockLast = blocks.BlockFromPosition(position + length - 1);
+	for (Sci::Position block = blocks.BlockFromPosition(position); block <= blockLast; block++) {
+		BlockChanged(block);
+	}
+}
+
+bool BraceIndex::Counts(const PairIndex &pair, Sci::Position position, Sci::Position endStyled) const noexcept {
+	return (pair.style < 0) || (position > endStyled) ||
+		(static_cast<unsigned char>(pcb->StyleAt(position)) == pair.style);
+}
+
+// Examine positions from start up to but not including end, which is before start when
+// moving backward. Returns the position where depth reaches 0 or -1.
+Sci::Position BraceIndex::Scan(const PairIndex &pair, Sci::Position start, Sci::Position end, int direction,
+	Sci::Position endStyled, Sci::Position &depth) const noexcept {
+	const char chBrace = (direction > 0) ? pair.open : pair.close;
+	const char chSeek = (direction > 0) ? pair.close : pair.open;
+	for (Sci::Position position = start; position != end; position += direction) {
+		const char ch = pcb->CharAt(position);
+		if ((ch == chBrace || ch == chSeek) && Counts(pair, position, endStyled)) {
+			depth += (ch == chBrace) ? 1 : -1;
+			if (depth == 0) {
+				return position;
+			}
+		}
+	}
+	return -1;
+}
+
+// Find the first block in [first, last) where depth reaches zero, adding the net change of
+// each block passed over to depth.
+Sci::Position BraceIndex::FindBlockForward(const PairIndex &pair, size_t node, size_t nodeFirst, size_t nodeLast,
+	size_t first, size_t last, Sci::Position &depth) const noexcept {
+	if ((nodeLast <= first) || (nodeFirst >= last)) {
+		return -1;
+	}
+	const Summary &summary = pair.tree.Node(node);
+	if ((first <= nodeFirst) && (nodeLast <= last)) {
+		if (!ReachesZeroForward(summary, depth)) {
+			depth += summary.net;
+			return -1;
+		}
+		if (nodeLast - nodeFirst == 1) {
+			return nodeFirst;
+		}
+	}
+	const size_t nodeMiddle = (nodeFirst + nodeLast) / 2;
+	const Sci::Position found = FindBlockForward(pair, 2 * node, nodeFirst, nodeMiddle, first, last, depth);
+	if (found >= 0) {
+		return found;
+	}
+	return FindBlockForward(pair, 2 * node + 1, nodeMiddle, nodeLast, first, last, depth);
+}
+
+// Find the last block in [first, last) where depth reaches zero moving backward.
+Sci::Position BraceIndex::FindBlockBackward(const PairIndex &pair, size_t node, size_t nodeFirst, size_t nodeLast,
+	size_t first, size_t last, Sci::Position &depth) const noexcept {
+	if ((nodeLast <= first) || (nodeFirst >= last)) {
+		return -1;
+	}
+	const Summary &summary = pair.tree.Node(node);
+	if ((first <= nodeFirst) && (nodeLast <= last)) {
+		if (!ReachesZeroBackward(summary, depth)) {
+			depth -= summary.net;
+			return -1;
+		}
+		if (nodeLast - nodeFirst == 1) {
+			return nodeFirst;
+		}
+	}
+	const size_t nodeMiddle = (nodeFirst + nodeLast) / 2;
+	const Sci::Position found = FindBlockBackward(pair, 2 * node + 1, nodeMiddle, nodeLast, first, last, depth);
+	if (found >= 0) {
+		return found;
+	}
+	return FindBlockBackward(pair, 2 * node, nodeFirst, nodeMiddle, first, last, depth);
+}
+
+Sci::Position BraceIndex::Find(char chBrace, char chSeek, int style, int direction,
+	Sci::Position start, Sci::Position endStyled) {
+	const Sci::Position length = pcb->Length();
+	if ((start < 0) || (start >= length)) {
+		return -1;
+	}
+	const char open = (direction > 0) ? chBrace : chSeek;
+	const char close = (direction > 0) ? chSeek : chBrace;
+	// Every brace after endStyled counts so blocks there use the summaries for any style.
+	// Fetched first so it is not the least recently used when the styled pair is added.
+	Pair(open, close, -1);
+	PairIndex &pairStyled = Pair(open, close, style);
+	PairIndex &pairAny = Pair(open, close, -1);
+	for (PairIndex *pair : { &pairStyled, &pairAny }) {
+		if (!pair->tree.Valid()) {
+			BuildTree(*pair);
+		}
+	}
+
+	// Blocks before blocksStyled end before endStyled, blocks from blockUnstyled start after it
+	// and the block between, if any, is scanned.
+	const Sci::Position blocksAll = blocks.Blocks();
+	Sci::Position blocksStyled = blocksAll;
+	Sci::Position blockUnstyled = blocksAll;
+	if ((style >= 0) && (endStyled < length)) {
+		blocksStyled = blocks.BlockFromPosition(endStyled);
+		blockUnstyled = blocksStyled + 1;
+	}
+	struct Zone {
+		const PairIndex *pair;
+		Sci::Position first;
+		Sci::Position last;
+	};
+	const Zone zones[] = {
+		{ &pairStyled, 0, blocksStyled },
+		{ nullptr, blocksStyled, blockUnstyled },
+		{ &pairAny, blockUnstyled, blocksAll },
+	};
+	const size_t leaves = pairStyled.tree.Leaves();
+	const Sci::Position block = blocks.BlockFromPosition(start);
+	Sci::Position depth = 1;
+
+	if (direction > 0) {
+		const Sci::Position found = Scan(pairStyled, start, BlockStart(block + 1), direction, endStyled, depth);
+		if (found >= 0) {
+			return found;
+		}
+		for (const Zone &zone : zones) {
+			const Sci::Position first = std::max(zone.first, block + 1);
+			if (first >= zone.last) {
+				continue;
+			}
+			if (!zone.pair) {
+				const Sci::Position foundScan = Scan(pairStyled, BlockStart(first), BlockStart(zone.last), direction, endStyled, depth);
+				if (foundScan >= 0) {
+					return foundScan;
+				}
+				continue;
+			}
+			const Sci::Position blockFound = FindBlockForward(*zone.pair, 1, 0, leaves,
+				static_cast<size_t>(first), static_cast<size_t>(zone.last), depth);
+			if (blockFound >= 0) {
+				return Scan(pairStyled, BlockStart(blockFound), BlockStart(blockFound + 1), direction, endStyled, depth);
+			}
+		}
+		return -1;
+	}
+
+	const Sci::Position found = Scan(pairStyled, start, BlockStart(block) - 1, direction, endStyled, depth);
+	if (found >= 0) {
+		return found;
+	}
+	for (auto it = std::rbegin(zones); it != std::rend(zones); ++it) {
+		const Zone &zone = *it;
+		const Sci::Position last = std::min(zone.last, block);
+		if (zone.first >= last) {
+			continue;
+		}
+		if (!zone.pair) {
+			const Sci::Position foundScan = Scan(pairStyled, BlockStart(last) - 1, BlockStart(zone.first) - 1, direction, endStyled, depth);
+			if (foundScan >= 0) {
+				return foundScan;
+			}
+			continue;
+		}
+		const Sci::Position blockFound = FindBlockBackward(*zone.pair, 1, 0, leaves,
+			static_cast<size_t>(zone.first), static_cast<size_t>(last), depth);
+		if (blockFound >= 0) {
+			return Scan(pairStyled, BlockStart(blockFound + 1) - 1, BlockStart(blockFound) - 1, direction, endStyled, depth);
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,71 @@
+// Hyperion source code edit control
+/** @file BraceIndex.hpp
+ ** Summarize brace depth over blocks of a document so matching braces can be found
+ ** without examining all the text between them.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Splits the document into blocks and, for each brace pair and style that has been
+ * searched for, keeps the change in depth over each block and the lowest depth reached
+ * inside it. A tree of these summaries finds the block where depth returns to zero in
+ * logarithmic time and only that block is scanned.
+ * Braces after the end of styling count whatever their style so blocks there use the
+ * summaries kept for any style.
+ */
+class BraceIndex {
+public:
+	struct Summary {
+		Sci::Position net = 0;	///< Opening minus closing braces
+		Sci::Position minPrefix = 0;	///< Lowest value of net over the prefixes of the range
+	};
+	static Summary Combine(Summary a, Summary b) noexcept;
+private:
+	struct PairIndex {
+		char open = 0;
+		char close = 0;
+		int style = 0;	///< Only braces with this style count, all braces when negative
+		size_t lastUse = 0;
+		std::vector<Summary> summaries;	///< One for each block
+		SummaryTree<Summary, Combine> tree;
+	};
+	const CellBuffer *pcb;
+	BlockPartitioning<BraceIndex> blocks;
+	std::vector<PairIndex> pairs;
+	size_t useClock = 0;
+
+	friend BlockPartitioning<BraceIndex>;
+	Sci::Position BlockStart(Sci::Position block) const noexcept;
+	Sci::Position SplitPosition(Sci::Position position) const noexcept;
+	void BlocksInserted(Sci::Position block, Sci::Position count);
+	void BlocksRemoved(Sci::Position block, Sci::Position count);
+	void BlockChanged(Sci::Position block) noexcept;
+	Summary Summarize(const PairIndex &pair, Sci::Position block) const noexcept;
+	void BuildTree(PairIndex &pair);
+	PairIndex &Pair(char open, char close, int style);
+	bool Counts(const PairIndex &pair, Sci::Position position, Sci::Position endStyled) const noexcept;
+	Sci::Position Scan(const PairIndex &pair, Sci::Position start, Sci::Position end, int direction,
+		Sci::Position endStyled, Sci::Position &depth) const noexcept;
+	Sci::Position FindBlockForward(const PairIndex &pair, size_t node, size_t nodeFirst, size_t nodeLast,
+		size_t first, size_t last, Sci::Position &depth) const noexcept;
+	Sci::Position FindBlockBackward(const PairIndex &pair, size_t node, size_t nodeFirst, size_t nodeLast,
+		size_t first, size_t last, Sci::Position &depth) const noexcept;
+
+public:
+	explicit BraceIndex(const CellBuffer *pcb_);
+
+	void InsertText(Sci::Position position, Sci::Position length);
+	void DeleteText(Sci::Position position, Sci::Position length);
+	void StylesChanged(Sci::Position position, Sci::Position length);
+
+	/// Find the chSeek that balances chBrace, starting at start and moving in direction.
+	/// Braces count when they have style (any style when negative) or are after endStyled.
+	Sci::Position Find(char chBrace, char chSeek, int style, int direction,
+		Sci::Position start, Sci::Position endStyled);
+};
+
+}
@@ -23,12 +23,19 @@
 #include <algorithm>
 #include <memory>
 
+#include "../platform/CpuFeatures.hpp"
+
+#if defined(HYPERION_SSE2)
+#include <emmintrin.h>
+#endif
+
 #include "../include/HyperionTypes.hpp"
 #include "../platform/Debugging.hpp"
 #include "../platform/Position.hpp"
 #include "../platform/SparseVector.hpp"
 #include "../api/ChangeHistory.hpp"
 #include "../syntax/UniConversion.hpp"
+#include "../syntax/UTF8Scan.hpp"
 
 #include "SplitVector.hpp"
 #include "Partitioning.hpp"
@@ -419,6 +426,73 @@ SplitView CellBuffer::AllView() const noexcept {
 	};
 }
 
+namespace {
+
+// Copy styles over target where they differ and extend [changeStart, changeEnd) to cover the
+// changed elements, with offset added to indices.
+void CopyChangedStyles(char *target, const char *styles, ptrdiff_t length, Sci::Position offset,
+	Sci::Position &changeStart, Sci::Position &changeEnd) noexcept {
+	ptrdiff_t i = 0;
+#if defined(HYPERION_SSE2)
+	// Compare 16 bytes at a time and store whole blocks that differ
+	for (; i + 16 <= length; i += 16) {
+		const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(target + i));
+		const __m128i wanted = _mm_loadu_si128(reinterpret_cast<const __m128i *>(styles + i));
+		unsigned int differ = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(current, wanted))) & 0xffffU;
+		if (differ) {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(target + i), wanted);
+			ptrdiff_t first = 0;
+			while (!(differ & 1U)) {
+				differ >>= 1;
+				first++;
+			}
+			ptrdiff_t last = first;
+			for (; differ; differ >>= 1) {
+				last++;
+			}
+			changeStart = std::min(changeStart, offset + i + first);
+			changeEnd = std::max(changeEnd, offset + i + last);
+		}
+	}
+#endif
+	for (; i < length; i++) {
+		if (target[i] != styles[i]) {
+			target[i] = styles[i];
+			changeStart = std::min(changeStart, offset + i);
+			changeEnd = std::max(changeEnd, offset + i + 1);
+		}
+	}
+}
+
+}
+
+bool CellBuffer::SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles,
+	Sci::Position &changeStart, Sci::Position &changeEnd) noexcept {
+	changeStart = Sci::invalidPosition;
+	changeEnd = Sci::invalidPosition;
+	if (!hasStyles || position < 0) {
+		return false;
+	}
+	lengthStyle = std::min(lengthStyle, style.Length() - position);
+	Sci::Position start = position + lengthStyle;
+	Sci::Position end = position;
+	// The style buffer is split by its gap so compare each contiguous segment
+	Sci::Position done = 0;
+	while (done < lengthStyle) {
+		ptrdiff_t contiguousLength = 0;
+		char *target = style.SegmentPointer(position + done, contiguousLength);
+		const ptrdiff_t segment = std::min<ptrdiff_t>(contiguousLength, lengthStyle - done);
+		CopyChangedStyles(target, styles + done, segment, position + done, start, end);
+		done += segment;
+	}
+	if (start >= end) {
+		return false;
+	}
+	changeStart = start;
+	changeEnd = end;
+	return true;
+}
+
 // The char* returned is to an allocation owned by the undo history
 const char *CellBuffer::InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
@@ -749,13 +823,18 @@ namespace {
 
 CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
 	CountWidths cw;
-	size_t remaining = sv.length();
-	while (remaining > 0) {
-		const int utf8Status = UTF8Classify(sv);
-		const int lenChar = utf8Status & UTF8MaskWidth;
-		cw.CountChar(lenChar);
-		sv.remove_prefix(lenChar);
-		remaining -= lenChar;
+	while (!sv.empty()) {
+		const size_t lengthValid = UTF8ValidPrefix(sv);
+		const UTF8Counts counts = UTF8CountValid(sv.substr(0, lengthValid));
+		cw.countBasePlane += static_cast<Sci::Position>(counts.characters - counts.otherPlanes);
+		cw.countOtherPlanes += static_cast<Sci::Position>(counts.otherPlanes);
+		sv.remove_prefix(lengthValid);
+		if (!sv.empty()) {
+			const int utf8Status = UTF8Classify(sv);
+			const int lenChar = utf8Status & UTF8MaskWidth;
+			cw.CountChar(lenChar);
+			sv.remove_prefix(lenChar);
+		}
 	}
 	return cw;
 }
@@ -142,6 +142,9 @@ public:
 	/// @return true if the style of a character is changed.
 	bool SetStyleAt(Sci::Position position, char styleValue) noexcept;
 	bool SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) noexcept;
+	/// Write only the styles that differ, returning the changed range through changeStart and changeEnd.
+	bool SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles,
+		Sci::Position &changeStart, Sci::Position &changeEnd) noexcept;
 
 	const char *DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence);
 
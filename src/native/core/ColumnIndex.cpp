@@ -0,0 +1,159 @@
+// Hyperion source code edit control
+/** @file ColumnIndex.cpp
+ ** Remember the column reached at points along long lines so columns can be found
+ ** without scanning from the start of the line.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/ILoader.hpp"
+#include "../include/ILexer.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../syntax/CharacterCategoryMap.hpp"
+#include "../platform/Position.hpp"
+#include "../syntax/CharClassify.hpp"
+#include "../view/Decoration.hpp"
+#include "../syntax/CaseFolder.hpp"
+#include "../syntax/UniConversion.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "RunStyles.hpp"
+#include "CellBuffer.hpp"
+#include "Document.hpp"
+#include "ColumnIndex.hpp"
+
+using namespace Hyperion::Internal;
+
+namespace {
+
+// Bytes between checkpoints so a lookup scans no further than this.
+constexpr Sci::Position checkpointInterval = 0x400;
+
+// Checkpoints are kept for this many lines with the least recently used line dropped.
+constexpr size_t linesKept = 16;
+
+}
+
+ColumnIndex::ColumnIndex(const Document *pdoc_) :
+	pdoc(pdoc_), tabInChars(pdoc_->tabInChars), codePage(pdoc_->dbcsCodePage) {
+}
+
+ColumnIndex::LineCheckpoints &ColumnIndex::Checkpoints(Sci::Line line) {
+	// Tab size and encoding are public settings of Document so are checked on each use
+	if ((tabInChars != pdoc->tabInChars) || (codePage != pdoc->dbcsCodePage)) {
+		tabInChars = pdoc->tabInChars;
+		codePage = pdoc->dbcsCodePage;
+		lines.clear();
+	}
+	useClock++;
+	for (LineCheckpoints &lc : lines) {
+		if (lc.line == line) {
+			lc.lastUse = useClock;
+			return lc;
+		}
+	}
+	if (lines.size() >= linesKept) {
+		lines.erase(std::min_element(lines.begin(), lines.end(), [](const LineCheckpoints &a, const LineCheckpoints &b) noexcept {
+			return a.lastUse < b.lastUse;
+		}));
+	}
+	LineCheckpoints &lc = lines.emplace_back();
+	lc.line = line;
+	lc.lastUse = useClock;
+	lc.checkpoints.push_back({});
+	return lc;
+}
+
+// Scan one interval past the last checkpoint in the same way as Document::GetColumn,
+// returning false once the end of the line is reached.
+bool ColumnIndex::Extend(LineCheckpoints &lc, Sci::Position lineStart) {
+	if (lc.complete) {
+		return false;
+	}
+	const Checkpoint last = lc.checkpoints.back();
+	const Sci::Position length = pdoc->Length();
+	Sci::Position position = lineStart + last.position;
+	Sci::Position column = last.column;
+	const Sci::Position end = position + checkpointInterval;
+	while (position < end) {
+		const char ch = (position < length) ? pdoc->CharAt(position) : '\n';
+		if ((ch == '\r') || (ch == '\n')) {
+			lc.complete = true;
+			return false;
+		}
+		if (ch == '\t') {
+			column = ((column / tabInChars) + 1) * tabInChars;
+			position++;
+		} else if (UTF8IsAscii(ch)) {
+			column++;
+			position++;
+		} else {
+			column++;
+			position = pdoc->NextPosition(position, 1);
+		}
+	}
+	lc.checkpoints.push_back({ position - lineStart, column });
+	return true;
+}
+
+void ColumnIndex::TextChanged(Sci::Line line, Sci::Position offset, Sci::Line linesAdded) {
+	const Sci::Line lastChanged = line - std::min<Sci::Line>(linesAdded, 0);
+	lines.erase(std::remove_if(lines.begin(), lines.end(), [line, lastChanged](const LineCheckpoints &lc) noexcept {
+		return (lc.line > line) && (lc.line <= lastChanged);
+	}), lines.end());
+	for (LineCheckpoints &lc : lines) {
+		if (lc.line == line) {
+			// Drop checkpoints at or after offset but keep the line start
+			const auto it = std::lower_bound(lc.checkpoints.begin() + 1, lc.checkpoints.end(), offset,
+				[](const Checkpoint &checkpoint, Sci::Position offsetFind) noexcept {
+				return checkpoint.position < offsetFind;
+			});
+			lc.checkpoints.erase(it, lc.checkpoints.end());
+			lc.complete = false;
+		} else if (lc.line > line) {
+			lc.line += linesAdded;
+		}
+	}
+}
+
+ColumnIndex::Checkpoint ColumnIndex::BeforePosition(Sci::Line line, Sci::Position position) {
+	LineCheckpoints &lc = Checkpoints(line);
+	const Sci::Position lineStart = pdoc->LineStart(line);
+	const Sci::Position offset = position - lineStart;
+	while ((lc.checkpoints.back().position + checkpointInterval <= offset) && Extend(lc, lineStart)) {
+	}
+	const auto it = std::upper_bound(lc.checkpoints.begin(), lc.checkpoints.end(), offset,
+		[](Sci::Position offsetFind, const Checkpoint &checkpoint) noexcept {
+		return offsetFind < checkpoint.position;
+	});
+	return { lineStart + (it - 1)->position, (it - 1)->column };
+}
+
+ColumnIndex::Checkpoint ColumnIndex::BeforeColumn(Sci::Line line, Sci::Position column) {
+	LineCheckpoints &lc = Checkpoints(line);
+	const Sci::Position lineStart = pdoc->LineStart(line);
+	while ((lc.checkpoints.back().column <= column) && Extend(lc, lineStart)) {
+	}
+	const auto it = std::upper_bound(lc.checkpoints.begin(), lc.checkpoints.end(), column,
+		[](Sci::Position columnFind, const Checkpoint &checkpoint) noexcept {
+		return columnFind < checkpoint.column;
+	});
+	return { lineStart + (it - 1)->position, (it - 1)->column };
+}
@@ -0,0 +1,54 @@
+// Hyperion source code edit control
+/** @file ColumnIndex.hpp
+ ** Remember the column reached at points along long lines so columns can be found
+ ** without scanning from the start of the line.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Keeps checkpoints of the position and column at intervals along a few recently used
+ * long lines. Finding the column of a position, or the position of a column, scans from
+ * the nearest checkpoint so costs at most one interval after a binary search.
+ * Checkpoints are relative to the line start and are only made as far along the line as
+ * has been asked for. Changes to a line discard its checkpoints at or after the change.
+ */
+class ColumnIndex {
+public:
+	struct Checkpoint {
+		Sci::Position position = 0;
+		Sci::Position column = 0;
+	};
+private:
+	struct LineCheckpoints {
+		Sci::Line line = 0;
+		size_t lastUse = 0;
+		bool complete = false;	///< Checkpoints have reached the end of the line
+		std::vector<Checkpoint> checkpoints;	///< The first is the line start
+	};
+	const Document *pdoc;
+	int tabInChars;
+	int codePage;
+	std::vector<LineCheckpoints> lines;
+	size_t useClock = 0;
+
+	LineCheckpoints &Checkpoints(Sci::Line line);
+	bool Extend(LineCheckpoints &lc, Sci::Position lineStart);
+
+public:
+	explicit ColumnIndex(const Document *pdoc_);
+
+	/// Text was inserted or deleted at offset into line, adding linesAdded lines which is
+	/// negative for deletions. Checkpoints before offset stay as they only depend on earlier text.
+	void TextChanged(Sci::Line line, Sci::Position offset, Sci::Line linesAdded);
+
+	/// The last checkpoint of line at or before position.
+	Checkpoint BeforePosition(Sci::Line line, Sci::Position position);
+	/// The last checkpoint of line at or before column.
+	Checkpoint BeforeColumn(Sci::Line line, Sci::Position column);
+};
+
+}
@@ -0,0 +1,138 @@
+// Hyperion source code edit control
+/** @file ContentHashIndex.cpp
+ ** Hash the text of a document over blocks so changes only rehash the blocks they touch.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../platform/Position.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "CellBuffer.hpp"
+#include "BlockIndex.hpp"
+#include "ContentHashIndex.hpp"
+
+using namespace Hyperion::Internal;
+
+namespace {
+
+// Text is hashed in blocks of about this size.
+constexpr Sci::Position blockSize = 0x4000;
+
+constexpr uint64_t modulus = (1ULL << 61) - 1;
+constexpr uint64_t base = 0x1f3d5b79a2c4e6f1ULL % modulus;
+
+// Multiply modulo 2^61-1 without a 128 bit type by splitting into 32 bit halves.
+constexpr uint64_t MulMod(uint64_t a, uint64_t b) noexcept {
+	const uint64_t aLow = a & 0xffffffffU;
+	const uint64_t aHigh = a >> 32;
+	const uint64_t bLow = b & 0xffffffffU;
+	const uint64_t bHigh = b >> 32;
+	const uint64_t low = aLow * bLow;
+	const uint64_t middle = aLow * bHigh + aHigh * bLow;
+	const uint64_t high = aHigh * bHigh;
+	uint64_t result = (low & modulus) + (low >> 61) + (high << 3) + (middle >> 29) + ((middle << 35) >> 3) + 1;
+	result = (result & modulus) + (result >> 61);
+	result = (result & modulus) + (result >> 61);
+	return result - 1;
+}
+
+constexpr uint64_t AddMod(uint64_t a, uint64_t b) noexcept {
+	const uint64_t sum = a + b;
+	return (sum >= modulus) ? sum - modulus : sum;
+}
+
+constexpr uint64_t PowMod(uint64_t value, uint64_t exponent) noexcept {
+	uint64_t result = 1;
+	for (; exponent; exponent >>= 1) {
+		if (exponent & 1) {
+			result = MulMod(result, value);
+		}
+		value = MulMod(value, value);
+	}
+	return result;
+}
+
+// Horner's rule over the bytes, adding 1 to each so leading NULs change the hash.
+uint64_t HashBytes(uint64_t value, const char *bytes, size_t length) noexcept {
+	for (size_t i = 0; i < length; i++) {
+		value = AddMod(MulMod(value, base), static_cast<unsigned char>(bytes[i]) + 1U);
+	}
+	return value;
+}
+
+}
+
+ContentHashIndex::Hash ContentHashIndex::Combine(Hash a, Hash b) noexcept {
+	return { AddMod(MulMod(a.value, b.power), b.value), MulMod(a.power, b.power) };
+}
+
+ContentHashIndex::Hash ContentHashIndex::HashText(const CellBuffer *pcb, Sci::Position start, Sci::Position end) noexcept {
+	Hash hash;
+	if (start >= end) {
+		return hash;
+	}
+	const SplitView view = pcb->AllView();
+	const size_t first = start;
+	const size_t last = end;
+	if (first < view.length1) {
+		const size_t lastFirstSegment = std::min(last, view.length1);
+		hash.value = HashBytes(hash.value, view.segment1 + first, lastFirstSegment - first);
+	}
+	if (last > view.length1) {
+		const size_t firstSecondSegment = std::max(first, view.length1);
+		hash.value = HashBytes(hash.value, view.segment2 + firstSecondSegment, last - firstSecondSegment);
+	}
+	hash.power = PowMod(base, end - start);
+	return hash;
+}
+
+ContentHashIndex::ContentHashIndex(const CellBuffer *pcb_) : pcb(pcb_), index(*this, blockSize) {
+	index.InsertText(0, pcb->Length());
+}
+
+// Blocks may start anywhere as the hash does not depend on where they start.
+Sci::Position ContentHashIndex::SplitPosition(Sci::Position position) const noexcept {
+	return position;
+}
+
+void ContentHashIndex::Summarize(Sci::Position start, Sci::Position end, Hash &hash) const noexcept {
+	hash = HashText(pcb, start, end);
+}
+
+void ContentHashIndex::InsertText(Sci::Position position, Sci::Position length) {
+	index.InsertText(position, length);
+}
+
+void ContentHashIndex::DeleteText(Sci::Position position, Sci::Position length) {
+	index.DeleteText(position, length);
+}
+
+ContentHashIndex::Hash ContentHashIndex::HashRange(Sci::Position start, Sci::Position end) {
+	return index.Range(start, end);
+}
+
+void ContentHashIndex::SetSavePoint() {
+	saved = HashRange(0, pcb->Length());
+	savedKnown = true;
+}
+
+bool ContentHashIndex::MatchesSavePoint() {
+	return savedKnown && (HashRange(0, pcb->Length()) == saved);
+}
@@ -0,0 +1,56 @@
+// Hyperion source code edit control
+/** @file ContentHashIndex.hpp
+ ** Hash the text of a document over blocks so changes only rehash the blocks they touch.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * A polynomial hash modulo 2^61-1 kept for blocks of a document with a tree over the
+ * blocks. Hashes of neighbouring ranges combine into the hash of their concatenation so
+ * the result depends only on the text and not on where the blocks happen to be, allowing
+ * ranges and documents to be compared. This is for detecting changes, not for security.
+ */
+class ContentHashIndex {
+public:
+	struct Hash {
+		uint64_t value = 0;
+		uint64_t power = 1;	///< Multiplier for the length of the text hashed
+
+		bool operator==(const Hash &other) const noexcept {
+			return (value == other.value) && (power == other.power);
+		}
+	};
+	static Hash Combine(Hash a, Hash b) noexcept;
+	static Hash HashText(const CellBuffer *pcb, Sci::Position start, Sci::Position end) noexcept;
+
+private:
+	using Index = BlockIndex<ContentHashIndex, Hash, Combine>;
+	friend Index;
+	const CellBuffer *pcb;
+	Index index;
+	Hash saved;
+	bool savedKnown = false;
+
+	Sci::Position SplitPosition(Sci::Position position) const noexcept;
+	void Summarize(Sci::Position start, Sci::Position end, Hash &hash) const noexcept;
+	void Release(Hash &) const noexcept {
+	}
+
+public:
+	explicit ContentHashIndex(const CellBuffer *pcb_);
+
+	void InsertText(Sci::Position position, Sci::Position length);
+	void DeleteText(Sci::Position position, Sci::Position length);
+
+	Hash HashRange(Sci::Position start, Sci::Position end);
+	/// Remember the hash of the whole text as the saved text.
+	void SetSavePoint();
+	/// Whether the saved text is known and has the same hash as the current text.
+	bool MatchesSavePoint();
+};
+
+}
@@ -20,11 +20,16 @@
 #include <vector>
 #include <array>
 #include <map>
+#include <unordered_map>
 #include <forward_list>
 #include <optional>
 #include <algorithm>
 #include <memory>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <system_error>
 
 #ifndef NO_CXX11_REGEX
 #include <regex>
@@ -42,6 +47,7 @@
 #include "../syntax/CaseFolder.hpp"
 #include "../syntax/RESearch.hpp"
 #include "../syntax/UniConversion.hpp"
+#include "../syntax/UTF8Scan.hpp"
 #include "../platform/ElapsedPeriod.hpp"
 
 #include "SplitVector.hpp"
@@ -49,7 +55,14 @@
 #include "RunStyles.hpp"
 #include "CellBuffer.hpp"
 #include "PerLine.hpp"
+#include "LineDiff.hpp"
+#include "BlockIndex.hpp"
+#include "BraceIndex.hpp"
 #include "Document.hpp"
+#include "TextCountIndex.hpp"
+#include "ContentHashIndex.hpp"
+#include "ColumnIndex.hpp"
+#include "WordIndex.hpp"
 
 using namespace Hyperion;
 using namespace Hyperion::Internal;
@@ -59,6 +72,220 @@ using namespace Hyperion::Internal;
 #pragma GCC diagnostic ignored "-Wstringop-overflow"
 #endif
 
+namespace {
+
+// Ranges shorter than this are lexed on the calling thread as there is little to gain
+// from spinning up workers.
+constexpr Sci::Position lengthToLexInParallel = 0x100000;
+
+// Each chunk buffers its styles until committed so limit chunk size to bound memory use.
+constexpr Sci::Position lengthLexChunk = 0x400000;
+
+// Lines at least this long find columns from checkpoints rather than from the line start.
+constexpr Sci::Position lengthColumnIndexed = 0x1000;
+
+// IDocument given to a lexer running on a worker thread for one chunk of the document.
+// Text and line positions are read from the document, which does not change while workers run.
+// Styles, line states, fold levels and decorations are buffered here and committed later on
+// the main thread once the chunk's assumed start state has been validated.
+class ChunkAccess final : public IDocument {
+	struct DecorationFill {
+		int indicator;
+		Sci::Position position;
+		int value;
+		Sci::Position fillLength;
+	};
+	Document *pdoc;
+	const char *buffer;
+	// When restarting, text before the chunk is treated as if it ended in the restart state
+	const bool restart;
+	const int restartStyle;
+	const int restartLineState;
+	Sci::Position endStyledChunk;
+	int indicatorCurrent = 0;
+	std::vector<DecorationFill> decorationFills;
+	std::vector<Range> lexerStateChanges;
+	int errorStatus = 0;
+public:
+	const Sci::Position start;
+	const Sci::Position end;
+	const Sci::Line lineStart;
+	std::vector<char> styles;
+	std::vector<int> lineStates;
+	std::vector<int> levels;
+
+	ChunkAccess(Document *pdoc_, const char *buffer_, Sci::Position start_, Sci::Position end_,
+		bool restart_, int restartStyle_, int restartLineState_) :
+		pdoc(pdoc_), buffer(buffer_),
+		restart(restart_), restartStyle(restartStyle_), restartLineState(restartLineState_),
+		endStyledChunk(start_), start(start_), end(end_), lineStart(pdoc_->SciLineFromPosition(start_)) {
+		// Start from the current values as those are what sequential lexing would see
+		styles.resize(end - start);
+		pdoc->GetStyleRange(reinterpret_cast<unsigned char *>(styles.data()), start, end - start);
+		const Sci::Line lineEnd = pdoc->SciLineFromPosition(end - 1) + 1;
+		for (Sci::Line line = lineStart; line < lineEnd; line++) {
+			lineStates.push_back(pdoc->GetLineState(line));
+			levels.push_back(pdoc->GetLevel(line));
+		}
+	}
+
+	bool ContainsLine(Sci_Position line) const noexcept {
+		return (line >= lineStart) && (line < lineStart + static_cast<Sci::Line>(lineStates.size()));
+	}
+
+	// Write all the buffered data into the document, which notifies only for real changes.
+	void Commit() {
+		pdoc->StartStyling(start);
+		pdoc->SetStyles(end - start, styles.data());
+		for (size_t i = 0; i < lineStates.size(); i++) {
+			const Sci::Line line = lineStart + i;
+			if (lineStates[i] != pdoc->GetLineState(line)) {
+				pdoc->SetLineState(line, lineStates[i]);
+			}
+			if (levels[i] != pdoc->GetLevel(line)) {
+				pdoc->SetLevel(line, levels[i]);
+			}
+		}
+		for (const DecorationFill &fill : decorationFills) {
+			pdoc->DecorationSetCurrentIndicator(fill.indicator);
+			pdoc->DecorationFillRange(fill.position, fill.value, fill.fillLength);
+		}
+		for (const Range &range : lexerStateChanges) {
+			pdoc->ChangeLexerState(range.start, range.end);
+		}
+		if (errorStatus) {
+			pdoc->SetErrorStatus(errorStatus);
+		}
+	}
+
+	int SCI_METHOD Version() const override {
+		return dvRelease4;
+	}
+	void SCI_METHOD SetErrorStatus(int status) override {
+		errorStatus = status;
+	}
+	Sci_Position SCI_METHOD Length() const override {
+		return pdoc->Length();
+	}
+	void SCI_METHOD GetCharRange(char *buffer_, Sci_Position position, Sci_Position lengthRetrieve) const override {
+		pdoc->GetCharRange(buffer_, position, lengthRetrieve);
+	}
+	char SCI_METHOD StyleAt(Sci_Position position) const override {
+		if (position >= start && position < end) {
+			return styles[position - start];
+		}
+		if (restart && position < start) {
+			return static_cast<char>(restartStyle);
+		}
+		return pdoc->StyleAt(position);
+	}
+	Sci_Position SCI_METHOD LineFromPosition(Sci_Position position) const override {
+		return pdoc->LineFromPosition(position);
+	}
+	Sci_Position SCI_METHOD LineStart(Sci_Position line) const override {
+		return pdoc->LineStart(line);
+	}
+	int SCI_METHOD GetLevel(Sci_Position line) const override {
+		if (ContainsLine(line)) {
+			return levels[line - lineStart];
+		}
+		return pdoc->GetLevel(line);
+	}
+	int SCI_METHOD SetLevel(Sci_Position line, int level) override {
+		if (ContainsLine(line)) {
+			const int prev = levels[line - lineStart];
+			levels[line - lineStart] = level;
+			return prev;
+		}
+		return GetLevel(line);
+	}
+	int SCI_METHOD GetLineState(Sci_Position line) const override {
+		if (ContainsLine(line)) {
+			return lineStates[line - lineStart];
+		}
+		if (restart && line < lineStart) {
+			return restartLineState;
+		}
+		return pdoc->GetLineState(line);
+	}
+	int SCI_METHOD SetLineState(Sci_Position line, int state) override {
+		if (ContainsLine(line)) {
+			const int prev = lineStates[line - lineStart];
+			lineStates[line - lineStart] = state;
+			return prev;
+		}
+		return GetLineState(line);
+	}
+	void SCI_METHOD StartStyling(Sci_Position position) override {
+		endStyledChunk = position;
+	}
+	bool SCI_METHOD SetStyleFor(Sci_Position length, char style) override {
+		const Sci::Position first = std::clamp(endStyledChunk, start, end);
+		const Sci::Position last = std::clamp(endStyledChunk + length, start, end);
+		std::fill(styles.begin() + (first - start), styles.begin() + (last - start), style);
+		endStyledChunk += length;
+		return true;
+	}
+	bool SCI_METHOD SetStyles(Sci_Position length, const char *styles_) override {
+		for (Sci_Position i = 0; i < length; i++, endStyledChunk++) {
+			if (endStyledChunk >= start && endStyledChunk < end) {
+				styles[endStyledChunk - start] = styles_[i];
+			}
+		}
+		return true;
+	}
+	void SCI_METHOD DecorationSetCurrentIndicator(int indicator) override {
+		indicatorCurrent = indicator;
+	}
+	void SCI_METHOD DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) override {
+		decorationFills.push_back({ indicatorCurrent, position, value, fillLength });
+	}
+	void SCI_METHOD ChangeLexerState(Sci_Position start_, Sci_Position end_) override {
+		lexerStateChanges.emplace_back(start_, end_);
+	}
+	int SCI_METHOD CodePage() const override {
+		return pdoc->CodePage();
+	}
+	bool SCI_METHOD IsDBCSLeadByte(char ch) const override {
+		return pdoc->IsDBCSLeadByte(ch);
+	}
+	const char * SCI_METHOD BufferPointer() override {
+		// The gap was moved before starting workers so this is stable
+		return buffer;
+	}
+	int SCI_METHOD GetLineIndentation(Sci_Position line) override {
+		return pdoc->GetLineIndentation(line);
+	}
+	Sci_Position SCI_METHOD LineEnd(Sci_Position line) const override {
+		return pdoc->LineEnd(line);
+	}
+	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const override {
+		return pdoc->GetRelativePosition(positionStart, characterOffset);
+	}
+	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const override {
+		return pdoc->GetCharacterAndWidth(position, pWidth);
+	}
+};
+
+// Sets a flag for its lifetime so the flag is cleared even when an exception passes through.
+class FlagSetter {
+	bool &flag;
+public:
+	explicit FlagSetter(bool &flag_) noexcept : flag(flag_) {
+		flag = true;
+	}
+	// Deleted so FlagSetter objects can not be copied.
+	FlagSetter(const FlagSetter &) = delete;
+	FlagSetter(FlagSetter &&) = delete;
+	void operator=(const FlagSetter &) = delete;
+	FlagSetter &operator=(FlagSetter &&) = delete;
+	~FlagSetter() {
+		flag = false;
+	}
+};
+
+}
+
 LexInterface::LexInterface(Document *pdoc_) noexcept : pdoc(pdoc_), performingStyle(false) {
 }
 
@@ -73,7 +300,7 @@ void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 		// Protect against reentrance, which may occur, for example, when
 		// fold points are discovered while performing styling and the folding
 		// code looks for child lines which may trigger styling.
-		performingStyle = true;
+		FlagSetter performing(performingStyle);
 
 		const Sci::Position lengthDoc = pdoc->Length();
 		if (end == -1)
@@ -88,11 +315,103 @@ void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 			styleStart = pdoc->StyleAt(start - 1);
 
 		if (len > 0) {
-			instance->Lex(start, len, styleStart, pdoc);
+			// Watchers see one style change for the whole range
+			StylingGroup sg(pdoc);
+			// Only restartable lexers report exactly this version so the cast is safe
+			if ((len >= lengthToLexInParallel) && (instance->Version() == lvRelease5Restartable) &&
+				(std::thread::hardware_concurrency() > 1)) {
+				ColouriseChunks(static_cast<ILexer5Restartable *>(instance.get()), start, end);
+			} else {
+				instance->Lex(start, len, styleStart, pdoc);
+			}
 			instance->Fold(start, len, styleStart, pdoc);
 		}
+	}
+}
+
+// Lex a large range by splitting it at restart points into chunks that are lexed in parallel.
+// Chunks are then committed in order: a chunk whose assumed start state does not match the
+// state actually left by the previous chunk is lexed again on this thread.
+void LexInterface::ColouriseChunks(ILexer5Restartable *restartable, Sci::Position start, Sci::Position end) {
+	const size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+	const int restartStyle = restartable->RestartStyle();
+	const int restartLineState = restartable->RestartLineState();
+	const char *buffer = pdoc->BufferPointer();
+	const Sci::Line lineLast = pdoc->SciLineFromPosition(end);
+
+	while (start < end) {
+		// Choose chunk boundaries for this pass at restart points
+		const Sci::Position lengthPass = std::min<Sci::Position>(end - start, lengthLexChunk * threads);
+		const Sci::Position lengthChunk = std::max<Sci::Position>(lengthPass / threads, lengthToLexInParallel / 4);
+		std::vector<std::unique_ptr<ChunkAccess>> chunks;
+		Sci::Position chunkStart = start;
+		while (chunkStart < start + lengthPass) {
+			// Without a restart point nearby, split anyway and let validation decide
+			Sci::Position chunkEnd = end;
+			const Sci::Line lineTry = pdoc->SciLineFromPosition(chunkStart + lengthChunk) + 1;
+			if ((chunkStart + lengthChunk < end) && (lineTry < lineLast)) {
+				const Sci::Line lineLimit = std::min(
+					pdoc->SciLineFromPosition(chunkStart + 2 * lengthChunk) + 1, lineLast);
+				// Keep the end from lineTry to lineLimit so a chunk is never empty or backwards
+				const Sci::Line lineRestart = std::clamp<Sci::Line>(
+					restartable->RestartLine(lineTry, lineLimit, pdoc), lineTry, lineLimit);
+				chunkEnd = pdoc->LineStart(lineRestart);
+			}
+			const bool restart = !chunks.empty();
+			chunks.push_back(std::make_unique<ChunkAccess>(pdoc, buffer, chunkStart, chunkEnd,
+				restart, restartStyle, restartLineState));
+			chunkStart = chunkEnd;
+		}
+
+		const int styleStart = (start > 0) ? pdoc->StyleIndexAt(start - 1) : 0;
+		const size_t workers = std::min(chunks.size(), threads);
+		const std::launch policy = (workers > 1) ? std::launch::async : std::launch::deferred;
+		std::atomic<size_t> nextIndex = 0;
+		const auto work = [=, &chunks, &nextIndex]() {
+			while (true) {
+				const size_t i = nextIndex.fetch_add(1, std::memory_order_acq_rel);
+				if (i >= chunks.size()) {
+					break;
+				}
+				ChunkAccess *chunk = chunks[i].get();
+				const int initStyle = (i == 0) ? styleStart : restartStyle;
+				restartable->Lex(chunk->start, chunk->end - chunk->start, initStyle, chunk);
+			}
+		};
+		std::vector<std::future<void>> futures;
+		for (size_t th = 0; th < workers; th++) {
+			try {
+				futures.push_back(std::async(policy, work));
+			} catch (const std::system_error &) {
+				// Out of threads: those already started take every chunk between them
+				break;
+			}
+		}
+		if (futures.empty()) {
+			// No thread could be started so lex the rest of the range serially
+			restartable->Lex(start, end - start, styleStart, pdoc);
+			return;
+		}
+		for (std::future<void> &f : futures) {
+			f.wait();
+		}
+		for (std::future<void> &f : futures) {
+			f.get();	// Rethrow any failure from a worker
+		}
 
-		performingStyle = false;
+		for (size_t i = 0; i < chunks.size(); i++) {
+			ChunkAccess *chunk = chunks[i].get();
+			const bool validStart = (i == 0) ||
+				((pdoc->StyleIndexAt(chunk->start - 1) == restartStyle) &&
+				(pdoc->GetLineState(chunk->lineStart - 1) == restartLineState));
+			if (validStart) {
+				chunk->Commit();
+			} else {
+				restartable->Lex(chunk->start, chunk->end - chunk->start,
+					pdoc->StyleIndexAt(chunk->start - 1), pdoc);
+			}
+		}
+		start = chunks.back()->end;
 	}
 }
 
@@ -155,6 +474,9 @@ Document::Document(DocumentOption options) :
 	styleClock(0),
 	enteredModification(0),
 	enteredStyling(0),
+	stylingTransaction(0),
+	styleChangeStart(0),
+	styleChangeEnd(0),
 	enteredReadOnlyCount(0),
 	insertionSet(false),
 #ifdef _WIN32
@@ -270,6 +592,12 @@ bool Document::SetDBCSCodePage(int dbcsCodePage_) {
 		cb.SetLineEndTypes(lineEndBitSet & LineEndTypesSupported());
 		cb.SetUTF8Substance(CpUtf8 == dbcsCodePage);
 		ModifiedAt(0);	// Need to restyle whole document
+		if (textCountIndex) {
+			textCountIndex->Invalidate();
+		}
+		if (wordIndex) {
+			wordIndex->Invalidate();
+		}
 		return true;
 	}
 	return false;
@@ -290,6 +618,9 @@ bool Document::SetLineEndTypesAllowed(LineEndType lineEndBitSet_) {
 
 void Document::SetSavePoint() {
 	cb.SetSavePoint();
+	if (contentHashIndex) {
+		contentHashIndex->SetSavePoint();
+	}
 	NotifySavePoint(true);
 }
 
@@ -1433,6 +1764,85 @@ void Document::TrimReplacement(std::string_view &text, Range &range) const noexc
 	}
 }
 
+namespace {
+
+// Whether position in text follows a line end so is not inside a line or a \r\n pair.
+bool AtLineStart(std::string_view text, size_t position) noexcept {
+	if ((position == 0) || (position >= text.length())) {
+		return true;
+	}
+	const char previous = text[position - 1];
+	return (previous == '\n') || ((previous == '\r') && (text[position] != '\n'));
+}
+
+}
+
+// Replace the whole text with text by changing only the lines that differ, all in one
+// undo action, so markers, folds and other state outside those lines are kept.
+// Returns the number of separate changes made.
+Sci::Position Document::ReloadText(std::string_view text) {
+	const std::string_view current(BufferPointer(), LengthNoExcept());
+
+	// Lines common to the start and end are found by comparing bytes then only the
+	// middle is split into lines and compared.
+	size_t prefix = std::mismatch(current.begin(), current.begin() + std::min(current.length(), text.length()),
+		text.begin()).first - current.begin();
+	while ((prefix > 0) && !(AtLineStart(current, prefix) && AtLineStart(text, prefix))) {
+		prefix--;
+	}
+	const size_t suffixMaximum = std::min(current.length(), text.length()) - prefix;
+	size_t suffix = std::mismatch(current.rbegin(), current.rbegin() + suffixMaximum, text.rbegin()).first - current.rbegin();
+	while ((suffix > 0) && !(AtLineStart(current, current.length() - suffix) && AtLineStart(text, text.length() - suffix))) {
+		suffix--;
+	}
+	const std::string_view middleCurrent = current.substr(prefix, current.length() - suffix - prefix);
+	const std::string_view middleText = text.substr(prefix, text.length() - suffix - prefix);
+	if (middleCurrent == middleText) {
+		return 0;
+	}
+
+	const std::vector<size_t> startsCurrent = LineStartsOf(middleCurrent);
+	const std::vector<size_t> startsText = LineStartsOf(middleText);
+	std::vector<DiffHunk> hunks = DiffLines(HashLines(middleCurrent, startsCurrent), HashLines(middleText, startsText));
+	if (!SameOutsideHunks(middleCurrent, startsCurrent, middleText, startsText, hunks)) {
+		// Lines with the same hash differ so replace everything between prefix and suffix
+		hunks = { DiffHunk{ 0, startsCurrent.size() - 1, 0, startsText.size() - 1 } };
+	}
+	CheckReadOnly();
+	if (cb.IsReadOnly()) {
+		return 0;
+	}
+
+	// Work out all the changes before making any as current points into the buffer
+	struct Replacement {
+		Range range;
+		std::string_view text;
+	};
+	std::vector<Replacement> replacements;
+	replacements.reserve(hunks.size());
+	for (const DiffHunk &hunk : hunks) {
+		const size_t startText = startsText[hunk.startB];
+		Replacement replacement {
+			Range(prefix + startsCurrent[hunk.startA], prefix + startsCurrent[hunk.startA + hunk.lengthA]),
+			middleText.substr(startText, startsText[hunk.startB + hunk.lengthB] - startText)
+		};
+		TrimReplacement(replacement.text, replacement.range);
+		replacements.push_back(replacement);
+	}
+
+	// Change from the end so earlier positions stay valid
+	UndoGroup ug(this);
+	for (auto it = replacements.rbegin(); it != replacements.rend(); ++it) {
+		if (it->range.Length() > 0) {
+			DeleteChars(it->range.start, it->range.Length());
+		}
+		if (!it->text.empty()) {
+			InsertString(it->range.start, it->text);
+		}
+	}
+	return static_cast<Sci::Position>(hunks.size());
+}
+
 // Document only modified by gateways DeleteChars, InsertString, Undo, Redo, and SetStyleAt.
 // SetStyleAt does not change the persistent state of a document
 
@@ -1776,7 +2186,16 @@ Sci::Position Document::GetColumn(Sci::Position pos) const {
 	Sci::Position column = 0;
 	const Sci::Line line = SciLineFromPosition(pos);
 	if ((line >= 0) && (line < LinesTotal())) {
-		for (Sci::Position i = LineStart(line); i < pos;) {
+		Sci::Position i = LineStart(line);
+		if (LineEnd(line) - i >= lengthColumnIndexed) {
+			if (!columnIndex) {
+				columnIndex = std::make_unique<ColumnIndex>(this);
+			}
+			const ColumnIndex::Checkpoint checkpoint = columnIndex->BeforePosition(line, pos);
+			i = checkpoint.position;
+			column = checkpoint.column;
+		}
+		while (i < pos) {
 			const char ch = cb.CharAt(i);
 			if (ch == '\t') {
 				column = NextTab(column, tabInChars);
@@ -1799,9 +2218,46 @@ Sci::Position Document::GetColumn(Sci::Position pos) const {
 	return column;
 }
 
+namespace {
+
+// Count the characters of UTF-8 text between character boundaries in the same way as
+// stepping with NextPosition. Valid runs inside each segment of the split view are counted in
+// bulk with NextPosition only used for invalid bytes and characters that straddle the gap.
+UTF8Counts CountUTF8(const Document &doc, const SplitView &view, Sci::Position startPos, Sci::Position endPos) noexcept {
+	UTF8Counts counts;
+	Sci::Position i = startPos;
+	while (i < endPos) {
+		const bool inSegment1 = static_cast<size_t>(i) < view.length1;
+		const Sci::Position segmentEnd = inSegment1 ?
+			std::min(endPos, static_cast<Sci::Position>(view.length1)) : endPos;
+		const std::string_view text((inSegment1 ? view.segment1 : view.segment2) + i, segmentEnd - i);
+		const size_t lengthValid = UTF8ValidPrefix(text);
+		const UTF8Counts countsValid = UTF8CountValid(text.substr(0, lengthValid));
+		counts.characters += countsValid.characters;
+		counts.otherPlanes += countsValid.otherPlanes;
+		i += lengthValid;
+		if (i < endPos) {
+			const Sci::Position next = doc.NextPosition(i, 1);
+			counts.characters++;
+			if ((next - i) > 3)
+				counts.otherPlanes++;
+			i = next;
+		}
+	}
+	return counts;
+}
+
+}
+
 Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept {
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
+	if (0 == dbcsCodePage) {
+		return std::max<Sci::Position>(endPos - startPos, 0);
+	}
+	if (CpUtf8 == dbcsCodePage) {
+		return static_cast<Sci::Position>(CountUTF8(*this, cb.AllView(), startPos, endPos).characters);
+	}
 	Sci::Position count = 0;
 	Sci::Position i = startPos;
 	while (i < endPos) {
@@ -1814,6 +2270,12 @@ Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position en
 Sci::Position Document::CountUTF16(Sci::Position startPos, Sci::Position endPos) const noexcept {
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
+	if (0 == dbcsCodePage) {
+		return std::max<Sci::Position>(endPos - startPos, 0);
+	}
+	if (CpUtf8 == dbcsCodePage) {
+		return static_cast<Sci::Position>(CountUTF8(*this, cb.AllView(), startPos, endPos).UTF16());
+	}
 	Sci::Position count = 0;
 	Sci::Position i = startPos;
 	while (i < endPos) {
@@ -1826,10 +2288,216 @@ Sci::Position Document::CountUTF16(Sci::Position startPos, Sci::Position endPos)
 	return count;
 }
 
+namespace {
+
+// Counts and advances through the document in one unit system for ConvertPositions.
+// Runs of valid UTF-8 are handled in bulk with NextPosition only used for invalid bytes
+// and characters that straddle the gap.
+class UnitCounter {
+	// Shorter moves are stepped one character at a time as that is quicker than scanning
+	static constexpr Sci::Position bulkUnits = 16;
+	const Document &doc;
+	SplitView view;
+	bool utf16;
+	bool bytes;
+public:
+	UnitCounter(const Document &doc_, const SplitView &view_, PositionUnit unit) noexcept :
+		doc(doc_), view(view_),
+		utf16(unit == PositionUnit::Utf16),
+		bytes(unit == PositionUnit::Byte || doc.dbcsCodePage == 0) {
+	}
+	bool Bytes() const noexcept {
+		return bytes;
+	}
+	// Units between two character boundaries
+	Sci::Position Count(Sci::Position start, Sci::Position end) const noexcept {
+		if (bytes) {
+			return end - start;
+		}
+		if (CpUtf8 == doc.dbcsCodePage) {
+			const UTF8Counts counts = CountUTF8(doc, view, start, end);
+			return static_cast<Sci::Position>(utf16 ? counts.UTF16() : counts.characters);
+		}
+		return doc.CountCharacters(start, end);
+	}
+	// Move forward from position over whole characters until units is used up or limit is
+	// reached, reducing units by the amount moved.
+	Sci::Position Advance(Sci::Position position, Sci::Position &units, Sci::Position limit) const noexcept {
+		if (bytes) {
+			const Sci::Position next = std::clamp(position + units, position, std::max(limit, position));
+			units -= next - position;
+			return next;
+		}
+		while (units > 0 && position < limit) {
+			if (UTF8IsAscii(view.CharAt(position))) {
+				units--;
+				position++;
+				continue;
+			}
+			if (CpUtf8 == doc.dbcsCodePage && units >= bulkUnits) {
+				// Each character takes at least as many bytes as units so a window of units
+				// bytes can not overshoot.
+				const bool inSegment1 = static_cast<size_t>(position) < view.length1;
+				const Sci::Position segmentEnd = inSegment1 ?
+					std::min(limit, static_cast<Sci::Position>(view.length1)) : limit;
+				const std::string_view text((inSegment1 ? view.segment1 : view.segment2) + position,
+					std::min(units, segmentEnd - position));
+				const size_t lengthValid = UTF8ValidPrefix(text);
+				if (lengthValid > 0) {
+					const UTF8Counts counts = UTF8CountValid(text.substr(0, lengthValid));
+					units -= static_cast<Sci::Position>(utf16 ? counts.UTF16() : counts.characters);
+					position += lengthValid;
+					continue;
+				}
+			}
+			const Sci::Position next = doc.NextPosition(position, 1);
+			const Sci::Position width = (utf16 && (next - position) > 3) ? 2 : 1;
+			if (next > limit || width > units) {
+				break;
+			}
+			units -= width;
+			position = next;
+		}
+		return position;
+	}
+};
+
+// Converts between byte positions and either document offsets or (line, column) pairs in one
+// unit system. The most recent conversion is kept so a sorted batch is a single forward sweep.
+// The line character index for the units, when allocated, is used to jump over whole lines
+// and to treat lines with one unit per byte as bytes.
+class PositionCursor {
+	const Document &doc;
+	UnitCounter counter;
+	bool lines;
+	LineCharacterIndexType index = LineCharacterIndexType::None;
+	Sci::Line line = -1;
+	Sci::Position lineEnd = 0;
+	bool lineSingleUnits = false;
+	Sci::Position position = 0;
+	Sci::Position units = 0;	// From the document start or from the line start
+
+	void StartLine(Sci::Line lineStart) {
+		line = lineStart;
+		position = doc.LineStart(line);
+		if (lines) {
+			units = 0;
+			lineEnd = doc.LineEnd(line);
+			lineSingleUnits = (index != LineCharacterIndexType::None) &&
+				(doc.IndexLineStart(line + 1, index) - doc.IndexLineStart(line, index) ==
+					doc.LineStart(line + 1) - position);
+		} else {
+			units = (index != LineCharacterIndexType::None) ? doc.IndexLineStart(line, index) : 0;
+		}
+	}
+	Sci::Position Snap(Sci::Position pos) const noexcept {
+		return doc.MovePositionOutsideChar(std::clamp<Sci::Position>(pos, 0, doc.LengthNoExcept()), -1, false);
+	}
+public:
+	PositionCursor(const Document &doc_, const SplitView &view, PositionUnit unit) :
+		doc(doc_),
+		counter(doc_, view, static_cast<PositionUnit>(static_cast<int>(unit) & ~static_cast<int>(PositionUnit::Line))),
+		lines(FlagSet(unit, PositionUnit::Line)) {
+		const LineCharacterIndexType indexUnit = static_cast<LineCharacterIndexType>(
+			static_cast<int>(unit) & ~static_cast<int>(PositionUnit::Line));
+		if (!counter.Bytes() && FlagSet(doc.LineCharacterIndex(), indexUnit)) {
+			index = indexUnit;
+		}
+		StartLine(0);
+	}
+	bool Lines() const noexcept {
+		return lines;
+	}
+
+	Sci::Position ToPosition(const Sci::Position *values) {
+		if (lines) {
+			if (values[0] >= doc.LinesTotal()) {
+				return doc.LengthNoExcept();
+			}
+			const Sci::Line lineWanted = std::max<Sci::Line>(values[0], 0);
+			const Sci::Position column = std::max<Sci::Position>(values[1], 0);
+			if (lineWanted != line || column < units) {
+				StartLine(lineWanted);
+			}
+			if (lineSingleUnits) {
+				position = std::min(position + column - units, lineEnd);
+				units = column;
+				return position;
+			}
+			Sci::Position remaining = column - units;
+			position = counter.Advance(position, remaining, lineEnd);
+			units = column - remaining;
+			return position;
+		}
+		const Sci::Position offset = std::max<Sci::Position>(values[0], 0);
+		if (counter.Bytes()) {
+			return std::min(offset, doc.LengthNoExcept());
+		}
+		if (index != LineCharacterIndexType::None) {
+			const Sci::Line lineWanted = doc.LineFromPositionIndex(offset, index);
+			if (offset < units || lineWanted > line) {
+				StartLine(lineWanted);
+			}
+		} else if (offset < units) {
+			StartLine(0);
+		}
+		Sci::Position remaining = offset - units;
+		position = counter.Advance(position, remaining, doc.LengthNoExcept());
+		units = offset - remaining;
+		line = doc.SciLineFromPosition(position);
+		return position;
+	}
+
+	void FromPosition(Sci::Position pos, Sci::Position *values) {
+		if (!lines && counter.Bytes()) {
+			values[0] = std::clamp<Sci::Position>(pos, 0, doc.LengthNoExcept());
+			return;
+		}
+		pos = Snap(pos);
+		const Sci::Line lineWanted = doc.SciLineFromPosition(pos);
+		const bool byLine = lines || index != LineCharacterIndexType::None;
+		if (pos < position || (byLine && lineWanted != line)) {
+			StartLine(byLine ? lineWanted : 0);
+		}
+		units += lineSingleUnits ? pos - position : counter.Count(position, pos);
+		position = pos;
+		line = lineWanted;
+		if (lines) {
+			values[0] = line;
+			values[1] = units;
+		} else {
+			values[0] = units;
+		}
+	}
+};
+
+}
+
+Sci::Position Document::ConvertPositions(PositionUnit unitsFrom, PositionUnit unitsTo,
+	const Sci::Position *positionsFrom, Sci::Position *positionsTo, Sci::Position count) const {
+	const SplitView view = cb.AllView();
+	PositionCursor from(*this, view, unitsFrom);
+	PositionCursor to(*this, view, unitsTo);
+	for (Sci::Position i = 0; i < count; i++) {
+		to.FromPosition(from.ToPosition(positionsFrom), positionsTo);
+		positionsFrom += from.Lines() ? 2 : 1;
+		positionsTo += to.Lines() ? 2 : 1;
+	}
+	return count;
+}
+
 Sci::Position Document::FindColumn(Sci::Line line, Sci::Position column) {
 	Sci::Position position = LineStart(line);
 	if ((line >= 0) && (line < LinesTotal())) {
 		Sci::Position columnCurrent = 0;
+		if (LineEnd(line) - position >= lengthColumnIndexed) {
+			if (!columnIndex) {
+				columnIndex = std::make_unique<ColumnIndex>(this);
+			}
+			const ColumnIndex::Checkpoint checkpoint = columnIndex->BeforeColumn(line, column);
+			position = checkpoint.position;
+			columnCurrent = checkpoint.column;
+		}
 		while ((columnCurrent < column) && (position < Length())) {
 			const char ch = cb.CharAt(position);
 			if (ch == '\t') {
@@ -1852,14 +2520,89 @@ Sci::Position Document::FindColumn(Sci::Line line, Sci::Position column) {
 
 void Document::Indent(bool forwards, Sci::Line lineBottom, Sci::Line lineTop) {
 	// Dedent - suck white space off the front of the line to dedent by equivalent of a tab
-	for (Sci::Line line = lineBottom; line >= lineTop; line--) {
-		const Sci::Position indentOfLine = GetLineIndentation(line);
-		if (forwards) {
-			if (LineStart(line) < LineEnd(line)) {
-				SetLineIndentation(line, indentOfLine + IndentSize());
+	NormalizeWhitespace(lineTop, lineBottom, Normalize::None, forwards ? 1 : -1);
+}
+
+// Scan the lines once to find every change then apply them from the end so that the
+// positions found stay valid. Each change only covers the bytes that differ.
+// Indentation is rewritten when tabifying, untabifying or changing the indentation by
+// indentLevels, in which case it uses tabs when useTabs is set unless an option overrides that.
+// Indenting leaves empty lines alone.
+void Document::NormalizeWhitespace(Sci::Line lineFirst, Sci::Line lineLast, Normalize options, int indentLevels) {
+	struct Change {
+		Sci::Position position;
+		Sci::Position lengthRemove;
+		size_t startInsert;
+		size_t lengthInsert;
+	};
+	std::vector<Change> changes;
+	std::string insertions;
+	const bool trim = FlagSet(options, Normalize::TrimTrailing);
+	const bool rewriteIndentation = FlagSet(options, Normalize::Tabify | Normalize::Untabify) || (indentLevels != 0);
+	const bool insertSpaces = FlagSet(options, Normalize::Untabify) ||
+		(!FlagSet(options, Normalize::Tabify) && !useTabs);
+	const SplitView view = cb.AllView();
+	lineFirst = std::max<Sci::Line>(lineFirst, 0);
+	lineLast = std::min(lineLast, LinesTotal() - 1);
+	for (Sci::Line line = lineFirst; line <= lineLast; line++) {
+		const Sci::Position lineStart = LineStart(line);
+		const Sci::Position lineEnd = LineEnd(line);
+		Sci::Position indentEnd = lineStart;
+		Sci::Position indent = 0;
+		while (indentEnd < lineEnd) {
+			const char ch = view.CharAt(indentEnd);
+			if (ch == ' ') {
+				indent++;
+			} else if (ch == '\t') {
+				indent = NextTab(indent, tabInChars);
+			} else {
+				break;
+			}
+			indentEnd++;
+		}
+		if (trim && (indentEnd == lineEnd)) {
+			// Whole line is white space
+			if (lineEnd > lineStart) {
+				changes.push_back({lineStart, lineEnd - lineStart, 0, 0});
+			}
+			continue;
+		}
+		if (rewriteIndentation && !((indentLevels > 0) && (lineStart == lineEnd))) {
+			const Sci::Position indentWanted = std::max<Sci::Position>(indent + indentLevels * IndentSize(), 0);
+			const std::string indentation = CreateIndentation(indentWanted, tabInChars, insertSpaces);
+			const Sci::Position lengthIndent = indentEnd - lineStart;
+			size_t same = 0;
+			while ((same < indentation.length()) && (static_cast<Sci::Position>(same) < lengthIndent) &&
+				(indentation[same] == view.CharAt(lineStart + same))) {
+				same++;
+			}
+			if ((same < indentation.length()) || (static_cast<Sci::Position>(same) < lengthIndent)) {
+				changes.push_back({lineStart + static_cast<Sci::Position>(same), lengthIndent - static_cast<Sci::Position>(same),
+					insertions.length(), indentation.length() - same});
+				insertions.append(indentation, same);
+			}
+		}
+		if (trim) {
+			Sci::Position contentEnd = lineEnd;
+			while ((contentEnd > indentEnd) && IsSpaceOrTab(view.CharAt(contentEnd - 1))) {
+				contentEnd--;
+			}
+			if (contentEnd < lineEnd) {
+				changes.push_back({contentEnd, lineEnd - contentEnd, 0, 0});
 			}
-		} else {
-			SetLineIndentation(line, indentOfLine - IndentSize());
+		}
+	}
+
+	if (changes.empty()) {
+		return;
+	}
+	UndoGroup ug(this);
+	for (auto it = changes.rbegin(); it != changes.rend(); ++it) {
+		if (it->lengthRemove > 0) {
+			DeleteChars(it->position, it->lengthRemove);
+		}
+		if (it->lengthInsert > 0) {
+			InsertString(it->position, insertions.data() + it->startInsert, it->lengthInsert);
 		}
 	}
 }
@@ -1987,60 +2730,426 @@ Sci::Position Document::ParaDown(Sci::Position pos) const {
 		return LineEnd(line-1);
 }
 
+namespace {
+
+// Class of non-ASCII characters for word operations in Unicode
+constexpr CharacterClass WordClassFromCategory(CharacterCategory cc) noexcept {
+	switch (cc) {
+
+		// Separator, Line/Paragraph
+	case ccZl:
+	case ccZp:
+		return CharacterClass::newLine;
+
+		// Separator, Space
+	case ccZs:
+		// Other
+	case ccCc:
+	case ccCf:
+	case ccCs:
+	case ccCo:
+	case ccCn:
+		return CharacterClass::space;
+
+		// Letter
+	case ccLu:
+	case ccLl:
+	case ccLt:
+	case ccLm:
+	case ccLo:
+		// Number
+	case ccNd:
+	case ccNl:
+	case ccNo:
+		// Mark - includes combining diacritics
+	case ccMn:
+	case ccMc:
+	case ccMe:
+		return CharacterClass::word;
+
+		// Punctuation
+	case ccPc:
+	case ccPd:
+	case ccPs:
+	case ccPe:
+	case ccPi:
+	case ccPf:
+	case ccPo:
+		// Symbol
+	case ccSm:
+	case ccSc:
+	case ccSk:
+	case ccSo:
+		return CharacterClass::punctuation;
+
+	}
+
+	return CharacterClass::word;
+}
+
+// Character navigation over the document text specialized for each family of encodings.
+// Operations choose the family once with Document::WithEncodedText so their loops can step
+// through characters without checking dbcsCodePage each time.
+// Each method behaves as the Document method with the same name.
+
+class EightBitText {
+	SplitView view;
+	const CharClassify &charClass;
+public:
+	EightBitText(const SplitView &view_, const CharClassify &charClass_) noexcept :
+		view(view_), charClass(charClass_) {
+	}
+	Sci::Position Length() const noexcept {
+		return view.length;
+	}
+	unsigned char UCharAt(Sci::Position position) const noexcept {
+		return view.CharAt(position);
+	}
+	bool IsCharacterStart(Sci::Position /*position*/, int /*moveDir*/) const noexcept {
+		return true;
+	}
+	Sci::Position NextPosition(Sci::Position pos, int moveDir) const noexcept {
+		return std::clamp<Sci::Position>(pos + ((moveDir > 0) ? 1 : -1), 0, Length());
+	}
+	CharacterExtracted CharacterAfter(Sci::Position position) const noexcept {
+		if (position >= Length()) {
+			return characterEmpty;
+		}
+		return CharacterExtracted(UCharAt(position), 1);
+	}
+	CharacterExtracted CharacterBefore(Sci::Position position) const noexcept {
+		if (position <= 0) {
+			return characterEmpty;
+		}
+		return CharacterExtracted(UCharAt(position - 1), 1);
+	}
+	CharacterClass WordCharacterClass(unsigned int ch) const noexcept {
+		return charClass.GetClass(static_cast<unsigned char>(ch));
+	}
+};
+
+class UTF8Text {
+	SplitView view;
+	const CharClassify &charClass;
+	const CharacterCategoryMap &charMap;
+	bool InGoodUTF8(Sci::Position pos, Sci::Position &start, Sci::Position &end) const noexcept {
+		Sci::Position trail = pos;
+		while ((trail > 0) && (pos - trail < UTF8MaxBytes) && UTF8IsTrailByte(UCharAt(trail - 1)))
+			trail--;
+		start = (trail > 0) ? trail - 1 : trail;
+		const unsigned char leadByte = UCharAt(start);
+		const int widthCharBytes = UTF8BytesOfLead[leadByte];
+		if ((widthCharBytes == 1) || (pos - start > widthCharBytes - 1)) {
+			return false;
+		}
+		unsigned char charBytes[UTF8MaxBytes] = { leadByte, 0, 0, 0 };
+		for (int b = 1; b < widthCharBytes; b++)
+			charBytes[b] = UCharAt(start + b);
+		if (UTF8Classify(charBytes, widthCharBytes) & UTF8MaskInvalid)
+			return false;
+		end = start + widthCharBytes;
+		return true;
+	}
+public:
+	UTF8Text(const SplitView &view_, const CharClassify &charClass_, const CharacterCategoryMap &charMap_) noexcept :
+		view(view_), charClass(charClass_), charMap(charMap_) {
+	}
+	Sci::Position Length() const noexcept {
+		return view.length;
+	}
+	unsigned char UCharAt(Sci::Position position) const noexcept {
+		return view.CharAt(position);
+	}
+	bool IsCharacterStart(Sci::Position position, int /*moveDir*/) const noexcept {
+		Sci::Position start = position;
+		Sci::Position end = position;
+		return !UTF8IsTrailByte(UCharAt(position)) || !InGoodUTF8(position, start, end);
+	}
+	Sci::Position NextPosition(Sci::Position pos, int moveDir) const noexcept {
+		const int increment = (moveDir > 0) ? 1 : -1;
+		if (pos + increment <= 0)
+			return 0;
+		if (pos + increment >= Length())
+			return Length();
+		if (increment == 1) {
+			const unsigned char leadByte = UCharAt(pos);
+			if (UTF8IsAscii(leadByte)) {
+				return pos + 1;
+			}
+			const int widthCharBytes = UTF8BytesOfLead[leadByte];
+			unsigned char charBytes[UTF8MaxBytes] = { leadByte, 0, 0, 0 };
+			for (int b = 1; b < widthCharBytes; b++)
+				charBytes[b] = UCharAt(pos + b);
+			const int utf8status = UTF8Classify(charBytes, widthCharBytes);
+			return pos + ((utf8status & UTF8MaskInvalid) ? 1 : (utf8status & UTF8MaskWidth));
+		}
+		pos--;
+		if (UTF8IsTrailByte(UCharAt(pos))) {
+			Sci::Position startUTF = pos;
+			Sci::Position endUTF = pos;
+			if (InGoodUTF8(pos, startUTF, endUTF)) {
+				pos = startUTF;
+			}
+		}
+		return pos;
+	}
+	CharacterExtracted CharacterAfter(Sci::Position position) const noexcept {
+		if (position >= Length()) {
+			return characterEmpty;
+		}
+		const unsigned char leadByte = UCharAt(position);
+		if (UTF8IsAscii(leadByte)) {
+			return CharacterExtracted(leadByte, 1);
+		}
+		const int widthCharBytes = UTF8BytesOfLead[leadByte];
+		unsigned char charBytes[UTF8MaxBytes] = { leadByte, 0, 0, 0 };
+		for (int b = 1; b < widthCharBytes; b++)
+			charBytes[b] = UCharAt(position + b);
+		return CharacterExtracted(charBytes, widthCharBytes);
+	}
+	CharacterExtracted CharacterBefore(Sci::Position position) const noexcept {
+		if (position <= 0) {
+			return characterEmpty;
+		}
+		const unsigned char previousByte = UCharAt(position - 1);
+		if (UTF8IsAscii(previousByte)) {
+			return CharacterExtracted(previousByte, 1);
+		}
+		position--;
+		if (UTF8IsTrailByte(previousByte)) {
+			Sci::Position startUTF = position;
+			Sci::Position endUTF = position;
+			if (InGoodUTF8(position, startUTF, endUTF)) {
+				unsigned char charBytes[UTF8MaxBytes] = { 0, 0, 0, 0 };
+				for (Sci::Position b = 0; b < endUTF - startUTF; b++)
+					charBytes[b] = UCharAt(startUTF + b);
+				return CharacterExtracted(charBytes, endUTF - startUTF);
+			}
+		}
+		return characterBadByte;
+	}
+	CharacterClass WordCharacterClass(unsigned int ch) const noexcept {
+		if (ch >= 0x80) {
+			return WordClassFromCategory(charMap.CategoryFor(ch));
+		}
+		return charClass.GetClass(static_cast<unsigned char>(ch));
+	}
+};
+
+class DBCSText {
+	const Document &doc;
+	SplitView view;
+	const CharClassify &charClass;
+public:
+	DBCSText(const Document &doc_, const SplitView &view_, const CharClassify &charClass_) noexcept :
+		doc(doc_), view(view_), charClass(charClass_) {
+	}
+	Sci::Position Length() const noexcept {
+		return view.length;
+	}
+	unsigned char UCharAt(Sci::Position position) const noexcept {
+		return view.CharAt(position);
+	}
+	bool IsCharacterStart(Sci::Position position, int moveDir) const noexcept {
+		return doc.MovePositionOutsideChar(position, moveDir, false) == position;
+	}
+	Sci::Position NextPosition(Sci::Position pos, int moveDir) const noexcept {
+		if (moveDir > 0 && (pos + 1 > 0) && (pos + 1 < Length())) {
+			const bool dualByte = doc.IsDBCSLeadByteNoExcept(UCharAt(pos)) &&
+				doc.IsDBCSTrailByteNoExcept(UCharAt(pos + 1));
+			return std::min<Sci::Position>(pos + (dualByte ? 2 : 1), Length());
+		}
+		// Moving backwards in DBCS is complex so use Document
+		return doc.NextPosition(pos, moveDir);
+	}
+	CharacterExtracted CharacterAfter(Sci::Position position) const noexcept {
+		if (position >= Length()) {
+			return characterEmpty;
+		}
+		const unsigned char leadByte = UCharAt(position);
+		if (!UTF8IsAscii(leadByte) && doc.IsDBCSLeadByteNoExcept(leadByte)) {
+			const unsigned char trailByte = UCharAt(position + 1);
+			if (doc.IsDBCSTrailByteNoExcept(trailByte)) {
+				return CharacterExtracted::DBCS(leadByte, trailByte);
+			}
+		}
+		return CharacterExtracted(leadByte, 1);
+	}
+	CharacterExtracted CharacterBefore(Sci::Position position) const noexcept {
+		if (position <= 0) {
+			return characterEmpty;
+		}
+		return CharacterAfter(doc.NextPosition(position, -1));
+	}
+	CharacterClass WordCharacterClass(unsigned int ch) const noexcept {
+		if (ch >= 0x80) {
+			// Asian DBCS
+			return CharacterClass::word;
+		}
+		return charClass.GetClass(static_cast<unsigned char>(ch));
+	}
+};
+
+template <typename Text>
+bool NextCharacterIn(const Text &text, Sci::Position &pos, int moveDir) noexcept {
+	const Sci::Position posNext = text.NextPosition(pos, moveDir);
+	if (posNext == pos) {
+		return false;
+	}
+	pos = posNext;
+	return true;
+}
+
+// Call visit(position, width, word) for each character from start up to end with word
+// true for word characters.
+template <typename Text, typename Visit>
+void ForEachCharacter(const Text &text, Sci::Position start, Sci::Position end, Visit visit) {
+	Sci::Position position = start;
+	while (position < end) {
+		const unsigned char leadByte = text.UCharAt(position);
+		if (UTF8IsAscii(leadByte)) {
+			visit(position, 1, text.WordCharacterClass(leadByte) == CharacterClass::word);
+			position++;
+		} else {
+			const CharacterExtracted ce = text.CharacterAfter(position);
+			visit(position, ce.widthBytes, text.WordCharacterClass(ce.character) == CharacterClass::word);
+			position += ce.widthBytes;
+		}
+	}
+}
+
+}
+
+template <typename Operation>
+auto Document::WithEncodedText(Operation operation) const {
+	const SplitView view = cb.AllView();
+	switch (CodePageFamily()) {
+	case EncodingFamily::unicode:
+		return operation(UTF8Text(view, charClass, charMap));
+	case EncodingFamily::dbcs:
+		return operation(DBCSText(*this, view, charClass));
+	default:
+		return operation(EightBitText(view, charClass));
+	}
+}
+
+// Count each character starting from start up to end with start treated as the start of a word.
+TextCounts Document::ScanTextCounts(Sci::Position start, Sci::Position end) const noexcept {
+	return WithEncodedText([start, end](const auto &text) noexcept {
+		TextCounts counts;
+		bool inWord = false;
+		ForEachCharacter(text, start, end, [&counts, &inWord](Sci::Position, Sci::Position width, bool word) noexcept {
+			counts.characters++;
+			// Only 4 byte UTF-8 characters are outside the Basic Multilingual Plane
+			counts.codeUnits += (width > 3) ? 2 : 1;
+			if (word && !inWord) {
+				counts.words++;
+			}
+			inWord = word;
+		});
+		return counts;
+	});
+}
+
+// Counts for a range from the index when there is one, which only has to count the
+// partial blocks at each end.
+TextCounts Document::CountText(Sci::Position start, Sci::Position end) {
+	start = MovePositionOutsideChar(start, 1, false);
+	end = std::max(MovePositionOutsideChar(end, -1, false), start);
+	if (textCountIndex) {
+		return textCountIndex->Count(start, end);
+	}
+	return ScanTextCounts(start, end);
+}
+
+void Document::SetTextCountIndexed(bool indexed) {
+	if (!indexed) {
+		textCountIndex.reset();
+	} else if (!textCountIndex) {
+		textCountIndex = std::make_unique<TextCountIndex>(this);
+	}
+}
+
+bool Document::TextCountIndexed() const noexcept {
+	return static_cast<bool>(textCountIndex);
+}
+
+uint64_t Document::ContentHash(Sci::Position start, Sci::Position end) {
+	const ContentHashIndex::Hash hash = contentHashIndex ?
+		contentHashIndex->HashRange(start, end) : ContentHashIndex::HashText(&cb, start, end);
+	return hash.value;
+}
+
+// Whether the text differs from the text at the save point. The undo history decides when
+// it is at the save point but only the hash can tell when the text has been changed back
+// by other actions or after the history was detached from the save point.
+bool Document::ContentModified() {
+	if (cb.IsSavePoint()) {
+		return false;
+	}
+	return !contentHashIndex || !contentHashIndex->MatchesSavePoint();
+}
+
+void Document::SetContentHashIndexed(bool indexed) {
+	if (!indexed) {
+		contentHashIndex.reset();
+	} else if (!contentHashIndex) {
+		contentHashIndex = std::make_unique<ContentHashIndex>(&cb);
+		if (cb.IsSavePoint()) {
+			contentHashIndex->SetSavePoint();
+		}
+	}
+}
+
+bool Document::ContentHashIndexed() const noexcept {
+	return static_cast<bool>(contentHashIndex);
+}
+
+// Append the start and end of each word from start up to end with start treated as the
+// start of a word.
+void Document::ScanWords(Sci::Position start, Sci::Position end, std::vector<Sci::Position> &bounds) const {
+	WithEncodedText([start, end, &bounds](const auto &text) {
+		bool inWord = false;
+		ForEachCharacter(text, start, end, [&bounds, &inWord](Sci::Position position, Sci::Position, bool word) {
+			if (word != inWord) {
+				bounds.push_back(position);
+			}
+			inWord = word;
+		});
+		if (inWord) {
+			bounds.push_back(end);
+		}
+	});
+}
+
+// Words for completion from the index when there is one. Otherwise the whole document is
+// harvested for this request.
+std::vector<std::string> Document::WordsWithPrefix(std::string_view prefix, WordRanking ranking,
+	Sci::Position position, size_t maxWords) {
+	if (wordIndex) {
+		return wordIndex->Words(prefix, ranking, position, maxWords);
+	}
+	WordIndex words(this);
+	return words.Words(prefix, ranking, position, maxWords);
+}
+
+void Document::SetWordIndexed(bool indexed) {
+	if (!indexed) {
+		wordIndex.reset();
+	} else if (!wordIndex) {
+		wordIndex = std::make_unique<WordIndex>(this);
+	}
+}
+
+bool Document::WordIndexed() const noexcept {
+	return static_cast<bool>(wordIndex);
+}
+
 CharacterClass Document::WordCharacterClass(unsigned int ch) const {
 	if (dbcsCodePage && (ch >= 0x80)) {
 		if (CpUtf8 == dbcsCodePage) {
 			// Use hard coded Unicode class
-			const CharacterCategory cc = charMap.CategoryFor(ch);
-			switch (cc) {
-
-				// Separator, Line/Paragraph
-			case ccZl:
-			case ccZp:
-				return CharacterClass::newLine;
-
-				// Separator, Space
-			case ccZs:
-				// Other
-			case ccCc:
-			case ccCf:
-			case ccCs:
-			case ccCo:
-			case ccCn:
-				return CharacterClass::space;
-
-				// Letter
-			case ccLu:
-			case ccLl:
-			case ccLt:
-			case ccLm:
-			case ccLo:
-				// Number
-			case ccNd:
-			case ccNl:
-			case ccNo:
-				// Mark - includes combining diacritics
-			case ccMn:
-			case ccMc:
-			case ccMe:
-				return CharacterClass::word;
-
-				// Punctuation
-			case ccPc:
-			case ccPd:
-			case ccPs:
-			case ccPe:
-			case ccPi:
-			case ccPf:
-			case ccPo:
-				// Symbol
-			case ccSm:
-			case ccSc:
-			case ccSk:
-			case ccSo:
-				return CharacterClass::punctuation;
-
-			}
+			return WordClassFromCategory(charMap.CategoryFor(ch));
 		} else {
 			// Asian DBCS
 			return CharacterClass::word;
@@ -2081,43 +3190,39 @@ Sci::Position Document::ExtendWordSelect(Sci::Position pos, int delta, bool only
 	return MovePositionOutsideChar(pos, delta, true);
 }
 
-/**
- * Find the start of the next word in either a forward (delta >= 0) or backwards direction
- * (delta < 0).
- * This is looking for a transition between character classes although there is also some
- * additional movement to transit white space.
- * Used by cursor movement by word commands.
- */
-Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const {
+namespace {
+
+template <typename Text>
+Sci::Position NextWordStartIn(const Text &text, Sci::Position pos, int delta) {
 	if (delta < 0) {
 		while (pos > 0) {
-			const CharacterExtracted ce = CharacterBefore(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
+			const CharacterExtracted ce = text.CharacterBefore(pos);
+			if (text.WordCharacterClass(ce.character) != CharacterClass::space)
 				break;
 			pos -= ce.widthBytes;
 		}
 		if (pos > 0) {
-			CharacterExtracted ce = CharacterBefore(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
+			CharacterExtracted ce = text.CharacterBefore(pos);
+			const CharacterClass ccStart = text.WordCharacterClass(ce.character);
 			while (pos > 0) {
-				ce = CharacterBefore(pos);
-				if (WordCharacterClass(ce.character) != ccStart)
+				ce = text.CharacterBefore(pos);
+				if (text.WordCharacterClass(ce.character) != ccStart)
 					break;
 				pos -= ce.widthBytes;
 			}
 		}
 	} else {
-		CharacterExtracted ce = CharacterAfter(pos);
-		const CharacterClass ccStart = WordCharacterClass(ce.character);
-		while (pos < LengthNoExcept()) {
-			ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != ccStart)
+		CharacterExtracted ce = text.CharacterAfter(pos);
+		const CharacterClass ccStart = text.WordCharacterClass(ce.character);
+		while (pos < text.Length()) {
+			ce = text.CharacterAfter(pos);
+			if (text.WordCharacterClass(ce.character) != ccStart)
 				break;
 			pos += ce.widthBytes;
 		}
-		while (pos < LengthNoExcept()) {
-			ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
+		while (pos < text.Length()) {
+			ce = text.CharacterAfter(pos);
+			if (text.WordCharacterClass(ce.character) != CharacterClass::space)
 				break;
 			pos += ce.widthBytes;
 		}
@@ -2125,46 +3230,40 @@ Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const {
 	return pos;
 }
 
-/**
- * Find the end of the next word in either a forward (delta >= 0) or backwards direction
- * (delta < 0).
- * This is looking for a transition between character classes although there is also some
- * additional movement to transit white space.
- * Used by cursor movement by word commands.
- */
-Sci::Position Document::NextWordEnd(Sci::Position pos, int delta) const {
+template <typename Text>
+Sci::Position NextWordEndIn(const Text &text, Sci::Position pos, int delta) {
 	if (delta < 0) {
 		if (pos > 0) {
-			CharacterExtracted ce = CharacterBefore(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
+			CharacterExtracted ce = text.CharacterBefore(pos);
+			const CharacterClass ccStart = text.WordCharacterClass(ce.character);
 			if (ccStart != CharacterClass::space) {
 				while (pos > 0) {
-					ce = CharacterBefore(pos);
-					if (WordCharacterClass(ce.character) != ccStart)
+					ce = text.CharacterBefore(pos);
+					if (text.WordCharacterClass(ce.character) != ccStart)
 						break;
 					pos -= ce.widthBytes;
 				}
 			}
 			while (pos > 0) {
-				ce = CharacterBefore(pos);
-				if (WordCharacterClass(ce.character) != CharacterClass::space)
+				ce = text.CharacterBefore(pos);
+				if (text.WordCharacterClass(ce.character) != CharacterClass::space)
 					break;
 				pos -= ce.widthBytes;
 			}
 		}
 	} else {
-		while (pos < LengthNoExcept()) {
-			const CharacterExtracted ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
+		while (pos < text.Length()) {
+			const CharacterExtracted ce = text.CharacterAfter(pos);
+			if (text.WordCharacterClass(ce.character) != CharacterClass::space)
 				break;
 			pos += ce.widthBytes;
 		}
-		if (pos < LengthNoExcept()) {
-			CharacterExtracted ce = CharacterAfter(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
-			while (pos < LengthNoExcept()) {
-				ce = CharacterAfter(pos);
-				if (WordCharacterClass(ce.character) != ccStart)
+		if (pos < text.Length()) {
+			CharacterExtracted ce = text.CharacterAfter(pos);
+			const CharacterClass ccStart = text.WordCharacterClass(ce.character);
+			while (pos < text.Length()) {
+				ce = text.CharacterAfter(pos);
+				if (text.WordCharacterClass(ce.character) != ccStart)
 					break;
 				pos += ce.widthBytes;
 			}
@@ -2173,6 +3272,34 @@ Sci::Position Document::NextWordEnd(Sci::Position pos, int delta) const {
 	return pos;
 }
 
+}
+
+/**
+ * Find the start of the next word in either a forward (delta >= 0) or backwards direction
+ * (delta < 0).
+ * This is looking for a transition between character classes although there is also some
+ * additional movement to transit white space.
+ * Used by cursor movement by word commands.
+ */
+Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const {
+	return WithEncodedText([pos, delta](const auto &text) {
+		return NextWordStartIn(text, pos, delta);
+	});
+}
+
+/**
+ * Find the end of the next word in either a forward (delta >= 0) or backwards direction
+ * (delta < 0).
+ * This is looking for a transition between character classes although there is also some
+ * additional movement to transit white space.
+ * Used by cursor movement by word commands.
+ */
+Sci::Position Document::NextWordEnd(Sci::Position pos, int delta) const {
+	return WithEncodedText([pos, delta](const auto &text) {
+		return NextWordEndIn(text, pos, delta);
+	});
+}
+
 namespace {
 
 constexpr bool IsWordEdge(CharacterClass cc, CharacterClass ccNext) noexcept {
@@ -2341,32 +3468,30 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 					pos++;
 				}
 			} else {
-				while (forward ? (pos < endSearch) : (pos >= endSearch)) {
-					const unsigned char leadByte = cbView.CharAt(pos);
-					if (leadByte == charStartSearch) {
-						bool found = (pos + lengthFind) <= limitPos;
-						// SplitMatch could be called here but it is slower with g++ -O2
-						for (int indexSearch = 1; (indexSearch < lengthFind) && found; indexSearch++) {
-							found = cbView.CharAt(pos + indexSearch) == search[indexSearch];
-						}
-						if (found && MatchesWordOptions(word, wordStart, pos, lengthFind)) {
-							return pos;
-						}
-					}
-					if (forward && UTF8IsAscii(leadByte)) {
-						pos++;
-					} else {
-						if (dbcsCodePage) {
-							if (!NextCharacter(pos, increment)) {
-								break;
+				return WithEncodedText([&](const auto &text) -> Sci::Position {
+					while (forward ? (pos < endSearch) : (pos >= endSearch)) {
+						const unsigned char leadByte = text.UCharAt(pos);
+						if (leadByte == charStartSearch) {
+							bool found = (pos + lengthFind) <= limitPos;
+							// SplitMatch could be called here but it is slower with g++ -O2
+							for (int indexSearch = 1; (indexSearch < lengthFind) && found; indexSearch++) {
+								found = text.UCharAt(pos + indexSearch) == static_cast<unsigned char>(search[indexSearch]);
+							}
+							if (found && MatchesWordOptions(word, wordStart, pos, lengthFind)) {
+								return pos;
 							}
-						} else {
-							pos += increment;
+						}
+						if (forward && UTF8IsAscii(leadByte)) {
+							pos++;
+						} else if (!NextCharacterIn(text, pos, increment)) {
+							break;
 						}
 					}
-				}
+					return -1;
+				});
 			}
 		} else if (CpUtf8 == dbcsCodePage) {
+			const UTF8Text text(cbView, charClass, charMap);
 			constexpr size_t maxFoldingExpansion = 4;
 			std::vector<char> searchThing((lengthFind+1) * UTF8MaxBytes * maxFoldingExpansion + 1);
 			const size_t lenSearch =
@@ -2420,12 +3545,13 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 				if (forward) {
 					pos += widthFirstCharacter;
 				} else {
-					if (!NextCharacter(pos, increment)) {
+					if (!NextCharacterIn(text, pos, increment)) {
 						break;
 					}
 				}
 			}
 		} else if (dbcsCodePage) {
+			const DBCSText text(*this, cbView, charClass);
 			constexpr size_t maxBytesCharacter = 2;
 			constexpr size_t maxFoldingExpansion = 4;
 			std::vector<char> searchThing((lengthFind+1) * maxBytesCharacter * maxFoldingExpansion + 1);
@@ -2475,7 +3601,7 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 				if (forward) {
 					pos += widthFirstCharacter;
 				} else {
-					if (!NextCharacter(pos, increment)) {
+					if (!NextCharacterIn(text, pos, increment)) {
 						break;
 					}
 				}
@@ -2537,10 +3663,22 @@ void Document::AllocateLines(Sci::Line lines) {
 
 void Document::SetDefaultCharClasses(bool includeWordClass) {
 	charClass.SetDefaultCharClasses(includeWordClass);
+	if (textCountIndex) {
+		textCountIndex->Invalidate();
+	}
+	if (wordIndex) {
+		wordIndex->Invalidate();
+	}
 }
 
 void Document::SetCharClasses(const unsigned char *chars, CharacterClass newCharClass) {
 	charClass.SetCharClasses(chars, newCharClass);
+	if (textCountIndex) {
+		textCountIndex->Invalidate();
+	}
+	if (wordIndex) {
+		wordIndex->Invalidate();
+	}
 }
 
 int Document::GetCharsOfClass(CharacterClass characterClass, unsigned char *buffer) const {
@@ -2566,9 +3704,7 @@ bool SCI_METHOD Document::SetStyleFor(Sci_Position length, char style) {
 	enteredStyling++;
 	const Sci::Position prevEndStyled = endStyled;
 	if (cb.SetStyleFor(endStyled, length, style)) {
-		const DocModification mh(ModificationFlags::ChangeStyle | ModificationFlags::User,
-			                prevEndStyled, length);
-		NotifyModified(mh);
+		StylesChanged(prevEndStyled, prevEndStyled + length);
 	}
 	endStyled += length;
 	enteredStyling--;
@@ -2576,30 +3712,60 @@ bool SCI_METHOD Document::SetStyleFor(Sci_Position length, char style) {
 }
 
 bool SCI_METHOD Document::SetStyles(Sci_Position length, const char *styles) {
+	return SetStyleRange(endStyled, length, styles);
+}
+
+void SCI_METHOD Document::BeginStyling() {
+	if (stylingTransaction == 0) {
+		styleChangeStart = Length();
+		styleChangeEnd = 0;
+	}
+	stylingTransaction++;
+}
+
+bool SCI_METHOD Document::SetStyleRange(Sci_Position position, Sci_Position length, const char *styles) {
 	if (enteredStyling != 0) {
 		return false;
 	}
+	PLATFORM_ASSERT(position >= 0 && position + length <= Length());
 	enteredStyling++;
-	bool didChange = false;
-	Sci::Position startMod = 0;
-	Sci::Position endMod = 0;
-	for (int iPos = 0; iPos < length; iPos++, endStyled++) {
-		PLATFORM_ASSERT(endStyled < Length());
-		if (cb.SetStyleAt(endStyled, styles[iPos])) {
-			if (!didChange) {
-				startMod = endStyled;
-			}
-			didChange = true;
-			endMod = endStyled;
+	Sci::Position changeStart = 0;
+	Sci::Position changeEnd = 0;
+	if (cb.SetStyles(position, length, styles, changeStart, changeEnd)) {
+		StylesChanged(changeStart, changeEnd);
+	}
+	endStyled = position + length;
+	enteredStyling--;
+	return true;
+}
+
+void SCI_METHOD Document::EndStyling() {
+	if (stylingTransaction <= 0) {
+		return;
+	}
+	stylingTransaction--;
+	if (stylingTransaction == 0) {
+		const Sci::Position end = std::min(styleChangeEnd, Length());
+		if (styleChangeStart < end) {
+			enteredStyling++;
+			const DocModification mh(ModificationFlags::ChangeStyle | ModificationFlags::User,
+				styleChangeStart, end - styleChangeStart);
+			NotifyModified(mh);
+			enteredStyling--;
 		}
 	}
-	if (didChange) {
+}
+
+// Notify watchers of changed styles immediately or, inside a transaction, when it ends.
+void Document::StylesChanged(Sci::Position start, Sci::Position end) {
+	if (stylingTransaction > 0) {
+		styleChangeStart = std::min(styleChangeStart, start);
+		styleChangeEnd = std::max(styleChangeEnd, end);
+	} else {
 		const DocModification mh(ModificationFlags::ChangeStyle | ModificationFlags::User,
-			                startMod, endMod - startMod + 1);
+			start, end - start);
 		NotifyModified(mh);
 	}
-	enteredStyling--;
-	return true;
 }
 
 void Document::EnsureStyledTo(Sci::Position pos) {
@@ -2610,6 +3776,7 @@ void Document::EnsureStyledTo(Sci::Position pos) {
 			pli->Colourise(endStyledTo, pos);
 		} else {
 			// Ask the watchers to style, and stop as soon as one responds.
+			StylingGroup sg(this);
 			for (std::vector<WatcherWithUserData>::iterator it = watchers.begin();
 				(pos > GetEndStyled()) && (it != watchers.end()); ++it) {
 				it->watcher->NotifyStyleNeeded(this, it->userData, pos);
@@ -2618,6 +3785,102 @@ void Document::EnsureStyledTo(Sci::Position pos) {
 	}
 }
 
+// Style text from semantic tokens delta-encoded as by the Language Server Protocol: 5 integers per
+// token for the line delta, start column delta, length, type and modifiers, with columns in UTF-16
+// code units. Types mapped to a negative style are skipped. Returns the number of tokens styled.
+Sci::Position Document::ApplySemanticTokens(const unsigned int *tokens, size_t length, const std::vector<int> &styleFromType) {
+	struct Span {
+		Sci::Position start;
+		Sci::Position end;
+		char style;
+	};
+	std::vector<Span> spans;
+	spans.reserve(length / 5);
+
+	const bool indexed = FlagSet(LineCharacterIndex(), LineCharacterIndexType::Utf16);
+	const Sci::Line lines = LinesTotal();
+	Sci::Line line = 0;
+	Sci::Position column = 0;
+	// Columns are resolved walking forward from the previous token on the same line
+	Sci::Line lineResolved = -1;
+	Sci::Position lineStart = 0;
+	Sci::Position lineEnd = 0;
+	bool lineSingleUnits = false;
+	Sci::Position columnResolved = 0;
+	Sci::Position positionResolved = 0;
+	auto resolve = [&](Sci::Position columnWanted) noexcept {
+		if (lineSingleUnits) {
+			return std::min(lineStart + columnWanted, lineEnd);
+		}
+		if (columnWanted < columnResolved) {
+			columnResolved = 0;
+			positionResolved = lineStart;
+		}
+		const Sci::Position pos = GetRelativePositionUTF16(positionResolved, columnWanted - columnResolved);
+		if (pos == Sci::invalidPosition || pos > lineEnd) {
+			return lineEnd;
+		}
+		columnResolved = columnWanted;
+		positionResolved = pos;
+		return pos;
+	};
+
+	for (size_t i = 0; i + 5 <= length; i += 5) {
+		const unsigned int deltaLine = tokens[i];
+		line += deltaLine;
+		column = (deltaLine ? 0 : column) + tokens[i + 1];
+		if (line >= lines) {
+			break;
+		}
+		const unsigned int type = tokens[i + 3];
+		const int style = (type < styleFromType.size()) ? styleFromType[type] : -1;
+		if (style < 0) {
+			continue;
+		}
+		if (line != lineResolved) {
+			lineResolved = line;
+			lineStart = LineStart(line);
+			lineEnd = LineEnd(line);
+			columnResolved = 0;
+			positionResolved = lineStart;
+			// When the line has as many UTF-16 code units as bytes, columns are byte offsets
+			lineSingleUnits = (dbcsCodePage == 0) ||
+				(indexed && (IndexLineStart(line + 1, LineCharacterIndexType::Utf16) -
+					IndexLineStart(line, LineCharacterIndexType::Utf16) == LineStart(line + 1) - lineStart));
+		}
+		const Sci::Position start = resolve(column);
+		const Sci::Position end = resolve(column + tokens[i + 2]);
+		if (start < end) {
+			spans.push_back({ start, end, static_cast<char>(style) });
+		}
+	}
+	if (spans.empty()) {
+		return 0;
+	}
+
+	// Lexing after the tokens are applied would overwrite them so style first then
+	// write all the tokens as one range, leaving the end of styling where it was.
+	Sci::Position first = spans.front().start;
+	Sci::Position last = spans.front().end;
+	for (const Span &span : spans) {
+		first = std::min(first, span.start);
+		last = std::max(last, span.end);
+	}
+	EnsureStyledTo(last);
+	const Sci::Position endStyledBefore = endStyled;
+	std::vector<char> styles(last - first);
+	GetStyleRange(reinterpret_cast<unsigned char *>(styles.data()), first, last - first);
+	for (const Span &span : spans) {
+		std::fill(styles.begin() + (span.start - first), styles.begin() + (span.end - first), span.style);
+	}
+	{
+		StylingGroup sg(this);
+		SetStyleRange(first, last - first, styles.data());
+	}
+	endStyled = endStyledBefore;
+	return static_cast<Sci::Position>(spans.size());
+}
+
 void Document::StyleToAdjustingLineDuration(Sci::Position pos) {
 	const Sci::Position stylingStart = GetEndStyled();
 	ElapsedPeriod epStyling;
@@ -2864,8 +4127,42 @@ void Document::NotifyGroupCompleted() noexcept {
 void Document::NotifyModified(DocModification mh) {
 	if (FlagSet(mh.modificationType, ModificationFlags::InsertText)) {
 		decorations->InsertSpace(mh.position, mh.length);
+		if (braceIndex) {
+			braceIndex->InsertText(mh.position, mh.length);
+		}
+		if (textCountIndex) {
+			textCountIndex->InsertText(mh.position, mh.length);
+		}
+		if (contentHashIndex) {
+			contentHashIndex->InsertText(mh.position, mh.length);
+		}
+		if (wordIndex) {
+			wordIndex->InsertText(mh.position, mh.length);
+		}
+		if (columnIndex) {
+			const Sci::Line line = SciLineFromPosition(mh.position);
+			columnIndex->TextChanged(line, mh.position - LineStart(line), mh.linesAdded);
+		}
 	} else if (FlagSet(mh.modificationType, ModificationFlags::DeleteText)) {
 		decorations->DeleteRange(mh.position, mh.length);
+		if (braceIndex) {
+			braceIndex->DeleteText(mh.position, mh.length);
+		}
+		if (textCountIndex) {
+			textCountIndex->DeleteText(mh.position, mh.length);
+		}
+		if (contentHashIndex) {
+			contentHashIndex->DeleteText(mh.position, mh.length);
+		}
+		if (wordIndex) {
+			wordIndex->DeleteText(mh.position, mh.length);
+		}
+		if (columnIndex) {
+			const Sci::Line line = SciLineFromPosition(mh.position);
+			columnIndex->TextChanged(line, mh.position - LineStart(line), mh.linesAdded);
+		}
+	} else if (FlagSet(mh.modificationType, ModificationFlags::ChangeStyle) && braceIndex) {
+		braceIndex->StylesChanged(mh.position, mh.length);
 	}
 	for (const WatcherWithUserData &watcher : watchers) {
 		watcher.watcher->NotifyModified(this, mh, watcher.userData);
@@ -3008,36 +4305,76 @@ constexpr char BraceOpposite(char ch) noexcept {
 
 // TODO: should be able to extend styled region to find matching brace
 Sci::Position Document::BraceMatch(Sci::Position position, Sci::Position /*maxReStyle*/, Sci::Position startPos, bool useStartPos) noexcept {
-	const unsigned char chBrace = CharAt(position);
-	const unsigned char chSeek = BraceOpposite(chBrace);
+	const char chBrace = CharAt(position);
+	const char chSeek = BraceOpposite(chBrace);
 	if (chSeek == '\0')
 		return -1;
 	const int styBrace = StyleIndexAt(position);
 	int direction = -1;
 	if (chBrace == '(' || chBrace == '[' || chBrace == '{' || chBrace == '<')
 		direction = 1;
-	int depth = 1;
-	position = useStartPos ? startPos : position + direction;
+	return BraceFind(chBrace, chSeek, styBrace, direction, useStartPos ? startPos : position + direction);
+}
+
+// Find the innermost (, [ or { before position that is not closed before position.
+// Only braces with style count unless style is negative.
+Sci::Position Document::BraceEnclosing(Sci::Position position, int style) noexcept {
+	Sci::Position enclosing = -1;
+	for (const char chOpen : { '(', '[', '{' }) {
+		enclosing = std::max(enclosing, BraceFind(BraceOpposite(chOpen), chOpen, style, -1, position - 1));
+	}
+	return enclosing;
+}
 
+void Document::SetBraceIndexed(bool indexed) {
+	if (!indexed) {
+		braceIndex.reset();
+	} else if (!braceIndex) {
+		braceIndex = std::make_unique<BraceIndex>(&cb);
+	}
+}
+
+bool Document::BraceIndexed() const noexcept {
+	return static_cast<bool>(braceIndex);
+}
+
+// Move from position in direction until the chSeek that brings depth back to 0.
+// Braces after the end of styling count whatever their style.
+Sci::Position Document::BraceFind(char chBrace, char chSeek, int style, int direction, Sci::Position position) const noexcept {
 	// Avoid using MovePositionOutsideChar to check DBCS trail byte
 	unsigned char maxSafeChar = 0xff;
 	if (dbcsCodePage != 0 && dbcsCodePage != CpUtf8) {
 		maxSafeChar = std::max<unsigned char>(DBCSMinTrailByte(), 1) - 1;
 	}
 
-	while ((position >= 0) && (position < LengthNoExcept())) {
-		const unsigned char chAtPos = CharAt(position);
-		if (chAtPos == chBrace || chAtPos == chSeek) {
-			if (((position > GetEndStyled()) || (StyleIndexAt(position) == styBrace)) &&
-				(chAtPos <= maxSafeChar || position == MovePositionOutsideChar(position, direction, false))) {
-				depth += (chAtPos == chBrace) ? 1 : -1;
-				if (depth == 0)
-					return position;
-			}
+	// Braces may be DBCS trail bytes so are only indexed for other encodings and
+	// summaries are stale while a styling transaction holds back its notification
+	if (braceIndex && (maxSafeChar == 0xff) && (stylingTransaction == 0)) {
+		try {
+			return braceIndex->Find(chBrace, chSeek, style, direction, position, GetEndStyled());
+		} catch (const std::bad_alloc &) {
+			// Scan instead
 		}
-		position += direction;
 	}
-	return -1;
+
+	const unsigned char uchBrace = chBrace;
+	const unsigned char uchSeek = chSeek;
+	int depth = 1;
+	return WithEncodedText([&](const auto &text) -> Sci::Position {
+		while ((position >= 0) && (position < text.Length())) {
+			const unsigned char chAtPos = text.UCharAt(position);
+			if (chAtPos == uchBrace || chAtPos == uchSeek) {
+				if (((style < 0) || (position > GetEndStyled()) || (StyleIndexAt(position) == style)) &&
+					(chAtPos <= maxSafeChar || text.IsCharacterStart(position, direction))) {
+					depth += (chAtPos == uchBrace) ? 1 : -1;
+					if (depth == 0)
+						return position;
+				}
+			}
+			position += direction;
+		}
+		return -1;
+	});
 }
 
 /**
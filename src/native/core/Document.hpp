@@ -25,6 +25,11 @@ class LineMarkers;
 class LineLevels;
 class LineState;
 class LineAnnotation;
+class BraceIndex;
+class TextCountIndex;
+class ContentHashIndex;
+class ColumnIndex;
+class WordIndex;
 
 enum class EncodingFamily { eightBit, unicode, dbcs };
 
@@ -146,6 +151,7 @@ protected:
 	Document *pdoc;
 	LexerInstance instance;
 	bool performingStyle;	///< Prevent reentrance
+	void ColouriseChunks(Hyperion::ILexer5Restartable *restartable, Sci::Position start, Sci::Position end);
 public:
 	explicit LexInterface(Document *pdoc_) noexcept;
 	// Deleted so LexInterface objects can not be copied.
@@ -185,6 +191,28 @@ public:
 	size_t ActionsInAllowedTime(double secondsAllowed) const noexcept;
 };
 
+/**
+ * Counts of the characters, UTF-16 code units and words in a range of text.
+ * A word is a run of characters in the word class.
+ */
+struct TextCounts {
+	Sci::Position characters = 0;
+	Sci::Position codeUnits = 0;
+	Sci::Position words = 0;
+
+	TextCounts &operator+=(const TextCounts &other) noexcept {
+		characters += other.characters;
+		codeUnits += other.codeUnits;
+		words += other.words;
+		return *this;
+	}
+	TextCounts operator+(const TextCounts &other) const noexcept {
+		TextCounts sum = *this;
+		sum += other;
+		return sum;
+	}
+};
+
 /**
  * A whole character (code point) with a value and width in bytes.
  * For UTF-8, the value is the code point value.
@@ -212,7 +240,7 @@ bool DiscardLastCombinedCharacter(std::string_view &text) noexcept;
 
 /**
  */
-class Document : PerLine, public Hyperion::IDocument, public Hyperion::ILoader, public Hyperion::IDocumentEditable {
+class Document : PerLine, public Hyperion::IDocumentStyling, public Hyperion::ILoader, public Hyperion::IDocumentEditable {
 
 public:
 	/** Used to pair watcher pointer with user data. */
@@ -237,6 +265,9 @@ private:
 	int styleClock;
 	int enteredModification;
 	int enteredStyling;
+	int stylingTransaction;
+	Sci::Position styleChangeStart;	///< Styles changed in the current transaction
+	Sci::Position styleChangeEnd;
 	int enteredReadOnlyCount;
 
 	bool insertionSet;
@@ -256,9 +287,20 @@ private:
 
 	std::unique_ptr<RegexSearchBase> regex;
 	std::unique_ptr<LexInterface> pli;
+	std::unique_ptr<BraceIndex> braceIndex;
+	std::unique_ptr<TextCountIndex> textCountIndex;
+	std::unique_ptr<ContentHashIndex> contentHashIndex;
+	mutable std::unique_ptr<ColumnIndex> columnIndex;	///< Cache filled by GetColumn which is const
+	std::unique_ptr<WordIndex> wordIndex;
 
 	std::map<void *, ViewStateShared>viewData;
 
+	// Call operation with a character navigator specialized for the document's encoding
+	template <typename Operation>
+	auto WithEncodedText(Operation operation) const;
+
+	Sci::Position BraceFind(char chBrace, char chSeek, int style, int direction, Sci::Position position) const noexcept;
+
 public:
 
 	Hyperion::EndOfLine eolMode;
@@ -299,7 +341,7 @@ public:
 	Hyperion::LineEndType GetLineEndTypesActive() const noexcept { return cb.GetLineEndTypes(); }
 
 	int SCI_METHOD Version() const override {
-		return Hyperion::dvRelease4;
+		return Hyperion::dvRelease5Styling;
 	}
 	int SCI_METHOD DEVersion() const noexcept override;
 
@@ -334,6 +376,7 @@ public:
 	void ModifiedAt(Sci::Position pos) noexcept;
 	void CheckReadOnly();
 	void TrimReplacement(std::string_view &text, Range &range) const noexcept;
+	Sci::Position ReloadText(std::string_view text);
 	bool DeleteChars(Sci::Position pos, Sci::Position len);
 	Sci::Position InsertString(Sci::Position position, const char *s, Sci::Position insertLength);
 	Sci::Position InsertString(Sci::Position position, std::string_view sv);
@@ -386,6 +429,7 @@ public:
 
 	const char *SCI_METHOD BufferPointer() override { return cb.BufferPointer(); }
 	const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept { return cb.RangePointer(position, rangeLength); }
+	SplitView AllView() const noexcept { return cb.AllView(); }
 	Sci::Position GapPosition() const noexcept { return cb.GapPosition(); }
 
 	int SCI_METHOD GetLineIndentation(Sci_Position line) override;
@@ -394,8 +438,24 @@ public:
 	Sci::Position GetColumn(Sci::Position pos) const;
 	Sci::Position CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept;
 	Sci::Position CountUTF16(Sci::Position startPos, Sci::Position endPos) const noexcept;
+	TextCounts ScanTextCounts(Sci::Position start, Sci::Position end) const noexcept;
+	TextCounts CountText(Sci::Position start, Sci::Position end);
+	void SetTextCountIndexed(bool indexed);
+	bool TextCountIndexed() const noexcept;
+	uint64_t ContentHash(Sci::Position start, Sci::Position end);
+	bool ContentModified();
+	void SetContentHashIndexed(bool indexed);
+	bool ContentHashIndexed() const noexcept;
+	void ScanWords(Sci::Position start, Sci::Position end, std::vector<Sci::Position> &bounds) const;
+	std::vector<std::string> WordsWithPrefix(std::string_view prefix, Hyperion::WordRanking ranking,
+		Sci::Position position, size_t maxWords);
+	void SetWordIndexed(bool indexed);
+	bool WordIndexed() const noexcept;
+	Sci::Position ConvertPositions(Hyperion::PositionUnit unitsFrom, Hyperion::PositionUnit unitsTo,
+		const Sci::Position *positionsFrom, Sci::Position *positionsTo, Sci::Position count) const;
 	Sci::Position FindColumn(Sci::Line line, Sci::Position column);
 	void Indent(bool forwards, Sci::Line lineBottom, Sci::Line lineTop);
+	void NormalizeWhitespace(Sci::Line lineFirst, Sci::Line lineLast, Hyperion::Normalize options, int indentLevels);
 	static std::string TransformLineEnds(const char *s, size_t len, Hyperion::EndOfLine eolModeWanted);
 	void ConvertLineEnds(Hyperion::EndOfLine eolModeSet);
 	std::string_view EOLString() const noexcept;
@@ -480,9 +540,13 @@ public:
 	void SCI_METHOD StartStyling(Sci_Position position) override;
 	bool SCI_METHOD SetStyleFor(Sci_Position length, char style) override;
 	bool SCI_METHOD SetStyles(Sci_Position length, const char *styles) override;
+	void SCI_METHOD BeginStyling() override;
+	bool SCI_METHOD SetStyleRange(Sci_Position position, Sci_Position length, const char *styles) override;
+	void SCI_METHOD EndStyling() override;
 	Sci::Position GetEndStyled() const noexcept { return endStyled; }
 	void EnsureStyledTo(Sci::Position pos);
 	void StyleToAdjustingLineDuration(Sci::Position pos);
+	Sci::Position ApplySemanticTokens(const unsigned int *tokens, size_t length, const std::vector<int> &styleFromType);
 	int GetStyleClock() const noexcept { return styleClock; }
 	void IncrementStyleClock() noexcept;
 	void SCI_METHOD DecorationSetCurrentIndicator(int indicator) override;
@@ -530,12 +594,16 @@ public:
 	Sci::Position ParaDown(Sci::Position pos) const;
 	int IndentSize() const noexcept { return actualIndentInChars; }
 	Sci::Position BraceMatch(Sci::Position position, Sci::Position maxReStyle, Sci::Position startPos, bool useStartPos) noexcept;
+	Sci::Position BraceEnclosing(Sci::Position position, int style) noexcept;
+	void SetBraceIndexed(bool indexed);
+	bool BraceIndexed() const noexcept;
 
 private:
 	void NotifyModifyAttempt();
 	void NotifySavePoint(bool atSavePoint);
 	void NotifyGroupCompleted() noexcept;
 	void NotifyModified(DocModification mh);
+	void StylesChanged(Sci::Position start, Sci::Position end);
 };
 
 class UndoGroup {
@@ -566,6 +634,27 @@ public:
 	}
 };
 
+/**
+ * Gather style changes made while in scope into one notification, ending the styling
+ * transaction even when styling throws so later changes are not held back for ever.
+ */
+class StylingGroup {
+	Document *pdoc;
+public:
+	explicit StylingGroup(Document *pdoc_) noexcept : pdoc(pdoc_) {
+		pdoc->BeginStyling();
+	}
+	// Deleted so StylingGroup objects can not be copied.
+	StylingGroup(const StylingGroup &) = delete;
+	StylingGroup(StylingGroup &&) = delete;
+	void operator=(const StylingGroup &) = delete;
+	StylingGroup &operator=(StylingGroup &&) = delete;
+	~StylingGroup() {
+		// As with UndoGroup, a watcher throwing from the notification sent here is fatal.
+		pdoc->EndStyling();
+	}
+};
+
 
 /**
  * To optimise processing of document modifications by DocWatchers, a hint is passed indicating the
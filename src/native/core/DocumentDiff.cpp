@@ -0,0 +1,131 @@
+// Hyperion source code edit control
+/** @file DocumentDiff.cpp
+ ** Compare the lines of two documents for side by side views.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/ILoader.hpp"
+#include "../include/ILexer.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../syntax/CharacterCategoryMap.hpp"
+#include "../platform/Position.hpp"
+#include "../syntax/CharClassify.hpp"
+#include "../view/Decoration.hpp"
+#include "../syntax/CaseFolder.hpp"
+#include "../platform/ElapsedPeriod.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "RunStyles.hpp"
+#include "CellBuffer.hpp"
+#include "Document.hpp"
+#include "LineDiff.hpp"
+#include "DocumentDiff.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+std::vector<size_t> LineStarts(const Document *pdoc) {
+	const Sci::Line lines = pdoc->LinesTotal();
+	std::vector<size_t> starts(lines + 1);
+	for (Sci::Line line = 0; line < lines; line++) {
+		starts[line] = pdoc->LineStart(line);
+	}
+	starts[lines] = pdoc->Length();
+	return starts;
+}
+
+void AddChange(std::vector<Range> &changes, Sci::Position start, Sci::Position end) {
+	if (start >= end) {
+		return;
+	}
+	if (!changes.empty() && (changes.back().end == start)) {
+		changes.back().end = end;
+	} else {
+		changes.emplace_back(start, end);
+	}
+}
+
+}
+
+DocumentDiff::DocumentDiff(Document *pdoc, Document *pdocOther, bool minimal, bool intraLine, double timeout) {
+	ElapsedPeriod elapsed;
+	const std::string_view text(pdoc->BufferPointer(), pdoc->Length());
+	const std::string_view textOther(pdocOther->BufferPointer(), pdocOther->Length());
+	const std::vector<size_t> starts = LineStarts(pdoc);
+	const std::vector<size_t> startsOther = LineStarts(pdocOther);
+
+	hunks = DiffLines(HashLines(text, starts), HashLines(textOther, startsOther), minimal, timeout);
+	if (!SameOutsideHunks(text, starts, textOther, startsOther, hunks)) {
+		// Lines with the same hash differ so show everything as changed
+		hunks = { DiffHunk{ 0, starts.size() - 1, 0, startsOther.size() - 1 } };
+	}
+
+	for (const DiffHunk &hunk : hunks) {
+		size_t line = hunk.startA;
+		const size_t paired = intraLine ? std::min(hunk.lengthA, hunk.lengthB) : 0;
+		for (size_t pair = 0; pair < paired; pair++, line++) {
+			const std::string_view lineText = text.substr(starts[line], starts[line + 1] - starts[line]);
+			const size_t lineOther = hunk.startB + pair;
+			const std::string_view lineTextOther = textOther.substr(startsOther[lineOther],
+				startsOther[lineOther + 1] - startsOther[lineOther]);
+			if ((timeout > 0.0) && (elapsed.Duration() > timeout)) {
+				AddChange(changes, starts[line], starts[line + 1]);
+				continue;
+			}
+			const std::vector<size_t> tokens = TokenStartsOf(lineText);
+			const std::vector<size_t> tokensOther = TokenStartsOf(lineTextOther);
+			const std::vector<DiffHunk> words = DiffLines(HashLines(lineText, tokens), HashLines(lineTextOther, tokensOther), true);
+			if (!SameOutsideHunks(lineText, tokens, lineTextOther, tokensOther, words)) {
+				AddChange(changes, starts[line], starts[line + 1]);
+				continue;
+			}
+			for (const DiffHunk &word : words) {
+				AddChange(changes, starts[line] + tokens[word.startA], starts[line] + tokens[word.startA + word.lengthA]);
+			}
+		}
+		for (; line < hunk.startA + hunk.lengthA; line++) {
+			AddChange(changes, starts[line], starts[line + 1]);
+		}
+	}
+}
+
+Sci::Line DocumentDiff::AlignedLine(Sci::Line line) const noexcept {
+	if (line < 0) {
+		return -1;
+	}
+	const size_t lineDiff = line;
+	// First hunk that ends after line
+	const auto it = std::upper_bound(hunks.begin(), hunks.end(), lineDiff, [](size_t position, const DiffHunk &hunk) noexcept {
+		return position < hunk.startA + hunk.lengthA;
+	});
+	if ((it != hunks.end()) && (it->startA <= lineDiff)) {
+		const size_t offset = lineDiff - it->startA;
+		return (offset < it->lengthB) ? static_cast<Sci::Line>(it->startB + offset) : -1;
+	}
+	if (it == hunks.begin()) {
+		return line;
+	}
+	const DiffHunk &before = *(it - 1);
+	return static_cast<Sci::Line>(lineDiff - (before.startA + before.lengthA) + before.startB + before.lengthB);
+}
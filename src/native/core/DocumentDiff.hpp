@@ -0,0 +1,29 @@
+// Hyperion source code edit control
+/** @file DocumentDiff.hpp
+ ** Compare the lines of two documents for side by side views.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * The differences between a document and another document at the time of comparison.
+ * Hunks are in lines of the two documents and changes are the text of the first
+ * document that differs, either words inside a line paired with a line of the other
+ * document or whole lines.
+ */
+class DocumentDiff {
+public:
+	std::vector<DiffHunk> hunks;
+	std::vector<Range> changes;
+
+	/// When intraLine, the lines paired inside each hunk are compared by word.
+	DocumentDiff(Document *pdoc, Document *pdocOther, bool minimal, bool intraLine, double timeout);
+
+	/// The line of the other document shown beside line or -1 when there is none.
+	Sci::Line AlignedLine(Sci::Line line) const noexcept;
+};
+
+}
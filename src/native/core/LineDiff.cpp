@@ -0,0 +1,338 @@
+// Hyperion source code edit control
+/** @file LineDiff.cpp
+ ** Find the lines that differ between two texts.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+#include <chrono>
+#include <thread>
+#include <future>
+
+#include "../platform/ElapsedPeriod.hpp"
+#include "LineDiff.hpp"
+
+namespace Hyperion::Internal {
+
+namespace {
+
+// Gaps needing more edits than this are replaced whole to bound time and memory.
+constexpr ptrdiff_t maximumEditCost = 1000;
+
+// Large gaps are split using a sample of lines so the table of lines stays in cache.
+constexpr size_t linesSampled = 0x4000;
+
+// Texts with fewer lines than this are hashed on the calling thread.
+constexpr size_t linesToHashInParallel = 0x10000;
+
+struct Gap {
+	size_t startA;
+	size_t endA;
+	size_t startB;
+	size_t endB;
+};
+
+void AddHunk(std::vector<DiffHunk> &hunks, size_t startA, size_t endA, size_t startB, size_t endB) {
+	if ((startA == endA) && (startB == endB)) {
+		return;
+	}
+	if (!hunks.empty()) {
+		DiffHunk &last = hunks.back();
+		if ((last.startA + last.lengthA == startA) && (last.startB + last.lengthB == startB)) {
+			last.lengthA += endA - startA;
+			last.lengthB += endB - startB;
+			return;
+		}
+	}
+	hunks.push_back({ startA, endA - startA, startB, endB - startB });
+}
+
+// Myers' greedy O(ND) algorithm. The furthest reaching x on each diagonal k is kept for
+// every cost d so the edits can be recovered by walking back from the end.
+bool DiffMyers(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b, const Gap &gap, std::vector<DiffHunk> &hunks) {
+	const ptrdiff_t n = gap.endA - gap.startA;
+	const ptrdiff_t m = gap.endB - gap.startB;
+	const ptrdiff_t maxCost = std::min(n + m, maximumEditCost);
+	const ptrdiff_t offset = maxCost + 1;
+	std::vector<ptrdiff_t> v(2 * offset + 1);
+	std::vector<std::vector<ptrdiff_t>> trace;	// Diagonals -d-1 to d+1 for each cost
+	for (ptrdiff_t d = 0; d <= maxCost; d++) {
+		for (ptrdiff_t k = -d; k <= d; k += 2) {
+			ptrdiff_t x = ((k == -d) || ((k != d) && (v[offset + k - 1] < v[offset + k + 1]))) ?
+				v[offset + k + 1] : v[offset + k - 1] + 1;
+			ptrdiff_t y = x - k;
+			while ((x < n) && (y < m) && (a[gap.startA + x] == b[gap.startB + y])) {
+				x++;
+				y++;
+			}
+			v[offset + k] = x;
+			if ((x >= n) && (y >= m)) {
+				// Walk back collecting single line edits then merge them forwards
+				std::vector<Gap> edits;
+				x = n;
+				y = m;
+				for (ptrdiff_t dBack = d; dBack > 0; dBack--) {
+					const std::vector<ptrdiff_t> &previous = trace[dBack - 1];
+					const ptrdiff_t kBack = x - y;
+					const auto previousX = [&](ptrdiff_t kPrevious) {
+						return previous[kPrevious + dBack];
+					};
+					const bool down = (kBack == -dBack) ||
+						((kBack != dBack) && (previousX(kBack - 1) < previousX(kBack + 1)));
+					const ptrdiff_t kPrevious = down ? kBack + 1 : kBack - 1;
+					const ptrdiff_t xPrevious = previousX(kPrevious);
+					const ptrdiff_t yPrevious = xPrevious - kPrevious;
+					if (down) {
+						edits.push_back({ static_cast<size_t>(xPrevious), static_cast<size_t>(xPrevious),
+							static_cast<size_t>(yPrevious), static_cast<size_t>(yPrevious + 1) });
+					} else {
+						edits.push_back({ static_cast<size_t>(xPrevious), static_cast<size_t>(xPrevious + 1),
+							static_cast<size_t>(yPrevious), static_cast<size_t>(yPrevious) });
+					}
+					x = xPrevious;
+					y = yPrevious;
+				}
+				for (auto it = edits.rbegin(); it != edits.rend(); ++it) {
+					AddHunk(hunks, gap.startA + it->startA, gap.startA + it->endA,
+						gap.startB + it->startB, gap.startB + it->endB);
+				}
+				return true;
+			}
+		}
+		trace.emplace_back(v.begin() + offset - d - 1, v.begin() + offset + d + 2);
+	}
+	return false;
+}
+
+// Hash 8 bytes at a time as lines are compared in bulk.
+uint64_t HashLine(std::string_view text) noexcept {
+	constexpr uint64_t multiplier = 0x9e3779b97f4a7c15ULL;
+	uint64_t hash = text.length() * multiplier;
+	size_t position = 0;
+	for (; position + 8 <= text.length(); position += 8) {
+		uint64_t chunk = 0;
+		memcpy(&chunk, text.data() + position, 8);
+		hash = ((hash ^ chunk) * multiplier);
+		hash ^= hash >> 29;
+	}
+	uint64_t tail = 0;
+	memcpy(&tail, text.data() + position, text.length() - position);
+	hash = (hash ^ tail) * multiplier;
+	return hash ^ (hash >> 32);
+}
+
+struct Occurrence {
+	size_t countA = 0;
+	size_t countB = 0;
+	size_t positionA = 0;
+	size_t positionB = 0;
+};
+
+// Pairs of positions of lines that occur once in each side of the gap and whose order
+// agrees on both sides, found as the longest increasing subsequence of positionB.
+// Only lines with hashes that have no bits in common with sampleMask are considered.
+// As equal lines have equal hashes, a sampled line is unique among all lines when it is
+// unique among the sampled lines, so a large gap can be split with a small table.
+std::vector<std::pair<size_t, size_t>> UniqueAnchors(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b, const Gap &gap,
+	uint64_t sampleMask) {
+	std::unordered_map<uint64_t, Occurrence> occurrences;
+	occurrences.reserve((gap.endA - gap.startA) / (sampleMask + 1) + 1);
+	for (size_t position = gap.startA; position < gap.endA; position++) {
+		if ((a[position] & sampleMask) == 0) {
+			Occurrence &occurrence = occurrences[a[position]];
+			occurrence.countA++;
+			occurrence.positionA = position;
+		}
+	}
+	for (size_t position = gap.startB; position < gap.endB; position++) {
+		if ((b[position] & sampleMask) == 0) {
+			const auto it = occurrences.find(b[position]);
+			if (it != occurrences.end()) {
+				it->second.countB++;
+				it->second.positionB = position;
+			}
+		}
+	}
+	std::vector<std::pair<size_t, size_t>> unique;
+	for (size_t position = gap.startA; position < gap.endA; position++) {
+		if ((a[position] & sampleMask) == 0) {
+			const Occurrence &occurrence = occurrences[a[position]];
+			if ((occurrence.countA == 1) && (occurrence.countB == 1)) {
+				unique.emplace_back(occurrence.positionA, occurrence.positionB);
+			}
+		}
+	}
+
+	// Patience sorting: tails[i] is the index in unique of the smallest end of an
+	// increasing run of length i+1 and predecessors links each element to the one before.
+	std::vector<size_t> tails;
+	std::vector<size_t> predecessors(unique.size());
+	for (size_t i = 0; i < unique.size(); i++) {
+		const auto it = std::lower_bound(tails.begin(), tails.end(), unique[i].second, [&unique](size_t tail, size_t positionB) noexcept {
+			return unique[tail].second < positionB;
+		});
+		predecessors[i] = (it == tails.begin()) ? SIZE_MAX : *(it - 1);
+		if (it == tails.end()) {
+			tails.push_back(i);
+		} else {
+			*it = i;
+		}
+	}
+	std::vector<std::pair<size_t, size_t>> anchors;
+	for (size_t i = tails.empty() ? SIZE_MAX : tails.back(); i != SIZE_MAX; i = predecessors[i]) {
+		anchors.push_back(unique[i]);
+	}
+	std::reverse(anchors.begin(), anchors.end());
+	return anchors;
+}
+
+}
+
+std::vector<size_t> LineStartsOf(std::string_view text) {
+	std::vector<size_t> starts;
+	starts.push_back(0);
+	for (size_t position = 0; position < text.length(); position++) {
+		const char ch = text[position];
+		if ((ch == '\n') || ((ch == '\r') && ((position + 1 >= text.length()) || (text[position + 1] != '\n')))) {
+			starts.push_back(position + 1);
+		}
+	}
+	if (starts.back() != text.length()) {
+		starts.push_back(text.length());
+	}
+	return starts;
+}
+
+std::vector<size_t> TokenStartsOf(std::string_view text) {
+	const auto kind = [](char ch) noexcept {
+		if ((ch == ' ') || (ch == '\t')) {
+			return 1;
+		}
+		const unsigned char uch = ch;
+		if ((uch >= 0x80) || (ch == '_') || ((ch >= '0') && (ch <= '9')) ||
+			((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z'))) {
+			return 2;
+		}
+		return 0;
+	};
+	std::vector<size_t> starts;
+	for (size_t position = 0; position < text.length(); position++) {
+		if ((position == 0) || (kind(text[position]) == 0) || (kind(text[position]) != kind(text[position - 1]))) {
+			starts.push_back(position);
+		}
+	}
+	starts.push_back(text.length());
+	return starts;
+}
+
+std::vector<uint64_t> HashLines(std::string_view text, const std::vector<size_t> &starts) {
+	std::vector<uint64_t> hashes(starts.size() - 1);
+	const auto hashRange = [text, &starts, &hashes](size_t first, size_t last) noexcept {
+		for (size_t line = first; line < last; line++) {
+			hashes[line] = HashLine(text.substr(starts[line], starts[line + 1] - starts[line]));
+		}
+	};
+	// Short texts, such as the words of one line, avoid the cost of asking for the number of threads
+	if (hashes.size() < linesToHashInParallel) {
+		hashRange(0, hashes.size());
+		return hashes;
+	}
+	const size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+	const size_t chunks = std::min<size_t>(threads, hashes.size() / (linesToHashInParallel / 4));
+	if (chunks <= 1) {
+		hashRange(0, hashes.size());
+		return hashes;
+	}
+	std::vector<std::future<void>> futures;
+	for (size_t chunk = 0; chunk < chunks; chunk++) {
+		futures.push_back(std::async(std::launch::async, hashRange,
+			hashes.size() * chunk / chunks, hashes.size() * (chunk + 1) / chunks));
+	}
+	for (std::future<void> &f : futures) {
+		f.wait();
+	}
+	for (std::future<void> &f : futures) {
+		f.get();
+	}
+	return hashes;
+}
+
+bool SameOutsideHunks(std::string_view textA, const std::vector<size_t> &startsA,
+	std::string_view textB, const std::vector<size_t> &startsB, const std::vector<DiffHunk> &hunks) {
+	size_t lineA = 0;
+	size_t lineB = 0;
+	const auto same = [&](size_t endA, size_t endB) {
+		return textA.substr(startsA[lineA], startsA[endA] - startsA[lineA]) ==
+			textB.substr(startsB[lineB], startsB[endB] - startsB[lineB]);
+	};
+	for (const DiffHunk &hunk : hunks) {
+		if (!same(hunk.startA, hunk.startB)) {
+			return false;
+		}
+		lineA = hunk.startA + hunk.lengthA;
+		lineB = hunk.startB + hunk.lengthB;
+	}
+	return same(startsA.size() - 1, startsB.size() - 1);
+}
+
+std::vector<DiffHunk> DiffLines(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b, bool minimal, double timeout) {
+	ElapsedPeriod elapsed;
+	std::vector<DiffHunk> hunks;
+	// Gaps are handled depth first from a stack, pushed in reverse so hunks come out in order
+	std::vector<Gap> gaps{ { 0, a.size(), 0, b.size() } };
+	while (!gaps.empty()) {
+		Gap gap = gaps.back();
+		gaps.pop_back();
+		while ((gap.startA < gap.endA) && (gap.startB < gap.endB) && (a[gap.startA] == b[gap.startB])) {
+			gap.startA++;
+			gap.startB++;
+		}
+		while ((gap.startA < gap.endA) && (gap.startB < gap.endB) && (a[gap.endA - 1] == b[gap.endB - 1])) {
+			gap.endA--;
+			gap.endB--;
+		}
+		if ((gap.startA == gap.endA) || (gap.startB == gap.endB) ||
+			((timeout > 0.0) && (elapsed.Duration() > timeout))) {
+			AddHunk(hunks, gap.startA, gap.endA, gap.startB, gap.endB);
+			continue;
+		}
+		if (minimal && DiffMyers(a, b, gap, hunks)) {
+			continue;
+		}
+		// Sample large gaps down to about linesSampled lines, trying every line if that finds nothing
+		uint64_t sampleMask = 0;
+		while ((gap.endA - gap.startA) / (sampleMask + 1) > linesSampled) {
+			sampleMask = sampleMask * 2 + 1;
+		}
+		std::vector<std::pair<size_t, size_t>> anchors = UniqueAnchors(a, b, gap, sampleMask);
+		if (anchors.empty() && (sampleMask != 0)) {
+			anchors = UniqueAnchors(a, b, gap, 0);
+		}
+		if (!anchors.empty()) {
+			Gap after = gap;
+			for (auto it = anchors.rbegin(); it != anchors.rend(); ++it) {
+				gaps.push_back({ it->first + 1, after.endA, it->second + 1, after.endB });
+				after.endA = it->first;
+				after.endB = it->second;
+			}
+			gaps.push_back({ gap.startA, after.endA, gap.startB, after.endB });
+			continue;
+		}
+		if (minimal || !DiffMyers(a, b, gap, hunks)) {
+			AddHunk(hunks, gap.startA, gap.endA, gap.startB, gap.endB);
+		}
+	}
+	return hunks;
+}
+
+}
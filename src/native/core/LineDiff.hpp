@@ -0,0 +1,47 @@
+// Hyperion source code edit control
+/** @file LineDiff.hpp
+ ** Find the lines that differ between two texts.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/// Lines [startA, startA+lengthA) of the first text are replaced by lines
+/// [startB, startB+lengthB) of the second text.
+struct DiffHunk {
+	size_t startA = 0;
+	size_t lengthA = 0;
+	size_t startB = 0;
+	size_t lengthB = 0;
+};
+
+/// Positions where each line of text starts followed by the length of text.
+/// Lines end after \n, \r\n or a \r not followed by \n.
+std::vector<size_t> LineStartsOf(std::string_view text);
+
+/// Positions where each token of text starts followed by the length of text.
+/// Tokens are runs of letters, digits and non-ASCII bytes, runs of spaces and tabs,
+/// or single other bytes so changes inside a line can be shown by word.
+std::vector<size_t> TokenStartsOf(std::string_view text);
+
+/// A 64 bit hash of each line so lines can be compared as numbers. Large texts are
+/// hashed on several threads.
+/// Different lines may very rarely have the same hash, which SameOutsideHunks detects.
+std::vector<uint64_t> HashLines(std::string_view text, const std::vector<size_t> &starts);
+
+/// The differences between two sequences of line hashes in order.
+/// Lines that occur once in each sequence anchor the match, as in patience diff,
+/// and the remaining gaps use Myers' algorithm. A gap that would need too many
+/// edits is reported as one hunk.
+/// When minimal, Myers' algorithm is tried on each gap before looking for anchors.
+/// When timeout is positive, gaps remaining after that many seconds are reported whole.
+std::vector<DiffHunk> DiffLines(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b,
+	bool minimal=false, double timeout=0.0);
+
+/// Whether the lines outside the hunks are the same in both texts.
+bool SameOutsideHunks(std::string_view textA, const std::vector<size_t> &startsA,
+	std::string_view textB, const std::vector<size_t> &startsB, const std::vector<DiffHunk> &hunks);
+
+}
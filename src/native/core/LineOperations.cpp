@@ -0,0 +1,249 @@
+// Hyperion source code edit control
+/** @file LineOperations.cpp
+ ** Reorder and filter the lines of a block of text as spans without copying the lines.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <future>
+
+#include "../include/HyperionTypes.hpp"
+
+#include "../syntax/CaseFolder.hpp"
+#include "LineOperations.hpp"
+
+using namespace Hyperion;
+
+namespace Hyperion::Internal {
+
+namespace {
+
+// Blocks with fewer lines than this are sorted on the calling thread.
+constexpr size_t linesToSortInParallel = 0x10000;
+
+// Keys are sorted directly rather than through indices to avoid a cache miss per comparison.
+struct SortKey {
+	uint64_t prefix = 0;	///< Leading bytes of text in an order that compares as text does
+	std::string_view text;
+	double number = 0.0;
+	bool hasNumber = false;
+	size_t line = 0;
+};
+
+constexpr size_t prefixBytes = sizeof(uint64_t);
+
+void ReadPrefix(SortKey &key) noexcept {
+	const size_t length = std::min(key.text.length(), prefixBytes);
+	for (size_t i = 0; i < length; i++) {
+		key.prefix |= static_cast<uint64_t>(static_cast<unsigned char>(key.text[i])) << (8 * (prefixBytes - 1 - i));
+	}
+}
+
+bool TextLess(const SortKey &a, const SortKey &b) noexcept {
+	if (a.prefix != b.prefix) {
+		return a.prefix < b.prefix;
+	}
+	return a.text < b.text;
+}
+
+constexpr bool IsDigit(char ch) noexcept {
+	return ch >= '0' && ch <= '9';
+}
+
+// Read a decimal number with optional sign and fraction after any leading spaces and tabs.
+void ReadNumber(SortKey &key) noexcept {
+	std::string_view sv = key.text;
+	size_t i = 0;
+	while (i < sv.length() && (sv[i] == ' ' || sv[i] == '\t')) {
+		i++;
+	}
+	bool negative = false;
+	if (i < sv.length() && (sv[i] == '-' || sv[i] == '+')) {
+		negative = sv[i] == '-';
+		i++;
+	}
+	double value = 0.0;
+	bool digits = false;
+	for (; i < sv.length() && IsDigit(sv[i]); i++) {
+		value = value * 10.0 + (sv[i] - '0');
+		digits = true;
+	}
+	if (i < sv.length() && sv[i] == '.') {
+		double scale = 0.1;
+		for (i++; i < sv.length() && IsDigit(sv[i]); i++) {
+			value += (sv[i] - '0') * scale;
+			scale /= 10.0;
+			digits = true;
+		}
+	}
+	if (digits) {
+		key.number = negative ? -value : value;
+		key.hasNumber = true;
+	}
+}
+
+// Lines without a number come before lines with one, then equal numbers are ordered by text.
+bool NumericLess(const SortKey &a, const SortKey &b) noexcept {
+	if (a.hasNumber != b.hasNumber) {
+		return b.hasNumber;
+	}
+	if (a.hasNumber && (a.number != b.number)) {
+		return a.number < b.number;
+	}
+	return TextLess(a, b);
+}
+
+// Sort chunks on separate threads then merge neighbouring chunks in rounds.
+// Both steps are stable so the result matches std::stable_sort.
+template <typename T, typename Compare>
+void ParallelStableSort(std::vector<T> &v, Compare comp) {
+	const size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+	const size_t chunks = std::min<size_t>(threads, v.size() / (linesToSortInParallel / 4));
+	if ((v.size() < linesToSortInParallel) || (chunks <= 1)) {
+		std::stable_sort(v.begin(), v.end(), comp);
+		return;
+	}
+
+	std::vector<size_t> bounds;
+	for (size_t chunk = 0; chunk < chunks; chunk++) {
+		bounds.push_back(v.size() * chunk / chunks);
+	}
+	bounds.push_back(v.size());
+
+	std::vector<std::future<void>> futures;
+	for (size_t chunk = 0; chunk < chunks; chunk++) {
+		futures.push_back(std::async(std::launch::async, [&v, &bounds, comp, chunk]() {
+			std::stable_sort(v.begin() + bounds[chunk], v.begin() + bounds[chunk + 1], comp);
+		}));
+	}
+	for (std::future<void> &f : futures) {
+		f.wait();
+	}
+	for (std::future<void> &f : futures) {
+		f.get();	// Rethrow any failure from a worker
+	}
+
+	while (bounds.size() > 2) {
+		futures.clear();
+		std::vector<size_t> merged;
+		size_t i = 0;
+		for (; i + 2 < bounds.size(); i += 2) {
+			merged.push_back(bounds[i]);
+			futures.push_back(std::async(std::launch::async, [&v, comp, first = bounds[i], middle = bounds[i + 1], last = bounds[i + 2]]() {
+				std::inplace_merge(v.begin() + first, v.begin() + middle, v.begin() + last, comp);
+			}));
+		}
+		// An odd chunk out waits for the next round
+		for (; i < bounds.size(); i++) {
+			merged.push_back(bounds[i]);
+		}
+		for (std::future<void> &f : futures) {
+			f.wait();
+		}
+		for (std::future<void> &f : futures) {
+			f.get();
+		}
+		bounds = std::move(merged);
+	}
+}
+
+}
+
+void SortLineSpans(std::string_view text, std::vector<LineSpan> &lines, LineSort options, CaseFolder *pcf) {
+	if (lines.size() < 2) {
+		return;
+	}
+
+	std::vector<SortKey> keys(lines.size());
+	std::string folded;
+	if (FlagSet(options, LineSort::CaseInsensitive) && pcf) {
+		// Fold each line into scratch space big enough for any expansion then append
+		constexpr size_t maxFoldingExpansion = 6;
+		std::vector<size_t> foldedStarts(lines.size() + 1);
+		std::string scratch;
+		folded.reserve(text.length());
+		for (size_t line = 0; line < lines.size(); line++) {
+			foldedStarts[line] = folded.length();
+			const std::string_view contents = lines[line].Contents(text);
+			const size_t sizeScratch = (contents.length() + 1) * maxFoldingExpansion;
+			if (scratch.length() < sizeScratch) {
+				scratch.resize(sizeScratch);
+			}
+			const size_t lengthFolded = pcf->Fold(scratch.data(), scratch.length(),
+				contents.data(), contents.length());
+			folded.append(scratch.data(), lengthFolded);
+		}
+		foldedStarts[lines.size()] = folded.length();
+		const std::string_view svFolded(folded);
+		for (size_t line = 0; line < lines.size(); line++) {
+			keys[line].text = svFolded.substr(foldedStarts[line], foldedStarts[line + 1] - foldedStarts[line]);
+		}
+	} else {
+		for (size_t line = 0; line < lines.size(); line++) {
+			keys[line].text = lines[line].Contents(text);
+		}
+	}
+	const bool numeric = FlagSet(options, LineSort::Numeric);
+	for (size_t line = 0; line < lines.size(); line++) {
+		SortKey &key = keys[line];
+		key.line = line;
+		ReadPrefix(key);
+		if (numeric) {
+			ReadNumber(key);
+		}
+	}
+
+	if (FlagSet(options, LineSort::Descending)) {
+		// Swap arguments rather than reverse afterwards so equal lines stay in their original order
+		ParallelStableSort(keys, [numeric](const SortKey &a, const SortKey &b) noexcept {
+			return numeric ? NumericLess(b, a) : TextLess(b, a);
+		});
+	} else {
+		ParallelStableSort(keys, [numeric](const SortKey &a, const SortKey &b) noexcept {
+			return numeric ? NumericLess(a, b) : TextLess(a, b);
+		});
+	}
+
+	std::vector<LineSpan> sorted;
+	sorted.reserve(lines.size());
+	for (const SortKey &key : keys) {
+		sorted.push_back(lines[key.line]);
+	}
+	lines = std::move(sorted);
+}
+
+void UniqueLineSpans(std::string_view text, std::vector<LineSpan> &lines) {
+	std::unordered_set<std::string_view> seen;
+	seen.reserve(lines.size());
+	const auto itEnd = std::remove_if(lines.begin(), lines.end(), [text, &seen](const LineSpan &line) {
+		return !seen.insert(line.Contents(text)).second;
+	});
+	lines.erase(itEnd, lines.end());
+}
+
+std::string JoinLineSpans(std::string_view text, const std::vector<LineSpan> &layout, const std::vector<LineSpan> &lines) {
+	std::string joined;
+	if (lines.empty()) {
+		return joined;
+	}
+	joined.reserve(text.length());
+	for (size_t line = 0; line < lines.size(); line++) {
+		joined.append(lines[line].Contents(text));
+		// The last line takes the final line end so a block without one still ends without one
+		const LineSpan &lineEnd = (line == lines.size() - 1) ? layout.back() : layout[line];
+		joined.append(lineEnd.End(text));
+	}
+	return joined;
+}
+
+}
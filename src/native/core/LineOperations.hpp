@@ -0,0 +1,36 @@
+// Hyperion source code edit control
+/** @file LineOperations.hpp
+ ** Reorder and filter the lines of a block of text as spans without copying the lines.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/// A line inside a block of text.
+struct LineSpan {
+	size_t start = 0;
+	size_t length = 0;	///< Contents without the line end
+	size_t lengthEnd = 0;	///< Line end after the contents, 0 for a final line without one
+
+	std::string_view Contents(std::string_view text) const noexcept {
+		return text.substr(start, length);
+	}
+	std::string_view End(std::string_view text) const noexcept {
+		return text.substr(start + length, lengthEnd);
+	}
+};
+
+/// Stable sort of lines by their contents using several threads for large blocks.
+/// Case insensitive sorting compares the results of pcf which must then be set.
+void SortLineSpans(std::string_view text, std::vector<LineSpan> &lines, LineSort options, CaseFolder *pcf);
+
+/// Remove lines with the same contents as an earlier line.
+void UniqueLineSpans(std::string_view text, std::vector<LineSpan> &lines);
+
+/// Join lines back into text. Each line is followed by the line end of the line
+/// originally at its index in layout so the block keeps its line ends in place.
+std::string JoinLineSpans(std::string_view text, const std::vector<LineSpan> &layout, const std::vector<LineSpan> &lines);
+
+}
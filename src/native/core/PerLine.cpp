@@ -539,6 +539,24 @@ bool LineTabstops::AddTabstop(Sci::Line line, int x) {
 	return false;
 }
 
+// Replace all the tabstops of a line, returning whether they changed.
+bool LineTabstops::SetTabstops(Sci::Line line, const TabstopList &stops) {
+	if (line >= tabstops.Length() || !tabstops[line]) {
+		if (stops.empty()) {
+			return false;
+		}
+		tabstops.EnsureLength(line + 1);
+		tabstops[line] = std::make_unique<TabstopList>(stops);
+		return true;
+	}
+	TabstopList *tl = tabstops[line].get();
+	if (*tl == stops) {
+		return false;
+	}
+	*tl = stops;
+	return true;
+}
+
 int LineTabstops::GetNextTabstop(Sci::Line line, int x) const noexcept {
 	if (line < tabstops.Length()) {
 		const TabstopList *tl = tabstops[line].get();
@@ -139,6 +139,7 @@ public:
 
 	bool ClearTabstops(Sci::Line line) noexcept;
 	bool AddTabstop(Sci::Line line, int x);
+	bool SetTabstops(Sci::Line line, const TabstopList &stops);
 	int GetNextTabstop(Sci::Line line, int x) const noexcept;
 };
 
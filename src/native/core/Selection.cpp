@@ -247,11 +247,13 @@ std::string SelectionRange::ToString() const {
 	return result;
 }
 
-Selection::Selection() : mainRange(0), moveExtends(false), tentativeMain(false), selType(SelTypes::stream) {
+Selection::Selection() : mainRange(0), moveExtends(false), tentativeMain(false),
+	editingFromEnd(false), editingCurrent(false), rangesUnedited(0), shiftEditing(0), selType(SelTypes::stream) {
 	AddSelection(SelectionRange(SelectionPosition(0)));
 }
 
-Selection::Selection(std::string_view sv) : mainRange(0), moveExtends(false), tentativeMain(false), selType(SelTypes::stream) {
+Selection::Selection(std::string_view sv) : mainRange(0), moveExtends(false), tentativeMain(false),
+	editingFromEnd(false), editingCurrent(false), rangesUnedited(0), shiftEditing(0), selType(SelTypes::stream) {
 	if (sv.empty()) {
 		return;
 	}
@@ -414,8 +416,20 @@ Sci::Position Selection::Length() const noexcept {
 }
 
 void Selection::MovePositions(bool insertion, Sci::Position startChange, Sci::Position length) noexcept {
-	for (SelectionRange &range : ranges) {
-		range.MoveForInsertDelete(insertion, startChange, length);
+	if (editingFromEnd) {
+		shiftEditing += insertion ? length : -length;
+		// Unedited ranges that end before the change are not affected
+		for (size_t i = rangesUnedited; i > 0; i--) {
+			SelectionRange &range = ranges[orderEditing[i - 1]];
+			if (range.End().Position() < startChange) {
+				break;
+			}
+			range.MoveForInsertDelete(insertion, startChange, length);
+		}
+	} else {
+		for (SelectionRange &range : ranges) {
+			range.MoveForInsertDelete(insertion, startChange, length);
+		}
 	}
 	if (selType == SelTypes::rectangle) {
 		rangeRectangular.MoveForInsertDelete(insertion, startChange, length);
@@ -423,19 +437,19 @@ void Selection::MovePositions(bool insertion, Sci::Position startChange, Sci::Po
 }
 
 void Selection::TrimSelection(SelectionRange range) noexcept {
-	for (size_t i=0; i<ranges.size();) {
-		if ((i != mainRange) && (ranges[i].Trim(range))) {
+	// Compact in one pass as removing each emptied range separately is quadratic
+	const size_t mainOriginal = mainRange;
+	size_t kept = 0;
+	for (size_t i=0; i<ranges.size(); i++) {
+		if ((i != mainOriginal) && (ranges[i].Trim(range))) {
 			// Trimmed to empty so remove
-			for (size_t j=i; j<ranges.size()-1; j++) {
-				ranges[j] = ranges[j+1];
-				if (j == mainRange-1)
-					mainRange--;
-			}
-			ranges.pop_back();
+			if (i < mainOriginal)
+				mainRange--;
 		} else {
-			i++;
+			ranges[kept++] = ranges[i];
 		}
 	}
+	ranges.erase(ranges.begin() + kept, ranges.end());
 }
 
 void Selection::TrimOtherSelections(size_t r, SelectionRange range) noexcept {
@@ -544,19 +558,38 @@ void Selection::Clear() noexcept {
 }
 
 void Selection::RemoveDuplicates() noexcept {
-	for (size_t i=0; i<ranges.size()-1; i++) {
-		if (ranges[i].Empty()) {
-			size_t j=i+1;
-			while (j<ranges.size()) {
-				if (ranges[i] == ranges[j]) {
-					ranges.erase(ranges.begin() + j);
-					if (mainRange >= j)
-						mainRange--;
-				} else {
-					j++;
-				}
+	// Empty ranges that repeat an earlier empty range are removed.
+	// Find them by sorting so that many carets are not compared pairwise.
+	try {
+		std::vector<size_t> emptyRanges;
+		for (size_t i=0; i<ranges.size(); i++) {
+			if (ranges[i].Empty())
+				emptyRanges.push_back(i);
+		}
+		if (emptyRanges.size() < 2) {
+			return;
+		}
+		std::stable_sort(emptyRanges.begin(), emptyRanges.end(), [this](size_t a, size_t b) noexcept {
+			return ranges[a] < ranges[b];
+		});
+		std::vector<bool> duplicate(ranges.size());
+		for (size_t e=1; e<emptyRanges.size(); e++) {
+			if (ranges[emptyRanges[e]] == ranges[emptyRanges[e-1]])
+				duplicate[emptyRanges[e]] = true;
+		}
+		const size_t mainOriginal = mainRange;
+		size_t kept = 0;
+		for (size_t i=0; i<ranges.size(); i++) {
+			if (duplicate[i]) {
+				if (mainOriginal >= i)
+					mainRange--;
+			} else {
+				ranges[kept++] = ranges[i];
 			}
 		}
+		ranges.erase(ranges.begin() + kept, ranges.end());
+	} catch (const std::bad_alloc &) {
+		// Leave duplicates when short of memory
 	}
 }
 
@@ -578,6 +611,57 @@ void Selection::Truncate(Sci::Position length) noexcept {
 	rangeRectangular.Truncate(length);
 }
 
+void Selection::BeginEditFromEnd() {
+	orderEditing.resize(ranges.size());
+	for (size_t r=0; r<ranges.size(); r++) {
+		orderEditing[r] = r;
+	}
+	std::sort(orderEditing.begin(), orderEditing.end(), [this](size_t a, size_t b) noexcept {
+		return ranges[a] < ranges[b];
+	});
+	shiftAtEdit.assign(ranges.size(), 0);
+	rangesUnedited = ranges.size();
+	shiftEditing = 0;
+	editingCurrent = false;
+	// Deferring moves relies on each range starting after the previous range ends so, when
+	// ranges touch or overlap, fall back to moving every range for each change.
+	editingFromEnd = true;
+	for (size_t i=1; i<orderEditing.size(); i++) {
+		if (ranges[orderEditing[i-1]].End().Position() >= ranges[orderEditing[i]].Start().Position()) {
+			editingFromEnd = false;
+			break;
+		}
+	}
+}
+
+SelectionRange *Selection::NextFromEnd() noexcept {
+	if (editingCurrent) {
+		// Current range finished so is now only shifted by later changes
+		rangesUnedited--;
+		shiftAtEdit[orderEditing[rangesUnedited]] = shiftEditing;
+	}
+	editingCurrent = rangesUnedited > 0;
+	return editingCurrent ? &ranges[orderEditing[rangesUnedited - 1]] : nullptr;
+}
+
+void Selection::EndEditFromEnd() noexcept {
+	if (editingCurrent) {
+		rangesUnedited--;
+		shiftAtEdit[orderEditing[rangesUnedited]] = shiftEditing;
+	}
+	for (size_t i=rangesUnedited; i<orderEditing.size(); i++) {
+		const size_t r = orderEditing[i];
+		const Sci::Position shift = shiftEditing - shiftAtEdit[r];
+		ranges[r].caret.Add(shift);
+		ranges[r].anchor.Add(shift);
+	}
+	orderEditing.clear();
+	shiftAtEdit.clear();
+	rangesUnedited = 0;
+	editingCurrent = false;
+	editingFromEnd = false;
+}
+
 std::string Selection::ToString() const {
 	std::string result;
 	switch (selType) {
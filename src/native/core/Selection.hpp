@@ -173,6 +173,14 @@ class Selection {
 	size_t mainRange;
 	bool moveExtends;
 	bool tentativeMain;
+	// When ranges are edited from the last in the document to the first, the ranges already
+	// edited are after every later change so are shifted together when editing ends.
+	bool editingFromEnd;
+	bool editingCurrent;
+	std::vector<size_t> orderEditing;	///< Indices of ranges in document order
+	size_t rangesUnedited;	///< Ranges orderEditing[0, rangesUnedited) are moved for each change
+	std::vector<Sci::Position> shiftAtEdit;	///< shiftEditing when each range finished editing
+	Sci::Position shiftEditing;
 public:
 	enum class SelTypes { none, stream, rectangle, lines, thin };
 	SelTypes selType;
@@ -227,6 +235,34 @@ public:
 	void SetRanges(const Ranges &rangesToSet);
 	void Truncate(Sci::Position length) noexcept;
 	std::string ToString() const;
+	void BeginEditFromEnd();
+	SelectionRange *NextFromEnd() noexcept;
+	void EndEditFromEnd() noexcept;
+};
+
+/**
+ * Edit each range from the last in the document to the first so that changes do not disturb
+ * the positions of ranges yet to be edited. Moving the ranges already edited is deferred until
+ * destruction so editing many ranges is not quadratic.
+ */
+class SelectionEditFromEnd {
+	Selection &sel;
+public:
+	explicit SelectionEditFromEnd(Selection &sel_) : sel(sel_) {
+		sel.BeginEditFromEnd();
+	}
+	// Deleted so SelectionEditFromEnd objects can not be copied.
+	SelectionEditFromEnd(const SelectionEditFromEnd &) = delete;
+	SelectionEditFromEnd(SelectionEditFromEnd &&) = delete;
+	void operator=(const SelectionEditFromEnd &) = delete;
+	SelectionEditFromEnd &operator=(SelectionEditFromEnd &&) = delete;
+	~SelectionEditFromEnd() {
+		sel.EndEditFromEnd();
+	}
+	// Returns nullptr when all ranges have been edited.
+	SelectionRange *Next() noexcept {
+		return sel.NextFromEnd();
+	}
 };
 
 }
\ No newline at end of file
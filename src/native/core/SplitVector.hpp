@@ -327,6 +327,19 @@ public:
 		}
 	}
 
+	/// Return a pointer to the element at position and, through contiguousLength, the number
+	/// of elements stored contiguously from there up to the gap or the end.
+	/// Does not rearrange the buffer.
+	T *SegmentPointer(ptrdiff_t position, ptrdiff_t &contiguousLength) noexcept {
+		if (position < part1Length) {
+			contiguousLength = part1Length - position;
+			return body.data() + position;
+		} else {
+			contiguousLength = lengthBody - position;
+			return body.data() + position + gapLength;
+		}
+	}
+
 	/// Return the position of the gap within the buffer.
 	ptrdiff_t GapPosition() const noexcept {
 		return part1Length;
@@ -0,0 +1,82 @@
+// Hyperion source code edit control
+/** @file TextCountIndex.cpp
+ ** Keep counts of characters, UTF-16 code units and words for blocks of a document so
+ ** totals do not need a scan of the whole text after each change.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/ILoader.hpp"
+#include "../include/ILexer.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../syntax/CharacterCategoryMap.hpp"
+#include "../platform/Position.hpp"
+#include "../syntax/CharClassify.hpp"
+#include "../view/Decoration.hpp"
+#include "../syntax/CaseFolder.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "RunStyles.hpp"
+#include "CellBuffer.hpp"
+#include "Document.hpp"
+#include "BlockIndex.hpp"
+#include "TextCountIndex.hpp"
+
+using namespace Hyperion::Internal;
+
+namespace {
+
+// Blocks are split at line starts when they grow past twice this size.
+constexpr Sci::Position blockSize = 0x4000;
+
+}
+
+TextCountIndex::TextCountIndex(const Document *pdoc_) : pdoc(pdoc_), index(*this, blockSize) {
+	index.InsertText(0, pdoc->Length());
+}
+
+TextCounts TextCountIndex::Add(TextCounts a, TextCounts b) noexcept {
+	return a + b;
+}
+
+// The line start at or after position.
+Sci::Position TextCountIndex::SplitPosition(Sci::Position position) const noexcept {
+	return pdoc->LineStart(pdoc->SciLineFromPosition(position - 1) + 1);
+}
+
+void TextCountIndex::Summarize(Sci::Position start, Sci::Position end, TextCounts &counts) const noexcept {
+	counts = pdoc->ScanTextCounts(start, end);
+}
+
+void TextCountIndex::InsertText(Sci::Position position, Sci::Position length) {
+	index.InsertText(position, length);
+}
+
+void TextCountIndex::DeleteText(Sci::Position position, Sci::Position length) {
+	index.DeleteText(position, length);
+}
+
+void TextCountIndex::Invalidate() noexcept {
+	index.Invalidate();
+}
+
+TextCounts TextCountIndex::Count(Sci::Position start, Sci::Position end) {
+	return index.Range(start, end);
+}
@@ -0,0 +1,42 @@
+// Hyperion source code edit control
+/** @file TextCountIndex.hpp
+ ** Keep counts of characters, UTF-16 code units and words for blocks of a document so
+ ** totals do not need a scan of the whole text after each change.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Splits the document into blocks that start at line starts so no character or word
+ * crosses from one block into the next. Changes mark the blocks they touch and these are
+ * counted again when next asked for, then a tree of block counts sums any range of blocks
+ * in logarithmic time. A line longer than a block stays in a single block.
+ */
+class TextCountIndex {
+	static TextCounts Add(TextCounts a, TextCounts b) noexcept;
+	using Index = BlockIndex<TextCountIndex, TextCounts, Add>;
+	friend Index;
+	const Document *pdoc;
+	Index index;
+
+	Sci::Position SplitPosition(Sci::Position position) const noexcept;
+	void Summarize(Sci::Position start, Sci::Position end, TextCounts &counts) const noexcept;
+	void Release(TextCounts &) const noexcept {
+	}
+
+public:
+	explicit TextCountIndex(const Document *pdoc_);
+
+	void InsertText(Sci::Position position, Sci::Position length);
+	void DeleteText(Sci::Position position, Sci::Position length);
+	/// Count every block again as the encoding or word characters have changed.
+	void Invalidate() noexcept;
+
+	/// Counts for the text from start up to end which should both be character boundaries.
+	TextCounts Count(Sci::Position start, Sci::Position end);
+};
+
+}
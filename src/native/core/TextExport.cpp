@@ -0,0 +1,154 @@
+// Hyperion source code edit control
+/** @file TextExport.cpp
+ ** Write text to a caller's sink in bounded pieces, converting it on the way.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/HyperionStructures.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../platform/Position.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "CellBuffer.hpp"
+#include "TextExport.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+constexpr size_t chunkSizeDefault = 0x10000;
+
+constexpr std::string_view EndOfLineText(EndOfLine eolMode) noexcept {
+	switch (eolMode) {
+	case EndOfLine::CrLf:
+		return "\r\n";
+	case EndOfLine::Cr:
+		return "\r";
+	default:
+		return "\n";
+	}
+}
+
+}
+
+TextExporter::TextExporter(const TextExport &textExport) :
+	write(textExport.write),
+	context(textExport.context),
+	chunkSize((textExport.chunkSize > 0) ? textExport.chunkSize : chunkSizeDefault),
+	convertLineEnds(FlagSet(textExport.options, ExportOption::ConvertEndOfLine)),
+	nulToSpace(FlagSet(textExport.options, ExportOption::NulToSpace)),
+	eol(EndOfLineText(textExport.eolMode)) {
+	stopped = !write;
+}
+
+bool TextExporter::Special(char ch) const noexcept {
+	return (nulToSpace && (ch == '\0')) || (convertLineEnds && ((ch == '\r') || (ch == '\n')));
+}
+
+bool TextExporter::Deliver(const char *text, size_t length) {
+	while ((length > 0) && !stopped) {
+		const size_t lengthPiece = std::min(length, chunkSize);
+		if (write(context, text, lengthPiece)) {
+			written += lengthPiece;
+		} else {
+			stopped = true;
+		}
+		text += lengthPiece;
+		length -= lengthPiece;
+	}
+	return !stopped;
+}
+
+bool TextExporter::Flush(bool all) {
+	// Keep any partial chunk to be filled by later text
+	const size_t lengthFlush = all ? buffer.length() : (buffer.length() - buffer.length() % chunkSize);
+	const bool delivered = Deliver(buffer.data(), lengthFlush);
+	buffer.erase(0, lengthFlush);
+	return delivered;
+}
+
+bool TextExporter::Text(std::string_view text) {
+	size_t i = 0;
+	while ((i < text.length()) && !stopped) {
+		size_t end = i;
+		while ((end < text.length()) && !Special(text[end])) {
+			end++;
+		}
+		if (end > i) {
+			afterCR = false;
+		}
+		const char *run = text.data() + i;
+		size_t lengthRun = end - i;
+		while ((lengthRun > 0) && !stopped) {
+			size_t lengthTaken = 0;
+			if (buffer.empty() && (lengthRun >= chunkSize)) {
+				// Whole chunks go straight to the sink
+				lengthTaken = lengthRun - lengthRun % chunkSize;
+				Deliver(run, lengthTaken);
+			} else {
+				lengthTaken = std::min(lengthRun, chunkSize - buffer.length());
+				buffer.append(run, lengthTaken);
+				Flush(false);
+			}
+			run += lengthTaken;
+			lengthRun -= lengthTaken;
+		}
+		if (end < text.length()) {
+			const char ch = text[end];
+			if (ch == '\0') {
+				buffer.push_back(' ');
+				afterCR = false;
+			} else if ((ch == '\n') && afterCR) {
+				// Second half of a CR LF already converted
+				afterCR = false;
+			} else {
+				buffer.append(eol);
+				afterCR = ch == '\r';
+			}
+			end++;
+		}
+		Flush(false);
+		i = end;
+	}
+	return !stopped;
+}
+
+bool TextExporter::Range(const SplitView &view, Sci::Position start, Sci::Position end) {
+	const Sci::Position length1 = view.length1;
+	if (start < length1) {
+		const Sci::Position end1 = std::min(end, length1);
+		if (!Text(std::string_view(view.segment1 + start, end1 - start))) {
+			return false;
+		}
+		start = end1;
+	}
+	if (start < end) {
+		return Text(std::string_view(view.segment2 + start, end - start));
+	}
+	return !stopped;
+}
+
+bool TextExporter::Finish() {
+	return Flush(true);
+}
+
+Sci::Position TextExporter::Written() const noexcept {
+	return written;
+}
@@ -0,0 +1,44 @@
+// Hyperion source code edit control
+/** @file TextExport.hpp
+ ** Write text to a caller's sink in bounded pieces, converting it on the way.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Passes text to the write function of a TextExport without first gathering it into one
+ * string. Runs of text that need no conversion are passed straight from where they are,
+ * such as the two segments of the document, while converted text is collected into a buffer
+ * of at most the chunk size. A line end split between two calls is still seen as one.
+ */
+class TextExporter {
+	Hyperion::ExportWrite write;
+	void *context;
+	size_t chunkSize;
+	bool convertLineEnds;
+	bool nulToSpace;
+	std::string_view eol;
+	std::string buffer;
+	bool afterCR = false;
+	bool stopped = false;
+	Sci::Position written = 0;
+
+	bool Special(char ch) const noexcept;
+	bool Deliver(const char *text, size_t length);
+	bool Flush(bool all);
+
+public:
+	explicit TextExporter(const Hyperion::TextExport &textExport);
+
+	bool Text(std::string_view text);
+	/// Text from start up to end of a document's view.
+	bool Range(const SplitView &view, Sci::Position start, Sci::Position end);
+	/// Pass any buffered text. Returns false if the sink stopped the export.
+	bool Finish();
+	Sci::Position Written() const noexcept;
+};
+
+}
@@ -0,0 +1,263 @@
+// Hyperion source code edit control
+/** @file WordIndex.cpp
+ ** Keep the words of a document with their number of occurrences so completion
+ ** candidates can be found without scanning the text.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <optional>
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/ILoader.hpp"
+#include "../include/ILexer.hpp"
+
+#include "../platform/Debugging.hpp"
+#include "../syntax/CharacterCategoryMap.hpp"
+#include "../platform/Position.hpp"
+#include "../syntax/CharClassify.hpp"
+#include "../view/Decoration.hpp"
+#include "../syntax/CaseFolder.hpp"
+
+#include "SplitVector.hpp"
+#include "Partitioning.hpp"
+#include "RunStyles.hpp"
+#include "CellBuffer.hpp"
+#include "Document.hpp"
+#include "BlockIndex.hpp"
+#include "WordIndex.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+// Words are harvested over blocks of about this size that start at line starts.
+constexpr Sci::Position blockSize = 0x1000;
+
+constexpr bool StartsWith(std::string_view s, std::string_view prefix) noexcept {
+	return s.substr(0, prefix.length()) == prefix;
+}
+
+}
+
+WordIndex::WordIndex(const Document *pdoc_) : pdoc(pdoc_), index(*this, blockSize) {
+	index.InsertText(0, pdoc->Length());
+}
+
+// The line start at or after position so no word crosses from one block into the next.
+Sci::Position WordIndex::SplitPosition(Sci::Position position) const noexcept {
+	return pdoc->LineStart(pdoc->SciLineFromPosition(position - 1) + 1);
+}
+
+void WordIndex::Release(BlockWords &words) noexcept {
+	for (const BlockWord &blockWord : words) {
+		blockWord.word->second -= blockWord.count;
+		if (blockWord.word->second == 0) {
+			lookup.erase(blockWord.word->first);
+			counts.erase(blockWord.word);
+		}
+	}
+	words.clear();
+}
+
+// Harvest the words of a block after taking back the counts it added before. When a block
+// is split, its words stay with its first piece until that is harvested again.
+void WordIndex::Summarize(Sci::Position start, Sci::Position end, BlockWords &words) {
+	Release(words);
+	std::string text(end - start, '\0');
+	pdoc->GetCharRange(text.data(), start, end - start);
+	std::vector<Sci::Position> bounds;
+	pdoc->ScanWords(start, end, bounds);
+
+	// Group the occurrences of each word so each distinct word is looked up once
+	std::unordered_map<std::string_view, Sci::Position> occurrences;
+	const std::string_view textView(text);
+	for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+		occurrences[textView.substr(bounds[i] - start, bounds[i + 1] - bounds[i])]++;
+	}
+	words.reserve(occurrences.size());
+	for (const auto &[word, occurrencesWord] : occurrences) {
+		WordCounts::iterator it;
+		const auto itLookup = lookup.find(word);
+		if (itLookup == lookup.end()) {
+			it = counts.emplace(std::string(word), 0).first;
+			lookup.emplace(it->first, it);
+		} else {
+			it = itLookup->second;
+		}
+		it->second += occurrencesWord;
+		words.push_back({ it, occurrencesWord });
+	}
+	std::sort(words.begin(), words.end(), [](const BlockWord &a, const BlockWord &b) noexcept {
+		return a.word->first < b.word->first;
+	});
+}
+
+void WordIndex::InsertText(Sci::Position position, Sci::Position length) {
+	index.InsertText(position, length);
+}
+
+void WordIndex::DeleteText(Sci::Position position, Sci::Position length) {
+	index.DeleteText(position, length);
+}
+
+void WordIndex::Invalidate() noexcept {
+	index.Invalidate();
+}
+
+std::vector<std::string> WordIndex::ByFrequency(std::string_view prefix, std::string_view typed, size_t maxWords) const {
+	struct Candidate {
+		Sci::Position occurrences;
+		const std::string *word;
+	};
+	std::vector<Candidate> candidates;
+	for (WordCounts::const_iterator it = counts.lower_bound(prefix);
+		(it != counts.end()) && StartsWith(it->first, prefix); ++it) {
+		const Sci::Position occurrences = it->second - ((it->first == typed) ? 1 : 0);
+		if (occurrences > 0) {
+			candidates.push_back({ occurrences, &it->first });
+		}
+	}
+	const size_t results = std::min(maxWords, candidates.size());
+	std::partial_sort(candidates.begin(), candidates.begin() + results, candidates.end(),
+		[](const Candidate &a, const Candidate &b) noexcept {
+		if (a.occurrences != b.occurrences) {
+			return a.occurrences > b.occurrences;
+		}
+		return *a.word < *b.word;
+	});
+	std::vector<std::string> words;
+	for (size_t i = 0; i < results; i++) {
+		words.push_back(*candidates[i].word);
+	}
+	return words;
+}
+
+std::vector<std::string> WordIndex::ByProximity(std::string_view prefix, std::string_view typed, Sci::Position typedStart,
+	Sci::Position position, size_t maxWords) const {
+	// Examine blocks in order of their distance from position until no further block can
+	// hold a word nearer than the wanted nearest words found so far. Fewer than maxWords are
+	// wanted when fewer occur so the whole document is not examined for them.
+	size_t wanted = 0;
+	for (WordCounts::const_iterator it = counts.lower_bound(prefix);
+		(it != counts.end()) && StartsWith(it->first, prefix) && (wanted < maxWords); ++it) {
+		if (it->second > ((it->first == typed) ? 1 : 0)) {
+			wanted++;
+		}
+	}
+	if (wanted == 0) {
+		return {};
+	}
+	std::map<std::string_view, Sci::Position> nearest;
+	std::vector<Sci::Position> distances;
+	std::vector<Sci::Position> bounds;
+	std::string text;
+	constexpr Sci::Position farAway = std::numeric_limits<Sci::Position>::max();
+	const Sci::Position blockPosition = index.BlockFromPosition(position);
+	Sci::Position before = blockPosition;
+	Sci::Position after = blockPosition + 1;
+	while ((before >= 0) || (after < index.Blocks())) {
+		const Sci::Position distanceBefore = (before >= 0) ?
+			std::max<Sci::Position>(position - index.BlockStart(before + 1), 0) : farAway;
+		const Sci::Position distanceAfter = (after < index.Blocks()) ?
+			index.BlockStart(after) - position : farAway;
+		if (nearest.size() >= wanted) {
+			distances.clear();
+			for (const auto &[word, distance] : nearest) {
+				distances.push_back(distance);
+			}
+			std::nth_element(distances.begin(), distances.begin() + wanted - 1, distances.end());
+			if (distances[wanted - 1] <= std::min(distanceBefore, distanceAfter)) {
+				break;
+			}
+		}
+		const Sci::Position distanceBlock = std::min(distanceBefore, distanceAfter);
+		const Sci::Position block = (distanceBefore <= distanceAfter) ? before-- : after++;
+
+		// Only examine the text of blocks that may hold a word not found yet or nearer
+		const BlockWords &words = index.BlockSummary(block);
+		bool examine = false;
+		for (auto itWord = std::lower_bound(words.begin(), words.end(), prefix,
+			[](const BlockWord &blockWord, std::string_view text) noexcept {
+			return blockWord.word->first < text;
+		}); (itWord != words.end()) && StartsWith(itWord->word->first, prefix); ++itWord) {
+			const auto itNearest = nearest.find(itWord->word->first);
+			if ((itNearest == nearest.end()) || (itNearest->second > distanceBlock)) {
+				examine = true;
+				break;
+			}
+		}
+		if (!examine) {
+			continue;
+		}
+
+		const Sci::Position start = index.BlockStart(block);
+		const Sci::Position end = index.BlockStart(block + 1);
+		text.resize(end - start);
+		pdoc->GetCharRange(text.data(), start, end - start);
+		bounds.clear();
+		pdoc->ScanWords(start, end, bounds);
+		const std::string_view textView(text);
+		for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+			const std::string_view word = textView.substr(bounds[i] - start, bounds[i + 1] - bounds[i]);
+			if ((bounds[i] == typedStart) || !StartsWith(word, prefix)) {
+				continue;
+			}
+			const Sci::Position distance = (position < bounds[i]) ? (bounds[i] - position) :
+				std::max<Sci::Position>(position - bounds[i + 1], 0);
+			// Key by the text kept in counts as the block text is reused
+			const auto itLookup = lookup.find(word);
+			if (itLookup == lookup.end()) {
+				continue;
+			}
+			const auto [it, inserted] = nearest.try_emplace(itLookup->first, distance);
+			if (!inserted) {
+				it->second = std::min(it->second, distance);
+			}
+		}
+	}
+
+	std::vector<std::pair<Sci::Position, std::string_view>> candidates;
+	for (const auto &[word, distance] : nearest) {
+		candidates.emplace_back(distance, word);
+	}
+	const size_t results = std::min(wanted, candidates.size());
+	std::partial_sort(candidates.begin(), candidates.begin() + results, candidates.end());
+	std::vector<std::string> words;
+	for (size_t i = 0; i < results; i++) {
+		words.emplace_back(candidates[i].second);
+	}
+	return words;
+}
+
+std::vector<std::string> WordIndex::Words(std::string_view prefix, WordRanking ranking, Sci::Position position,
+	size_t maxWords) {
+	if (maxWords == 0) {
+		return {};
+	}
+	index.Validate();
+	// The word being typed
+	const Sci::Position typedStart = pdoc->ExtendWordSelect(position, -1, true);
+	const Sci::Position typedEnd = pdoc->ExtendWordSelect(position, 1, true);
+	std::string typed(typedEnd - typedStart, '\0');
+	pdoc->GetCharRange(typed.data(), typedStart, typedEnd - typedStart);
+	if (ranking == WordRanking::Proximity) {
+		return ByProximity(prefix, typed, (typedStart < typedEnd) ? typedStart : -1, position, maxWords);
+	}
+	return ByFrequency(prefix, typed, maxWords);
+}
@@ -0,0 +1,57 @@
+// Hyperion source code edit control
+/** @file WordIndex.hpp
+ ** Keep the words of a document with their number of occurrences so completion
+ ** candidates can be found without scanning the text.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Splits the document into blocks that start at line starts, like TextCountIndex, and
+ * remembers the distinct words of each block, sorted alphabetically, and how often they
+ * occur there. The counts of all blocks are summed in a sorted map so words with a prefix
+ * are a range of the map.
+ * Changes mark the blocks they touch and these are harvested again when next asked for,
+ * first taking back the counts they added before.
+ */
+class WordIndex {
+	typedef std::map<std::string, Sci::Position, std::less<>> WordCounts;
+	struct BlockWord {
+		WordCounts::iterator word;
+		Sci::Position count;
+	};
+	typedef std::vector<BlockWord> BlockWords;
+	using Index = BlockIndex<WordIndex, BlockWords>;
+	friend Index;
+	const Document *pdoc;
+	Index index;
+	WordCounts counts;
+	/// Finds words in counts by hashing as searching the sorted map is slower
+	std::unordered_map<std::string_view, WordCounts::iterator> lookup;
+
+	Sci::Position SplitPosition(Sci::Position position) const noexcept;
+	void Release(BlockWords &words) noexcept;
+	void Summarize(Sci::Position start, Sci::Position end, BlockWords &words);
+	std::vector<std::string> ByFrequency(std::string_view prefix, std::string_view typed, size_t maxWords) const;
+	std::vector<std::string> ByProximity(std::string_view prefix, std::string_view typed, Sci::Position typedStart,
+		Sci::Position position, size_t maxWords) const;
+
+public:
+	explicit WordIndex(const Document *pdoc_);
+
+	void InsertText(Sci::Position position, Sci::Position length);
+	void DeleteText(Sci::Position position, Sci::Position length);
+	/// Harvest every block again as the encoding or word characters have changed.
+	void Invalidate() noexcept;
+
+	/// Up to maxWords words starting with prefix, most frequent first or nearest to position
+	/// first. The occurrence of a word that contains position is the word being typed so is
+	/// not counted.
+	std::vector<std::string> Words(std::string_view prefix, Hyperion::WordRanking ranking, Sci::Position position,
+		size_t maxWords);
+};
+
+}
@@ -356,6 +356,9 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_CLEARCMDKEY 2071
 #define SCI_CLEARALLCMDKEYS 2072
 #define SCI_SETSTYLINGEX 2073
+#define SCI_SETSEMANTICTOKENSTYLE 2818
+#define SCI_GETSEMANTICTOKENSTYLE 2819
+#define SCI_APPLYSEMANTICTOKENS 2820
 #define SCI_STYLESETVISIBLE 2074
 #define SCI_GETCARETPERIOD 2075
 #define SCI_SETCARETPERIOD 2076
@@ -473,6 +476,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_AUTOCOMPLETE_NORMAL 0
 #define SC_AUTOCOMPLETE_FIXED_SIZE 1
 #define SC_AUTOCOMPLETE_SELECT_FIRST_ITEM 2
+#define SC_AUTOCOMPLETE_FILTER 4
+#define SC_AUTOCOMPLETE_FUZZY 8
 #define SCI_AUTOCSETOPTIONS 2638
 #define SCI_AUTOCGETOPTIONS 2639
 #define SCI_AUTOCSETDROPRESTOFWORD 2270
@@ -496,6 +501,11 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_SETLINEINDENTATION 2126
 #define SCI_GETLINEINDENTATION 2127
 #define SCI_GETLINEINDENTPOSITION 2128
+#define SC_NORMALIZE_NONE 0
+#define SC_NORMALIZE_TRIMTRAILING 1
+#define SC_NORMALIZE_TABIFY 2
+#define SC_NORMALIZE_UNTABIFY 4
+#define SCI_NORMALIZEWHITESPACE 2826
 #define SCI_GETCOLUMN 2129
 #define SCI_COUNTCHARACTERS 2633
 #define SCI_COUNTCODEUNITS 2715
@@ -612,6 +622,7 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_REPLACETARGET 2194
 #define SCI_REPLACETARGETRE 2195
 #define SCI_REPLACETARGETMINIMAL 2779
+#define SCI_RELOADTEXT 2837
 #define SCI_SEARCHINTARGET 2197
 #define SCI_SETSEARCHFLAGS 2198
 #define SCI_GETSEARCHFLAGS 2199
@@ -805,6 +816,14 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_LINEDELETE 2338
 #define SCI_LINETRANSPOSE 2339
 #define SCI_LINEREVERSE 2354
+#define SC_LINESORT_LEXICOGRAPHIC 0
+#define SC_LINESORT_CASEINSENSITIVE 1
+#define SC_LINESORT_NUMERIC 2
+#define SC_LINESORT_DESCENDING 4
+#define SCI_LINESORT 2822
+#define SCI_LINEUNIQUE 2823
+#define SCI_LINEKEEPMATCHING 2824
+#define SCI_LINEDROPMATCHING 2825
 #define SCI_LINEDUPLICATE 2404
 #define SCI_LOWERCASE 2340
 #define SCI_UPPERCASE 2341
@@ -830,6 +849,9 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_BRACEBADLIGHTINDICATOR 2499
 #define SCI_BRACEMATCH 2353
 #define SCI_BRACEMATCHNEXT 2369
+#define SCI_BRACEENCLOSING 2829
+#define SCI_SETBRACEINDEX 2827
+#define SCI_GETBRACEINDEX 2828
 #define SCI_GETVIEWEOL 2355
 #define SCI_SETVIEWEOL 2356
 #define SCI_GETDOCPOINTER 2357
@@ -1206,6 +1228,50 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_RELEASELINECHARACTERINDEX 2712
 #define SCI_LINEFROMINDEXPOSITION 2713
 #define SCI_INDEXPOSITIONFROMLINE 2714
+#define SC_POSITIONUNIT_BYTE 0
+#define SC_POSITIONUNIT_UTF32 1
+#define SC_POSITIONUNIT_UTF16 2
+#define SC_POSITIONUNIT_LINE 0x10
+#define SCI_CONVERTPOSITIONS 2821
+#define SCI_SETTEXTCOUNTINDEX 2830
+#define SCI_GETTEXTCOUNTINDEX 2831
+#define SCI_GETTEXTSTATISTICS 2832
+#define SCI_SETCONTENTHASHINDEX 2833
+#define SCI_GETCONTENTHASHINDEX 2834
+#define SCI_GETCONTENTHASH 2835
+#define SCI_GETCONTENTMODIFIED 2836
+#define SC_DIFF_NONE 0
+#define SC_DIFF_MINIMAL 1
+#define SC_DIFF_LINESONLY 2
+#define SCI_DIFFDOCUMENT 2838
+#define SCI_SETDIFFTIMEOUT 2839
+#define SCI_GETDIFFTIMEOUT 2840
+#define SCI_DIFFGETHUNK 2841
+#define SCI_DIFFALIGNEDLINE 2842
+#define SCI_DIFFINDICATE 2843
+#define SCI_DIFFPADANNOTATIONS 2844
+#define SCI_SETELASTICTABSTOPS 2845
+#define SCI_GETELASTICTABSTOPS 2846
+#define SCI_AUTOCSETMAXRESULTS 2847
+#define SCI_AUTOCGETMAXRESULTS 2848
+#define SCI_SETWORDINDEX 2849
+#define SCI_GETWORDINDEX 2850
+#define SC_WORDRANKING_FREQUENCY 0
+#define SC_WORDRANKING_PROXIMITY 1
+#define SCI_AUTOCSETWORDRANKING 2851
+#define SCI_AUTOCGETWORDRANKING 2852
+#define SCI_AUTOCGETDOCUMENTWORDS 2853
+#define SCI_AUTOCSHOWDOCUMENTWORDS 2854
+#define SC_EXPORT_NONE 0
+#define SC_EXPORT_CONVERTEOL 1
+#define SC_EXPORT_NULTOSPACE 2
+#define SCI_EXPORTSELECTION 2855
+#define SCI_EXPORTRANGE 2856
+#define SCI_SETLOGMODE 2857
+#define SCI_GETLOGMODE 2858
+#define SCI_SETLOGLINELIMIT 2859
+#define SCI_GETLOGLINELIMIT 2860
+#define SCI_CALLBATCH 2861
 #define SCI_STARTRECORD 3001
 #define SCI_STOPRECORD 3002
 #define SCI_GETLEXER 4002
@@ -1415,6 +1481,83 @@ struct Sci_RangeToFormatFull {
 	struct Sci_CharacterRangeFull chrg;
 };
 
+/* Used by SCI_CONVERTPOSITIONS. Positions with SC_POSITIONUNIT_LINE set are
+ * (line, column) pairs taking two elements of the arrays. */
+
+struct Sci_PositionConversion {
+	int unitsFrom;
+	int unitsTo;
+	Sci_Position count;
+	const Sci_Position *positionsFrom;
+	Sci_Position *positionsTo;
+};
+
+/* Used by SCI_GETTEXTSTATISTICS. Set chrg to the range to count with a negative
+ * cpMax for the end of the document. */
+
+struct Sci_TextStatistics {
+	struct Sci_CharacterRangeFull chrg;
+	Sci_Position characters;
+	Sci_Position codeUnits;
+	Sci_Position words;
+	Sci_Position lines;
+};
+
+/* Used by SCI_GETCONTENTHASH. Set chrg to the range to hash with a negative cpMax
+ * for the end of the document. */
+
+struct Sci_TextHash {
+	struct Sci_CharacterRangeFull chrg;
+	uint64_t hash;
+};
+
+/* Used by SCI_DIFFGETHUNK. Lines [line, line+lines) of the document are replaced by
+ * lines [lineOther, lineOther+linesOther) of the document it was compared with. */
+
+struct Sci_DiffHunk {
+	Sci_Position line;
+	Sci_Position lines;
+	Sci_Position lineOther;
+	Sci_Position linesOther;
+};
+
+/* Used by SCI_EXPORTSELECTION and SCI_EXPORTRANGE. write is called with successive pieces
+ * of the text of at most chunkSize bytes, 64K when 0, and returns 0 to stop the export.
+ * chrg is the range for SCI_EXPORTRANGE. rectangular and lineCopy are set by
+ * SCI_EXPORTSELECTION as they would be for the clipboard. */
+
+typedef int (*Sci_ExportWrite)(void *context, const char *text, Sci_Position length);
+
+struct Sci_TextExport {
+	struct Sci_CharacterRangeFull chrg;
+	int options;
+	int eolMode;
+	Sci_Position chunkSize;
+	Sci_ExportWrite write;
+	void *context;
+	int rectangular;
+	int lineCopy;
+};
+
+/* Used by SCI_CALLBATCH. calls holds length bytes of calls packed one after another. Each
+ * Sci_BatchCall is followed by payloadLength bytes which, when not 0, are passed as lParam in
+ * place of the lParam field, then by a NUL so the payload can be read as a C string, and then
+ * by padding up to a multiple of sizeof(sptr_t). Calls may write into their payload. results,
+ * when not NULL, receives the value returned by each call. SCI_CALLBATCH can not be batched. */
+
+struct Sci_BatchCall {
+	unsigned int message;
+	unsigned int payloadLength;
+	uptr_t wParam;
+	sptr_t lParam;
+};
+
+struct Sci_Batch {
+	char *calls;
+	Sci_Position length;
+	sptr_t *results;
+};
+
 #ifndef __cplusplus
 /* For the GTK+ platform, g-ir-scanner needs to have these typedefs. This
  * is not required in C++ code and has caused problems in the past. */
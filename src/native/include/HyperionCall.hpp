@@ -33,6 +33,12 @@ enum class Message;	// Declare in case HyperionMessages.h not included
 struct TextRangeFull;
 struct TextToFindFull;
 struct RangeToFormatFull;
+struct PositionConversion;
+struct TextStatistics;
+struct TextHash;
+struct DiffHunk;
+struct TextExport;
+struct Batch;
 
 class IDocumentEditable;
 
@@ -67,6 +73,9 @@ struct Span {
 class HYPERION_API HyperionCall {
 	FunctionDirect fn;
 	intptr_t ptr;
+	bool batching;
+	size_t batchCalls;
+	std::string batch;
 	intptr_t CallPointer(Message msg, uintptr_t wParam, void *s);
 	intptr_t CallString(Message msg, uintptr_t wParam, const char *s);
 	std::string CallReturnString(Message msg, uintptr_t wParam);
@@ -79,6 +88,15 @@ public:
 	bool IsValid() const noexcept;
 	intptr_t Call(Message msg, uintptr_t wParam=0, intptr_t lParam=0);
 
+	// Between BeginBatch and EndBatch calls are queued and return 0 instead of being made.
+	// Pointers passed to queued calls must stay valid until EndBatch so helpers that return a
+	// std::string or pass a pointer to their own locals throw Failure while batching. QueueCall
+	// starts a batch if needed and passes a NUL terminated copy of payload as lParam.
+	void BeginBatch();
+	void QueueCall(Message msg, uintptr_t wParam, std::string_view payload);
+	// Make the queued calls with one Message::CallBatch and return what each call returned.
+	std::vector<intptr_t> EndBatch();
+
 	// Common APIs made more structured and type-safe
 	Position LineStart(Line line);
 	Position LineEnd(Line line);
@@ -251,6 +269,9 @@ public:
 	void ClearCmdKey(int keyDefinition);
 	void ClearAllCmdKeys();
 	void SetStylingEx(Position length, const char *styles);
+	void SetSemanticTokenStyle(int tokenType, int style);
+	int SemanticTokenStyle(int tokenType);
+	Position ApplySemanticTokens(Position length, const unsigned int *tokens);
 	void StyleSetVisible(int style, bool visible);
 	int CaretPeriod();
 	void SetCaretPeriod(int periodMilliseconds);
@@ -347,6 +368,7 @@ public:
 	void SetLineIndentation(Line line, int indentation);
 	int LineIndentation(Line line);
 	Position LineIndentPosition(Line line);
+	void NormalizeWhitespace(Hyperion::Normalize options, int indentLevels);
 	Position Column(Position pos);
 	Position CountCharacters(Position start, Position end);
 	Position CountCodeUnits(Position start, Position end);
@@ -444,6 +466,7 @@ public:
 	Position ReplaceTarget(Position length, const char *text);
 	Position ReplaceTargetRE(Position length, const char *text);
 	Position ReplaceTargetMinimal(Position length, const char *text);
+	Position ReloadText(Position length, const char *text);
 	Position SearchInTarget(Position length, const char *text);
 	void SetSearchFlags(Hyperion::FindOption searchFlags);
 	Hyperion::FindOption SearchFlags();
@@ -580,6 +603,10 @@ public:
 	void LineDelete();
 	void LineTranspose();
 	void LineReverse();
+	void LineSort(Hyperion::LineSort options);
+	void LineUnique();
+	void LineKeepMatching(Position length, const char *text);
+	void LineDropMatching(Position length, const char *text);
 	void LineDuplicate();
 	void LowerCase();
 	void UpperCase();
@@ -605,6 +632,9 @@ public:
 	void BraceBadLightIndicator(bool useSetting, int indicator);
 	Position BraceMatch(Position pos, int maxReStyle);
 	Position BraceMatchNext(Position pos, Position startPos);
+	Position BraceEnclosing(Position pos, int style);
+	void SetBraceIndex(bool indexed);
+	bool BraceIndex();
 	bool ViewEOL();
 	void SetViewEOL(bool visible);
 	IDocumentEditable *DocPointer();
@@ -907,6 +937,39 @@ public:
 	void ReleaseLineCharacterIndex(Hyperion::LineCharacterIndexType lineCharacterIndex);
 	Line LineFromIndexPosition(Position pos, Hyperion::LineCharacterIndexType lineCharacterIndex);
 	Position IndexPositionFromLine(Line line, Hyperion::LineCharacterIndexType lineCharacterIndex);
+	Position ConvertPositions(PositionConversion *conversion);
+	void SetTextCountIndex(bool indexed);
+	bool TextCountIndex();
+	Position GetTextStatistics(TextStatistics *statistics);
+	void SetContentHashIndex(bool indexed);
+	bool ContentHashIndex();
+	Position GetContentHash(TextHash *textHash);
+	bool ContentModified();
+	Position DiffDocument(Hyperion::DiffOption options, IDocumentEditable *docOther);
+	void SetDiffTimeout(int milliseconds);
+	int DiffTimeout();
+	bool DiffGetHunk(Position hunk, DiffHunk *diffHunk);
+	Line DiffAlignedLine(Line line);
+	Position DiffIndicate(int indicator);
+	Line DiffPadAnnotations(int style);
+	void SetElasticTabstops(int padding);
+	int ElasticTabstops();
+	void AutoCSetMaxResults(int results);
+	int AutoCGetMaxResults();
+	void SetWordIndex(bool indexed);
+	bool WordIndex();
+	void AutoCSetWordRanking(Hyperion::WordRanking ranking);
+	Hyperion::WordRanking AutoCGetWordRanking();
+	int AutoCGetDocumentWords(const char *prefix, char *words);
+	std::string AutoCGetDocumentWords(const char *prefix);
+	bool AutoCShowDocumentWords(Position lengthEntered);
+	Position ExportSelection(bool allowLineCopy, TextExport *textExport);
+	Position ExportRange(TextExport *textExport);
+	void SetLogMode(bool logMode);
+	bool LogMode();
+	void SetLogLineLimit(Line lines);
+	Line LogLineLimit();
+	Position CallBatch(Batch *batch);
 	void StartRecord();
 	void StopRecord();
 	int Lexer();
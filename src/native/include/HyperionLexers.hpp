@@ -0,0 +1,69 @@
+// Hyperion source code edit control
+/** @file HyperionLexers.hpp
+ ** Lexers built into Hyperion and the styles they produce.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+#include "ILexer.hpp"
+
+namespace Hyperion {
+
+enum class LexerIdentifier {
+	CFamily = 1,
+	JSON = 2,
+	Log = 3,
+};
+
+enum class StyleCFamily {
+	Default = 0,
+	Comment = 1,
+	CommentLine = 2,
+	CommentDoc = 3,
+	Number = 4,
+	Keyword = 5,
+	String = 6,
+	Character = 7,
+	Preprocessor = 9,
+	Operator = 10,
+	Identifier = 11,
+	CommentLineDoc = 15,
+	Keyword2 = 16,
+	RawString = 20,
+	Function = 24,
+};
+
+enum class StyleJSON {
+	Default = 0,
+	Number = 1,
+	String = 2,
+	PropertyName = 4,
+	LineComment = 6,
+	BlockComment = 7,
+	Operator = 8,
+	Keyword = 11,
+	Error = 13,
+};
+
+enum class StyleLog {
+	Default = 0,
+	Date = 1,
+	Number = 2,
+	String = 3,
+	Error = 4,
+	Warning = 5,
+	Info = 6,
+	Debug = 7,
+	URL = 8,
+	Operator = 9,
+	Identifier = 10,
+};
+
+/// Number of built-in lexers, their names ("cpp", "json", "log") and a factory
+/// returning a new lexer to pass to SetILexer or nullptr for an unknown name.
+HYPERION_API int GetLexerCount() noexcept;
+HYPERION_API const char *GetLexerName(int index) noexcept;
+HYPERION_API ILexer5 *CreateLexer(const char *name);
+
+}
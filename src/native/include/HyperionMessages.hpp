@@ -163,6 +163,9 @@ enum class Message {
 	ClearCmdKey = 2071,
 	ClearAllCmdKeys = 2072,
 	SetStylingEx = 2073,
+	SetSemanticTokenStyle = 2818,
+	GetSemanticTokenStyle = 2819,
+	ApplySemanticTokens = 2820,
 	StyleSetVisible = 2074,
 	GetCaretPeriod = 2075,
 	SetCaretPeriod = 2076,
@@ -257,6 +260,7 @@ enum class Message {
 	SetLineIndentation = 2126,
 	GetLineIndentation = 2127,
 	GetLineIndentPosition = 2128,
+	NormalizeWhitespace = 2826,
 	GetColumn = 2129,
 	CountCharacters = 2633,
 	CountCodeUnits = 2715,
@@ -349,6 +353,7 @@ enum class Message {
 	ReplaceTarget = 2194,
 	ReplaceTargetRE = 2195,
 	ReplaceTargetMinimal = 2779,
+	ReloadText = 2837,
 	SearchInTarget = 2197,
 	SetSearchFlags = 2198,
 	GetSearchFlags = 2199,
@@ -483,6 +488,10 @@ enum class Message {
 	LineDelete = 2338,
 	LineTranspose = 2339,
 	LineReverse = 2354,
+	LineSort = 2822,
+	LineUnique = 2823,
+	LineKeepMatching = 2824,
+	LineDropMatching = 2825,
 	LineDuplicate = 2404,
 	LowerCase = 2340,
 	UpperCase = 2341,
@@ -508,6 +517,9 @@ enum class Message {
 	BraceBadLightIndicator = 2499,
 	BraceMatch = 2353,
 	BraceMatchNext = 2369,
+	BraceEnclosing = 2829,
+	SetBraceIndex = 2827,
+	GetBraceIndex = 2828,
 	GetViewEOL = 2355,
 	SetViewEOL = 2356,
 	GetDocPointer = 2357,
@@ -798,6 +810,38 @@ enum class Message {
 	ReleaseLineCharacterIndex = 2712,
 	LineFromIndexPosition = 2713,
 	IndexPositionFromLine = 2714,
+	ConvertPositions = 2821,
+	SetTextCountIndex = 2830,
+	GetTextCountIndex = 2831,
+	GetTextStatistics = 2832,
+	SetContentHashIndex = 2833,
+	GetContentHashIndex = 2834,
+	GetContentHash = 2835,
+	GetContentModified = 2836,
+	DiffDocument = 2838,
+	SetDiffTimeout = 2839,
+	GetDiffTimeout = 2840,
+	DiffGetHunk = 2841,
+	DiffAlignedLine = 2842,
+	DiffIndicate = 2843,
+	DiffPadAnnotations = 2844,
+	SetElasticTabstops = 2845,
+	GetElasticTabstops = 2846,
+	AutoCSetMaxResults = 2847,
+	AutoCGetMaxResults = 2848,
+	SetWordIndex = 2849,
+	GetWordIndex = 2850,
+	AutoCSetWordRanking = 2851,
+	AutoCGetWordRanking = 2852,
+	AutoCGetDocumentWords = 2853,
+	AutoCShowDocumentWords = 2854,
+	ExportSelection = 2855,
+	ExportRange = 2856,
+	SetLogMode = 2857,
+	GetLogMode = 2858,
+	SetLogLineLimit = 2859,
+	GetLogLineLimit = 2860,
+	CallBatch = 2861,
 	StartRecord = 3001,
 	StopRecord = 3002,
 	GetLexer = 4002,
@@ -72,6 +72,60 @@ struct RangeToFormatFull {
 	CharacterRangeFull chrg;
 };
 
+/* Positions in PositionUnit::Line units are (line, column) pairs taking two elements. */
+
+struct PositionConversion {
+	PositionUnit unitsFrom;
+	PositionUnit unitsTo;
+	Position count;
+	const Position *positionsFrom;
+	Position *positionsTo;
+};
+
+/* Set chrg to the range to count with a negative cpMax for the end of the document. */
+
+struct TextStatistics {
+	CharacterRangeFull chrg;
+	Position characters;
+	Position codeUnits;
+	Position words;
+	Position lines;
+};
+
+/* Set chrg to the range to hash with a negative cpMax for the end of the document. */
+
+struct TextHash {
+	CharacterRangeFull chrg;
+	uint64_t hash;
+};
+
+/* Lines [line, line+lines) of the document are replaced by lines
+ * [lineOther, lineOther+linesOther) of the document it was compared with. */
+
+struct DiffHunk {
+	Line line;
+	Line lines;
+	Line lineOther;
+	Line linesOther;
+};
+
+/* write is called with successive pieces of the text of at most chunkSize bytes, 64K when 0,
+ * and returns 0 to stop the export. chrg is the range for Message::ExportRange. rectangular
+ * and lineCopy are set by Message::ExportSelection as they would be for the clipboard. */
+
+using ExportWrite = int (*)(void *context, const char *text, Position length);
+
+struct TextExport {
+	CharacterRangeFull chrg;
+	ExportOption options;
+	EndOfLine eolMode;
+	Position chunkSize;
+	ExportWrite write;
+	void *context;
+	int rectangular;
+	int lineCopy;
+};
+
 struct NotifyHeader {
 	/* Compatible with Windows NMHDR.
 	 * hwndFrom is really an environment specific window handle or pointer
@@ -127,4 +181,23 @@ struct NotificationData {
 	CharacterSource characterSource;	/* SCN_CHARADDED */
 };
 
+/* calls holds length bytes of calls packed one after another. Each BatchCall is followed by
+ * payloadLength bytes which, when not 0, are passed as lParam in place of the lParam field,
+ * then by a NUL so the payload can be read as a C string, and then by padding up to a multiple
+ * of sizeof(sptr_t). Calls may write into their payload. results, when not nullptr, receives
+ * the value returned by each call. Message::CallBatch can not be batched. */
+
+struct BatchCall {
+	Message message;
+	unsigned int payloadLength;
+	uptr_t wParam;
+	sptr_t lParam;
+};
+
+struct Batch {
+	char *calls;
+	Position length;
+	sptr_t *results;
+};
+
 }
\ No newline at end of file
@@ -263,6 +263,8 @@ enum class AutoCompleteOption {
 	Normal = 0,
 	FixedSize = 1,
 	SelectFirstItem = 2,
+	Filter = 4,
+	Fuzzy = 8,
 };
 
 enum class IndentView {
@@ -559,6 +561,44 @@ enum class LineCharacterIndexType {
 	Utf16 = 2,
 };
 
+enum class PositionUnit {
+	Byte = 0,
+	Utf32 = 1,
+	Utf16 = 2,
+	Line = 0x10,
+};
+
+enum class Normalize {
+	None = 0,
+	TrimTrailing = 1,
+	Tabify = 2,
+	Untabify = 4,
+};
+
+enum class LineSort {
+	Lexicographic = 0,
+	CaseInsensitive = 1,
+	Numeric = 2,
+	Descending = 4,
+};
+
+enum class DiffOption {
+	None = 0,
+	Minimal = 1,
+	LinesOnly = 2,
+};
+
+enum class WordRanking {
+	Frequency = 0,
+	Proximity = 1,
+};
+
+enum class ExportOption {
+	None = 0,
+	ConvertEndOfLine = 1,
+	NulToSpace = 2,
+};
+
 enum class TypeProperty {
 	Boolean = 0,
 	Integer = 1,
@@ -725,6 +765,12 @@ inline int operator<<(int i, MarkerOutline marker) noexcept {
 	return i << static_cast<int>(marker);
 }
 
+// Functions to manipulate fields from a AutoCompleteOption
+
+constexpr AutoCompleteOption operator|(AutoCompleteOption a, AutoCompleteOption b) noexcept {
+	return static_cast<AutoCompleteOption>(static_cast<int>(a) | static_cast<int>(b));
+}
+
 // Functions to manipulate fields from a FindOption
 
 constexpr FindOption operator|(FindOption a, FindOption b) noexcept {
@@ -810,6 +856,36 @@ constexpr LineCharacterIndexType operator|(LineCharacterIndexType a, LineCharact
 	return static_cast<LineCharacterIndexType>(static_cast<int>(a) | static_cast<int>(b));
 }
 
+// Functions to manipulate fields from a PositionUnit
+
+constexpr PositionUnit operator|(PositionUnit a, PositionUnit b) noexcept {
+	return static_cast<PositionUnit>(static_cast<int>(a) | static_cast<int>(b));
+}
+
+// Functions to manipulate fields from a Normalize
+
+constexpr Normalize operator|(Normalize a, Normalize b) noexcept {
+	return static_cast<Normalize>(static_cast<int>(a) | static_cast<int>(b));
+}
+
+// Functions to manipulate fields from a LineSort
+
+constexpr LineSort operator|(LineSort a, LineSort b) noexcept {
+	return static_cast<LineSort>(static_cast<int>(a) | static_cast<int>(b));
+}
+
+// Functions to manipulate fields from a DiffOption
+
+constexpr DiffOption operator|(DiffOption a, DiffOption b) noexcept {
+	return static_cast<DiffOption>(static_cast<int>(a) | static_cast<int>(b));
+}
+
+// Functions to manipulate fields from a ExportOption
+
+constexpr ExportOption operator|(ExportOption a, ExportOption b) noexcept {
+	return static_cast<ExportOption>(static_cast<int>(a) | static_cast<int>(b));
+}
+
 // Functions to manipulate fields from a ModificationFlags
 
 constexpr ModificationFlags operator|(ModificationFlags a, ModificationFlags b) noexcept {
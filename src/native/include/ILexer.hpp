@@ -26,7 +26,7 @@
 
 namespace Hyperion {
 
-enum { dvRelease4=2 };
+enum { dvRelease4=2, dvRelease5Styling=3 };
 
 class HYPERION_API IDocument {
 public:
@@ -56,7 +56,23 @@ public:
 	virtual int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const = 0;
 };
 
-enum { lvRelease4=2, lvRelease5=3 };
+/**
+ * Optional extension for documents that accept styles in transactions.
+ * Such documents return dvRelease5Styling from Version.
+ * Between BeginStyling and EndStyling, styles set through SetStyleRange, SetStyles or SetStyleFor
+ * only overwrite the styles that differ and watchers are sent one style change notification
+ * covering every change when the outermost transaction ends.
+ */
+class HYPERION_API IDocumentStyling : public IDocument {
+public:
+	virtual void SCI_METHOD BeginStyling() = 0;
+	/// Set the styles of [position, position + length) from a buffer owned by the caller and
+	/// continue styling after that range.
+	virtual bool SCI_METHOD SetStyleRange(Sci_Position position, Sci_Position length, const char *styles) = 0;
+	virtual void SCI_METHOD EndStyling() = 0;
+};
+
+enum { lvRelease4=2, lvRelease5=3, lvRelease5Restartable=4 };
 
 class HYPERION_API ILexer4 {
 public:
@@ -94,4 +110,21 @@ public:
 	virtual const char * SCI_METHOD PropertyGet(const char *key) = 0;
 };
 
+/**
+ * Optional extension for lexers that can start at some lines without seeing the text before them.
+ * Such lexers return lvRelease5Restartable from Version and only they may return it: a lexer
+ * reporting exactly this version is treated as an ILexer5Restartable, while other versions, even
+ * later ones, are not.
+ * Lexing from a restart point must depend only on the style and line state of the line before it
+ * so that Lex may be called concurrently for separate ranges, each with its own IDocument.
+ */
+class HYPERION_API ILexer5Restartable : public ILexer5 {
+public:
+	/// Style and line state assumed at the end of the line before a restart point.
+	virtual int SCI_METHOD RestartStyle() = 0;
+	virtual int SCI_METHOD RestartLineState() = 0;
+	/// First line in [line, lineLimit) that may be a restart point, else lineLimit.
+	virtual Sci_Position SCI_METHOD RestartLine(Sci_Position line, Sci_Position lineLimit, IDocument *pAccess) = 0;
+};
+
 }
\ No newline at end of file
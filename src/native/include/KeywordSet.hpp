@@ -0,0 +1,206 @@
+// Hyperion source code edit control
+/** @file KeywordSet.hpp
+ ** Keyword lookup through a minimal perfect hash.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+
+namespace Hyperion {
+
+/**
+ * An immutable map from words to small integer values built from word lists as passed to
+ * ILexer5::WordListSet and ILexer5::SetIdentifiers.
+ * Words are placed with a hash-and-displace minimal perfect hash so a lookup hashes the word
+ * once, probes exactly one slot and compares one candidate, without allocating.
+ * Header only so lexers built outside Hyperion can use it.
+ */
+class KeywordSet {
+public:
+	static constexpr int notFound = -1;
+
+	KeywordSet() noexcept = default;
+
+	/// Build from a list of words separated by spaces, tabs or line ends all having value.
+	explicit KeywordSet(std::string_view wordList, int value = 0) {
+		Build({ { wordList, value } });
+	}
+
+	/// Build from several word lists. When a word occurs more than once, the first wins.
+	explicit KeywordSet(const std::vector<std::pair<std::string_view, int>> &wordLists) {
+		Build(wordLists);
+	}
+
+	[[nodiscard]] bool Empty() const noexcept {
+		return slots.empty();
+	}
+
+	/// The value of word or notFound.
+	[[nodiscard]] int ValueFor(std::string_view word) const noexcept {
+		if (word.length() < lengthMin || word.length() > lengthMax || !firstBytes[static_cast<unsigned char>(word[0])]) {
+			return notFound;
+		}
+		const uint64_t hash = Hash(word);
+		const uint32_t displacement = displacements[(hash >> 32) % displacements.size()];
+		const Slot &slot = slots[Mix(hash, displacement) % slots.size()];
+		if (slot.length == word.length() && word.compare(0, slot.length, &text[slot.start], slot.length) == 0) {
+			return slot.value;
+		}
+		return notFound;
+	}
+
+	[[nodiscard]] bool Contains(std::string_view word) const noexcept {
+		return ValueFor(word) != notFound;
+	}
+
+private:
+	// Displacements tried for one bucket before giving up on a table size
+	static constexpr uint32_t displacementLimit = 0x100000;
+
+	struct Slot {
+		uint32_t start = 0;
+		uint32_t length = 0;
+		int value = notFound;
+	};
+	std::string text;	///< Words stored back to back
+	std::vector<Slot> slots;
+	std::vector<uint32_t> displacements;
+	size_t lengthMin = SIZE_MAX;
+	size_t lengthMax = 0;
+	bool firstBytes[256] {};
+
+	static uint64_t Hash(std::string_view word) noexcept {
+		// FNV-1a
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		for (const char ch : word) {
+			hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100000001b3ULL;
+		}
+		return hash;
+	}
+	static uint64_t Mix(uint64_t hash, uint32_t displacement) noexcept {
+		// MurmurHash3 finaliser so each displacement gives an independent placement
+		hash ^= displacement * 0x9e3779b97f4a7c15ULL;
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53ULL;
+		hash ^= hash >> 33;
+		return hash;
+	}
+	void Build(const std::vector<std::pair<std::string_view, int>> &wordLists);
+};
+
+inline void KeywordSet::Build(const std::vector<std::pair<std::string_view, int>> &wordLists) {
+	std::vector<std::pair<std::string_view, int>> words;
+	std::set<std::string_view> seen;
+	const std::string_view separators(" \t\r\n");
+	for (const auto &[wordList, value] : wordLists) {
+		std::string_view list = wordList;
+		while (!list.empty()) {
+			const size_t start = list.find_first_not_of(separators);
+			if (start == std::string_view::npos) {
+				break;
+			}
+			list.remove_prefix(start);
+			const size_t length = std::min(list.find_first_of(separators), list.length());
+			const std::string_view word = list.substr(0, length);
+			if (seen.insert(word).second) {
+				words.emplace_back(word, value);
+			}
+			list.remove_prefix(length);
+		}
+	}
+	if (words.empty()) {
+		return;
+	}
+
+	std::vector<uint64_t> hashes;
+	hashes.reserve(words.size());
+	for (const auto &[word, value] : words) {
+		hashes.push_back(Hash(word));
+		lengthMin = std::min(lengthMin, word.length());
+		lengthMax = std::max(lengthMax, word.length());
+		firstBytes[static_cast<unsigned char>(word[0])] = true;
+		text.append(word);
+	}
+
+	// Hash and displace: words are grouped into buckets by one part of their hash, then
+	// the largest buckets are placed first, each searching for a displacement that moves
+	// all its words into free slots.
+	for (size_t tableSize = words.size(); ; tableSize += tableSize / 8 + 1) {
+		const size_t bucketCount = words.size() / 2 + 1;
+		std::vector<std::vector<size_t>> buckets(bucketCount);
+		for (size_t i = 0; i < words.size(); i++) {
+			buckets[(hashes[i] >> 32) % bucketCount].push_back(i);
+		}
+		std::vector<size_t> order(bucketCount);
+		for (size_t b = 0; b < bucketCount; b++) {
+			order[b] = b;
+		}
+		std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) noexcept {
+			return buckets[a].size() > buckets[b].size();
+		});
+
+		displacements.assign(bucketCount, 0);
+		std::vector<bool> occupied(tableSize);
+		std::vector<size_t> placed(words.size());
+		std::vector<size_t> trial;
+		bool success = true;
+		for (const size_t b : order) {
+			const std::vector<size_t> &bucket = buckets[b];
+			if (bucket.empty()) {
+				break;
+			}
+			uint32_t displacement = 0;
+			for (; displacement < displacementLimit; displacement++) {
+				trial.clear();
+				for (const size_t i : bucket) {
+					const size_t slot = Mix(hashes[i], displacement) % tableSize;
+					if (occupied[slot] || std::find(trial.begin(), trial.end(), slot) != trial.end()) {
+						break;
+					}
+					trial.push_back(slot);
+				}
+				if (trial.size() == bucket.size()) {
+					break;
+				}
+			}
+			if (displacement == displacementLimit) {
+				success = false;
+				break;
+			}
+			displacements[b] = displacement;
+			for (size_t k = 0; k < bucket.size(); k++) {
+				occupied[trial[k]] = true;
+				placed[bucket[k]] = trial[k];
+			}
+		}
+		if (success) {
+			slots.assign(tableSize, Slot());
+			uint32_t start = 0;
+			for (size_t i = 0; i < words.size(); i++) {
+				const uint32_t length = static_cast<uint32_t>(words[i].first.length());
+				slots[placed[i]] = { start, length, words[i].second };
+				start += length;
+			}
+			return;
+		}
+		if (tableSize > words.size() * 4) {
+			// Only reached when distinct words have identical hashes
+			throw std::runtime_error("keyword set could not be hashed");
+		}
+	}
+}
+
+}
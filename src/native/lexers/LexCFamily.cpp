@@ -0,0 +1,89 @@
+// Hyperion source code edit control
+/** @file LexCFamily.cpp
+ ** Grammar for C, C++ and similar languages.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+
+#include "../include/HyperionLexers.hpp"
+#include "../include/KeywordSet.hpp"
+
+#include "TokenGrammar.hpp"
+#include "TableLexer.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+constexpr int Style(StyleCFamily style) noexcept {
+	return static_cast<int>(style);
+}
+
+constexpr char subStyleBases[] = { static_cast<char>(StyleCFamily::Identifier), '\0' };
+
+}
+
+const LexerDefinition Hyperion::Internal::lexerDefinitionCFamily {
+	"cpp",
+	static_cast<int>(LexerIdentifier::CFamily),
+	Style(StyleCFamily::Default),
+	{
+		{ Style(StyleCFamily::Default), R"([ \t\r\n\f\v]+)" },
+		{ Style(StyleCFamily::CommentDoc), R"(/\*[*!]([^*/]([^*]|\*+[^*/])*)?(\*+/)?)" },
+		{ Style(StyleCFamily::Comment), R"(/\*([^*]|\*+[^*/])*(\*+/)?)" },
+		{ Style(StyleCFamily::CommentLineDoc), R"(//[/!][^\r\n]*)" },
+		{ Style(StyleCFamily::CommentLine), R"(//[^\r\n]*)" },
+		{ Style(StyleCFamily::Preprocessor), R"(#[ \t]*[A-Za-z_]*)" },
+		{ Style(StyleCFamily::Number), R"([0-9]([0-9A-Za-z_.']|[eEpP][+-])*|\.[0-9]([0-9A-Za-z_.']|[eEpP][+-])*)" },
+		{ Style(StyleCFamily::String), R"((u8|u|U|L)?"([^"\\\r\n]|\\(.|\r?\n))*"?)" },
+		{ Style(StyleCFamily::Character), R"((u8|u|U|L)?'([^'\\\r\n]|\\.)*'?)" },
+		{ Style(StyleCFamily::RawString), R"re((u8|u|U|L)?R"\(([^)]|\)+[^)"])*(\)+")?)re" },
+		{ Style(StyleCFamily::Identifier), R"([A-Za-z_\x80-\xff][A-Za-z0-9_\x80-\xff]*)", true, '(', Style(StyleCFamily::Function) },
+		{ Style(StyleCFamily::Operator), R"([-+*/%=<>!&|^~?:;,.(){}\[\]])" },
+	},
+	{ Style(StyleCFamily::Keyword), Style(StyleCFamily::Keyword2) },
+	"Primary keywords and identifiers\n"
+	"Secondary keywords and identifiers\n",
+	{
+		"alignas alignof asm auto break case catch class const consteval constexpr constinit const_cast "
+		"continue co_await co_return co_yield decltype default delete do dynamic_cast else enum explicit "
+		"export extern false final for friend goto if inline mutable namespace new noexcept nullptr "
+		"operator override private protected public register reinterpret_cast requires return sizeof "
+		"static static_assert static_cast struct switch template this thread_local throw true try "
+		"typedef typeid typename union using virtual volatile while",
+		"bool char char8_t char16_t char32_t double float int long short signed unsigned void wchar_t "
+		"int8_t int16_t int32_t int64_t uint8_t uint16_t uint32_t uint64_t intptr_t uintptr_t "
+		"size_t ptrdiff_t",
+	},
+	{
+		{ Style(StyleCFamily::Default), "default", "default", "White space" },
+		{ Style(StyleCFamily::Comment), "comment", "comment", "Comment: /* */." },
+		{ Style(StyleCFamily::CommentLine), "comment.line", "comment line", "Line Comment: //." },
+		{ Style(StyleCFamily::CommentDoc), "comment.doc", "comment documentation", "Doc comment: block comments beginning with /** or /*!" },
+		{ Style(StyleCFamily::Number), "number", "literal numeric", "Number" },
+		{ Style(StyleCFamily::Keyword), "keyword", "keyword", "Keyword" },
+		{ Style(StyleCFamily::String), "string", "literal string", "Double quoted string" },
+		{ Style(StyleCFamily::Character), "character", "literal string character", "Single quoted string" },
+		{ Style(StyleCFamily::Preprocessor), "preprocessor", "preprocessor", "Preprocessor" },
+		{ Style(StyleCFamily::Operator), "operator", "operator", "Operators" },
+		{ Style(StyleCFamily::Identifier), "identifier", "identifier", "Identifiers" },
+		{ Style(StyleCFamily::CommentLineDoc), "comment.line.doc", "comment documentation line", "Doc Comment Line: line comments beginning with /// or //!." },
+		{ Style(StyleCFamily::Keyword2), "keyword2", "identifier", "Secondary keywords and identifiers" },
+		{ Style(StyleCFamily::RawString), "string.raw", "literal string raw", "Raw strings for C++0x" },
+		{ Style(StyleCFamily::Function), "function", "identifier function", "Identifier followed by '('" },
+	},
+	FoldMethod::braces,
+	Style(StyleCFamily::Operator),
+	"{",
+	"}",
+	subStyleBases,
+};
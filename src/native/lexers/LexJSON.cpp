@@ -0,0 +1,66 @@
+// Hyperion source code edit control
+/** @file LexJSON.cpp
+ ** Grammar for JSON and JSON with comments.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+
+#include "../include/HyperionLexers.hpp"
+#include "../include/KeywordSet.hpp"
+
+#include "TokenGrammar.hpp"
+#include "TableLexer.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+constexpr int Style(StyleJSON style) noexcept {
+	return static_cast<int>(style);
+}
+
+}
+
+const LexerDefinition Hyperion::Internal::lexerDefinitionJSON {
+	"json",
+	static_cast<int>(LexerIdentifier::JSON),
+	Style(StyleJSON::Default),
+	{
+		{ Style(StyleJSON::Default), R"([ \t\r\n]+)" },
+		{ Style(StyleJSON::String), R"("([^"\\\r\n]|\\.)*"?)", false, ':', Style(StyleJSON::PropertyName) },
+		{ Style(StyleJSON::Number), R"(-?[0-9]+(\.[0-9]+)?([eE][+-]?[0-9]+)?)" },
+		{ Style(StyleJSON::Error), R"([A-Za-z_][A-Za-z0-9_]*)", true },
+		{ Style(StyleJSON::Operator), R"([{}\[\]:,])" },
+		{ Style(StyleJSON::LineComment), R"(//[^\r\n]*)" },
+		{ Style(StyleJSON::BlockComment), R"(/\*([^*]|\*+[^*/])*(\*+/)?)" },
+	},
+	{ Style(StyleJSON::Keyword) },
+	"Keywords\n",
+	{
+		"true false null",
+	},
+	{
+		{ Style(StyleJSON::Default), "default", "default", "White space" },
+		{ Style(StyleJSON::Number), "number", "literal numeric", "Number" },
+		{ Style(StyleJSON::String), "string", "literal string", "String" },
+		{ Style(StyleJSON::PropertyName), "property", "identifier", "Property name" },
+		{ Style(StyleJSON::LineComment), "comment.line", "comment line", "Line comment" },
+		{ Style(StyleJSON::BlockComment), "comment", "comment", "Block comment" },
+		{ Style(StyleJSON::Operator), "operator", "operator", "Brackets, colons and commas" },
+		{ Style(StyleJSON::Keyword), "keyword", "keyword", "true, false and null" },
+		{ Style(StyleJSON::Error), "error", "error", "Bare words that are not keywords" },
+	},
+	FoldMethod::braces,
+	Style(StyleJSON::Operator),
+	"{[",
+	"}]",
+};
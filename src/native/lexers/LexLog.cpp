@@ -0,0 +1,72 @@
+// Hyperion source code edit control
+/** @file LexLog.cpp
+ ** Grammar for application log files.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+
+#include "../include/HyperionLexers.hpp"
+#include "../include/KeywordSet.hpp"
+
+#include "TokenGrammar.hpp"
+#include "TableLexer.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+constexpr int Style(StyleLog style) noexcept {
+	return static_cast<int>(style);
+}
+
+}
+
+const LexerDefinition Hyperion::Internal::lexerDefinitionLog {
+	"log",
+	static_cast<int>(LexerIdentifier::Log),
+	Style(StyleLog::Default),
+	{
+		{ Style(StyleLog::Default), R"([ \t\r\n]+)" },
+		{ Style(StyleLog::Date), R"([0-9][0-9][0-9][0-9][-/][0-9][0-9][-/][0-9][0-9]([T ][0-9][0-9]:[0-9][0-9](:[0-9][0-9]([.,][0-9]+)?)?)?(Z|[+-][0-9][0-9]:?[0-9][0-9])?)" },
+		{ Style(StyleLog::Date), R"([0-9][0-9]:[0-9][0-9]:[0-9][0-9]([.,][0-9]+)?)" },
+		{ Style(StyleLog::Number), R"([0-9]+(\.[0-9]+)*|0[xX][0-9A-Fa-f]+)" },
+		{ Style(StyleLog::String), R"("([^"\\\r\n]|\\.)*"?)" },
+		{ Style(StyleLog::URL), R"([A-Za-z][A-Za-z0-9+.-]*://[^ \t\r\n"'<>]*)" },
+		{ Style(StyleLog::Identifier), R"([A-Za-z_][A-Za-z0-9_]*)", true },
+		{ Style(StyleLog::Operator), R"([-+*/%=<>!&|^~?:;,.(){}\[\]@#$])" },
+	},
+	{ Style(StyleLog::Error), Style(StyleLog::Warning), Style(StyleLog::Info), Style(StyleLog::Debug) },
+	"Error levels\n"
+	"Warning levels\n"
+	"Information levels\n"
+	"Debug levels\n",
+	{
+		"ERROR FATAL CRITICAL SEVERE EMERG ALERT CRIT ERR Error Fatal Critical error fatal critical",
+		"WARN WARNING Warn Warning warn warning",
+		"INFO NOTICE Info Notice info notice",
+		"DEBUG TRACE VERBOSE FINE FINER FINEST Debug Trace Verbose debug trace verbose",
+	},
+	{
+		{ Style(StyleLog::Default), "default", "default", "White space and text" },
+		{ Style(StyleLog::Date), "date", "literal date", "Dates and times" },
+		{ Style(StyleLog::Number), "number", "literal numeric", "Number" },
+		{ Style(StyleLog::String), "string", "literal string", "Double quoted string" },
+		{ Style(StyleLog::Error), "error", "error", "Error level" },
+		{ Style(StyleLog::Warning), "warning", "warning", "Warning level" },
+		{ Style(StyleLog::Info), "info", "information", "Information level" },
+		{ Style(StyleLog::Debug), "debug", "debug", "Debug and trace levels" },
+		{ Style(StyleLog::URL), "url", "literal url", "URL" },
+		{ Style(StyleLog::Operator), "operator", "operator", "Punctuation" },
+		{ Style(StyleLog::Identifier), "identifier", "identifier", "Words" },
+	},
+	FoldMethod::indentation,
+};
@@ -0,0 +1,80 @@
+// Hyperion source code edit control
+/** @file Lexers.cpp
+ ** Catalogue of the built-in lexers.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <iterator>
+
+#include "../include/HyperionLexers.hpp"
+#include "../include/KeywordSet.hpp"
+
+#include "TokenGrammar.hpp"
+#include "TableLexer.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+const LexerDefinition *const catalogue[] = {
+	&lexerDefinitionCFamily,
+	&lexerDefinitionJSON,
+	&lexerDefinitionLog,
+};
+
+// Grammars are compiled on first use and then shared by all lexers of that language.
+std::shared_ptr<const TokenDFA> CompiledGrammar(const LexerDefinition &definition) {
+	static std::mutex mutexCompile;
+	static std::map<const LexerDefinition *, std::shared_ptr<const TokenDFA>> compiled;
+	const std::lock_guard<std::mutex> guard(mutexCompile);
+	std::shared_ptr<const TokenDFA> &dfa = compiled[&definition];
+	if (!dfa) {
+		std::vector<const char *> patterns;
+		for (const TokenRule &rule : definition.rules) {
+			patterns.push_back(rule.pattern);
+		}
+		dfa = std::make_shared<const TokenDFA>(patterns);
+	}
+	return dfa;
+}
+
+}
+
+namespace Hyperion {
+
+int GetLexerCount() noexcept {
+	return static_cast<int>(std::size(catalogue));
+}
+
+const char *GetLexerName(int index) noexcept {
+	if (index < 0 || index >= GetLexerCount()) {
+		return nullptr;
+	}
+	return catalogue[index]->name;
+}
+
+ILexer5 *CreateLexer(const char *name) {
+	if (!name) {
+		return nullptr;
+	}
+	for (const LexerDefinition *definition : catalogue) {
+		if (std::string_view(name) == definition->name) {
+			return new TableLexer(*definition, CompiledGrammar(*definition));
+		}
+	}
+	return nullptr;
+}
+
+}
@@ -0,0 +1,548 @@
+// Hyperion source code edit control
+/** @file TableLexer.cpp
+ ** Lexer driven by a declarative token grammar compiled into DFA tables.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/ILexer.hpp"
+#include "../include/KeywordSet.hpp"
+
+#include "TokenGrammar.hpp"
+#include "TableLexer.hpp"
+
+using namespace Hyperion;
+using namespace Hyperion::Internal;
+
+namespace {
+
+constexpr int foldBase = static_cast<int>(FoldLevel::Base);
+constexpr int foldNumberMask = static_cast<int>(FoldLevel::NumberMask);
+constexpr int foldHeader = static_cast<int>(FoldLevel::HeaderFlag);
+constexpr int foldWhite = static_cast<int>(FoldLevel::WhiteFlag);
+
+// Longer tokens are never keywords so are not copied for lookup.
+constexpr Sci_Position maxKeywordLength = 0x100;
+
+// Substyles are allocated from a block above the lexer's own styles.
+constexpr int subStyleFirst = 0x80;
+constexpr int subStylesAvailable = 0x40;
+
+// Reads document text in blocks so scanning avoids a virtual call per byte
+// and does not move the document's gap as BufferPointer would.
+class TextReader {
+	static constexpr Sci_Position bufferSize = 0x4000;
+	IDocument *pAccess;
+	Sci_Position lengthDocument;
+	Sci_Position startBuffer = 0;
+	Sci_Position endBuffer = 0;
+	char buffer[bufferSize];
+
+	void Fill(Sci_Position position) {
+		// Keep some text before position as callers sometimes move backwards
+		startBuffer = (position < startBuffer) ? std::max<Sci_Position>(position - bufferSize * 3 / 4, 0) : position;
+		endBuffer = std::min(startBuffer + bufferSize, lengthDocument);
+		pAccess->GetCharRange(buffer, startBuffer, endBuffer - startBuffer);
+	}
+
+public:
+	explicit TextReader(IDocument *pAccess_) : pAccess(pAccess_), lengthDocument(pAccess_->Length()), buffer{} {
+	}
+	Sci_Position Length() const noexcept {
+		return lengthDocument;
+	}
+	unsigned char UCharAt(Sci_Position position) {
+		if (position < startBuffer || position >= endBuffer) {
+			if (position < 0 || position >= lengthDocument) {
+				return 0;
+			}
+			Fill(position);
+		}
+		return static_cast<unsigned char>(buffer[position - startBuffer]);
+	}
+};
+
+// Accumulates styles and sends them to the document in large batches, inside one
+// styling transaction when the document supports them.
+class StyleWriter {
+	static constexpr size_t batchSize = 0x10000;
+	IDocument *pAccess;
+	IDocumentStyling *styling = nullptr;
+	Sci_Position position;
+	std::vector<char> styles;
+public:
+	StyleWriter(IDocument *pAccess_, Sci_Position start) : pAccess(pAccess_), position(start) {
+		if (pAccess->Version() >= dvRelease5Styling) {
+			styling = static_cast<IDocumentStyling *>(pAccess);
+			styling->BeginStyling();
+		} else {
+			pAccess->StartStyling(start);
+		}
+		styles.reserve(batchSize);
+	}
+	// Not copyable or movable as the transaction is ended by the destructor
+	StyleWriter(const StyleWriter &) = delete;
+	StyleWriter(StyleWriter &&) = delete;
+	StyleWriter &operator=(const StyleWriter &) = delete;
+	StyleWriter &operator=(StyleWriter &&) = delete;
+	~StyleWriter() {
+		Flush();
+		if (styling) {
+			styling->EndStyling();
+		}
+	}
+	void Add(Sci_Position length, int style) {
+		while (length > 0) {
+			const size_t chunk = std::min(static_cast<size_t>(length), batchSize - styles.size());
+			styles.insert(styles.end(), chunk, static_cast<char>(style));
+			length -= chunk;
+			if (styles.size() == batchSize) {
+				Flush();
+			}
+		}
+	}
+	void Flush() {
+		if (!styles.empty()) {
+			if (styling) {
+				styling->SetStyleRange(position, styles.size(), styles.data());
+			} else {
+				pAccess->SetStyles(styles.size(), styles.data());
+			}
+			position += styles.size();
+			styles.clear();
+		}
+	}
+};
+
+bool IsBlankLine(TextReader &reader, Sci_Position start, Sci_Position end) {
+	for (Sci_Position pos = start; pos < end; pos++) {
+		const unsigned char ch = reader.UCharAt(pos);
+		if (ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n') {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+TableLexer::TableLexer(const LexerDefinition &definition_, std::shared_ptr<const TokenDFA> dfa_) :
+	definition(definition_), dfa(std::move(dfa_)) {
+	wordLists.resize(definition.keywordStyles.size());
+	for (size_t n = 0; n < definition.defaultWordLists.size() && n < wordLists.size(); n++) {
+		WordListSet(static_cast<int>(n), definition.defaultWordLists[n]);
+	}
+}
+
+int SCI_METHOD TableLexer::Version() const {
+	return lvRelease5Restartable;
+}
+
+void SCI_METHOD TableLexer::Release() {
+	delete this;
+}
+
+const char * SCI_METHOD TableLexer::PropertyNames() {
+	return "fold";
+}
+
+int SCI_METHOD TableLexer::PropertyType(const char *name) {
+	if (name && std::string_view(name) == "fold") {
+		return static_cast<int>(TypeProperty::Boolean);
+	}
+	return -1;
+}
+
+const char * SCI_METHOD TableLexer::DescribeProperty(const char *name) {
+	if (name && std::string_view(name) == "fold") {
+		return "Enable folding.";
+	}
+	return "";
+}
+
+Sci_Position SCI_METHOD TableLexer::PropertySet(const char *key, const char *val) {
+	if (key && val && std::string_view(key) == "fold") {
+		const bool foldNew = atoi(val) != 0;
+		if (fold != foldNew) {
+			fold = foldNew;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+const char * SCI_METHOD TableLexer::PropertyGet(const char *key) {
+	propertyValue.clear();
+	if (key && std::string_view(key) == "fold") {
+		propertyValue = fold ? "1" : "0";
+	}
+	return propertyValue.c_str();
+}
+
+const char * SCI_METHOD TableLexer::DescribeWordListSets() {
+	return definition.wordListDescriptions;
+}
+
+Sci_Position SCI_METHOD TableLexer::WordListSet(int n, const char *wl) {
+	if (n < 0 || static_cast<size_t>(n) >= wordLists.size() || !wl || wordLists[n] == wl) {
+		return -1;
+	}
+	wordLists[n] = wl;
+	std::vector<std::pair<std::string_view, int>> lists;
+	for (size_t list = 0; list < wordLists.size(); list++) {
+		lists.emplace_back(wordLists[list], definition.keywordStyles[list]);
+	}
+	keywords = KeywordSet(lists);
+	return 0;
+}
+
+int TableLexer::BlockFromBase(int styleBase) const noexcept {
+	for (size_t b = 0; b < subStyles.size(); b++) {
+		if (subStyles[b].base == styleBase) {
+			return static_cast<int>(b);
+		}
+	}
+	return -1;
+}
+
+int TableLexer::BlockFromStyle(int style) const noexcept {
+	for (size_t b = 0; b < subStyles.size(); b++) {
+		if (style >= subStyles[b].start && style < subStyles[b].start + subStyles[b].length) {
+			return static_cast<int>(b);
+		}
+	}
+	return -1;
+}
+
+int TableLexer::Classify(const TokenRule &rule, std::string_view token) const noexcept {
+	if (rule.keywords) {
+		const int style = keywords.ValueFor(token);
+		if (style != KeywordSet::notFound) {
+			return style;
+		}
+	}
+	const int block = BlockFromBase(rule.style);
+	if (block >= 0) {
+		const int style = subStyles[block].classifier.ValueFor(token);
+		if (style != KeywordSet::notFound) {
+			return style;
+		}
+	}
+	return rule.style;
+}
+
+void SCI_METHOD TableLexer::Lex(Sci_PositionU startPos, Sci_Position lengthDoc, int, IDocument *pAccess) {
+	const Sci_Position end = startPos + lengthDoc;
+	TextReader reader(pAccess);
+	const Sci_Position lineLast = pAccess->LineFromPosition(reader.Length());
+	Sci_Position line = pAccess->LineFromPosition(startPos);
+	Sci_Position position = pAccess->LineStart(line);
+	StyleWriter writer(pAccess, position);
+	char token[maxKeywordLength];
+
+	// Whole lines are lexed. A token still matching at the end of a line continues on the
+	// next line from the DFA state saved as the line state.
+	unsigned int carried = (line > 0) ? static_cast<unsigned int>(pAccess->GetLineState(line - 1)) : 0;
+	if (carried >= dfa->States()) {
+		carried = 0;
+	}
+	while (position < end && line <= lineLast) {
+		const Sci_Position lineEnd = pAccess->LineStart(line + 1);
+		unsigned int continuing = TokenDFA::deadState;
+		while (position < lineEnd) {
+			unsigned int state = carried ? carried : TokenDFA::startState;
+			int ruleIndex = TokenDFA::noMatch;
+			Sci_Position length = dfa->Match(reader, position, lineEnd, state, ruleIndex);
+			if (carried) {
+				carried = 0;
+				if (length == 0) {
+					// Token ended at the end of the previous line
+					continue;
+				}
+			}
+			int style = definition.styleDefault;
+			if (length == 0) {
+				length = 1;
+			} else {
+				const TokenRule &rule = definition.rules[ruleIndex];
+				style = rule.style;
+				if ((rule.keywords || !subStyles.empty()) && length <= maxKeywordLength) {
+					for (Sci_Position pos = 0; pos < length; pos++) {
+						token[pos] = static_cast<char>(reader.UCharAt(position + pos));
+					}
+					style = Classify(rule, std::string_view(token, length));
+				}
+				if (rule.followedBy && style == rule.style) {
+					Sci_Position pos = position + length;
+					while (reader.UCharAt(pos) == ' ' || reader.UCharAt(pos) == '\t') {
+						pos++;
+					}
+					if (reader.UCharAt(pos) == static_cast<unsigned char>(rule.followedBy)) {
+						style = rule.styleFollowed;
+					}
+				}
+			}
+			writer.Add(length, style);
+			position += length;
+			if (position == lineEnd && state != TokenDFA::deadState && style != definition.styleDefault) {
+				continuing = state;
+			}
+		}
+		if (line < lineLast) {
+			pAccess->SetLineState(line, static_cast<int>(continuing));
+		}
+		carried = continuing;
+		line++;
+	}
+	writer.Flush();
+}
+
+void SCI_METHOD TableLexer::Fold(Sci_PositionU startPos, Sci_Position lengthDoc, int, IDocument *pAccess) {
+	if (!fold || lengthDoc <= 0) {
+		return;
+	}
+	switch (definition.fold) {
+	case FoldMethod::braces:
+		FoldBraces(startPos, lengthDoc, pAccess);
+		break;
+	case FoldMethod::indentation:
+		FoldIndentation(startPos, lengthDoc, pAccess);
+		break;
+	default:
+		break;
+	}
+}
+
+// The level at the start of each line is in the low 16 bits and the level
+// after the line in the high 16 bits so folding can resume at any line.
+void TableLexer::FoldBraces(Sci_PositionU startPos, Sci_Position lengthDoc, IDocument *pAccess) const {
+	bool isOpen[256] {};
+	bool isClose[256] {};
+	for (const char *p = definition.foldOpen; *p; p++) {
+		isOpen[static_cast<unsigned char>(*p)] = true;
+	}
+	for (const char *p = definition.foldClose; *p; p++) {
+		isClose[static_cast<unsigned char>(*p)] = true;
+	}
+
+	TextReader reader(pAccess);
+	Sci_Position line = pAccess->LineFromPosition(startPos);
+	const Sci_Position lineLast = pAccess->LineFromPosition(startPos + lengthDoc - 1);
+	int levelCurrent = foldBase;
+	if (line > 0) {
+		levelCurrent = pAccess->GetLevel(line - 1) >> 16;
+		if (levelCurrent < foldBase) {
+			levelCurrent = foldBase;
+		}
+	}
+	Sci_Position lineStart = pAccess->LineStart(line);
+	for (; line <= lineLast; line++) {
+		const Sci_Position lineNext = pAccess->LineStart(line + 1);
+		int levelNext = levelCurrent;
+		for (Sci_Position pos = lineStart; pos < lineNext; pos++) {
+			const unsigned char ch = reader.UCharAt(pos);
+			if ((isOpen[ch] || isClose[ch]) && pAccess->StyleAt(pos) == definition.styleFoldBrace) {
+				levelNext += isOpen[ch] ? 1 : -1;
+			}
+		}
+		levelNext = std::clamp(levelNext, foldBase, foldNumberMask);
+		int level = levelCurrent | (levelNext << 16);
+		if (levelNext > levelCurrent) {
+			level |= foldHeader;
+		}
+		if (level != pAccess->GetLevel(line)) {
+			pAccess->SetLevel(line, level);
+		}
+		levelCurrent = levelNext;
+		lineStart = lineNext;
+	}
+}
+
+// Levels follow indentation: a line is a header when the next non-blank line is
+// indented further and blank lines take the level of the next non-blank line.
+void TableLexer::FoldIndentation(Sci_PositionU startPos, Sci_Position lengthDoc, IDocument *pAccess) const {
+	TextReader reader(pAccess);
+	const Sci_Position lineLastDocument = pAccess->LineFromPosition(reader.Length());
+	auto blank = [&](Sci_Position line) {
+		return IsBlankLine(reader, pAccess->LineStart(line), pAccess->LineStart(line + 1));
+	};
+
+	// The previous non-blank line's header flag and any blank lines before
+	// the range depend on the first line of the range.
+	Sci_Position lineFirst = pAccess->LineFromPosition(startPos);
+	if (lineFirst > 0) {
+		lineFirst--;
+		while (lineFirst > 0 && blank(lineFirst)) {
+			lineFirst--;
+		}
+	}
+	const Sci_Position lineLast = pAccess->LineFromPosition(startPos + lengthDoc - 1);
+
+	Sci_Position lineNext = lineLast + 1;
+	while (lineNext <= lineLastDocument && blank(lineNext)) {
+		lineNext++;
+	}
+	int indentNext = (lineNext <= lineLastDocument) ? pAccess->GetLineIndentation(lineNext) : 0;
+
+	for (Sci_Position line = lineLast; line >= lineFirst; line--) {
+		int level;
+		if (blank(line)) {
+			level = (foldBase + std::min(indentNext, foldNumberMask - foldBase)) | foldWhite;
+		} else {
+			const int indent = pAccess->GetLineIndentation(line);
+			level = foldBase + std::min(indent, foldNumberMask - foldBase);
+			if (indentNext > indent) {
+				level |= foldHeader;
+			}
+			indentNext = indent;
+		}
+		if (level != pAccess->GetLevel(line)) {
+			pAccess->SetLevel(line, level);
+		}
+	}
+}
+
+void * SCI_METHOD TableLexer::PrivateCall(int, void *) {
+	return nullptr;
+}
+
+int SCI_METHOD TableLexer::LineEndTypesSupported() {
+	return static_cast<int>(LineEndType::Default);
+}
+
+int SCI_METHOD TableLexer::AllocateSubStyles(int styleBase, int numberStyles) {
+	if (styleBase <= 0 || styleBase > UCHAR_MAX || numberStyles < 0 ||
+		!std::strchr(definition.subStyleBases, styleBase) ||
+		subStylesAllocated + numberStyles > subStylesAvailable) {
+		return -1;
+	}
+	const int start = subStyleFirst + subStylesAllocated;
+	subStylesAllocated += numberStyles;
+	int block = BlockFromBase(styleBase);
+	if (block < 0) {
+		block = static_cast<int>(subStyles.size());
+		subStyles.push_back({ styleBase, 0, 0, {}, {} });
+	}
+	subStyles[block].start = start;
+	subStyles[block].length = numberStyles;
+	subStyles[block].identifiers.assign(numberStyles, std::string());
+	subStyles[block].classifier = KeywordSet();
+	return start;
+}
+
+int SCI_METHOD TableLexer::SubStylesStart(int styleBase) {
+	const int block = BlockFromBase(styleBase);
+	return (block >= 0) ? subStyles[block].start : -1;
+}
+
+int SCI_METHOD TableLexer::SubStylesLength(int styleBase) {
+	const int block = BlockFromBase(styleBase);
+	return (block >= 0) ? subStyles[block].length : 0;
+}
+
+int SCI_METHOD TableLexer::StyleFromSubStyle(int subStyle) {
+	const int block = BlockFromStyle(subStyle);
+	return (block >= 0) ? subStyles[block].base : subStyle;
+}
+
+int SCI_METHOD TableLexer::PrimaryStyleFromStyle(int style) {
+	return style;
+}
+
+void SCI_METHOD TableLexer::FreeSubStyles() {
+	subStyles.clear();
+	subStylesAllocated = 0;
+}
+
+void SCI_METHOD TableLexer::SetIdentifiers(int style, const char *identifiers) {
+	const int block = BlockFromStyle(style);
+	if (block < 0 || !identifiers) {
+		return;
+	}
+	SubStyleBlock &subStyleBlock = subStyles[block];
+	subStyleBlock.identifiers[style - subStyleBlock.start] = identifiers;
+	// Words listed for an earlier substyle take priority
+	std::vector<std::pair<std::string_view, int>> lists;
+	for (int n = 0; n < subStyleBlock.length; n++) {
+		lists.emplace_back(subStyleBlock.identifiers[n], subStyleBlock.start + n);
+	}
+	subStyleBlock.classifier = KeywordSet(lists);
+}
+
+int SCI_METHOD TableLexer::DistanceToSecondaryStyles() {
+	return 0;
+}
+
+const char * SCI_METHOD TableLexer::GetSubStyleBases() {
+	return definition.subStyleBases;
+}
+
+int SCI_METHOD TableLexer::NamedStyles() {
+	int styles = 0;
+	for (const StyleDescription &description : definition.styles) {
+		styles = std::max(styles, description.style + 1);
+	}
+	return styles;
+}
+
+const char * SCI_METHOD TableLexer::NameOfStyle(int style) {
+	for (const StyleDescription &description : definition.styles) {
+		if (description.style == style) {
+			return description.name;
+		}
+	}
+	return "";
+}
+
+const char * SCI_METHOD TableLexer::TagsOfStyle(int style) {
+	for (const StyleDescription &description : definition.styles) {
+		if (description.style == style) {
+			return description.tags;
+		}
+	}
+	return "";
+}
+
+const char * SCI_METHOD TableLexer::DescriptionOfStyle(int style) {
+	for (const StyleDescription &description : definition.styles) {
+		if (description.style == style) {
+			return description.description;
+		}
+	}
+	return "";
+}
+
+const char * SCI_METHOD TableLexer::GetName() {
+	return definition.name;
+}
+
+int SCI_METHOD TableLexer::GetIdentifier() {
+	return definition.identifier;
+}
+
+int SCI_METHOD TableLexer::RestartStyle() {
+	return definition.styleDefault;
+}
+
+int SCI_METHOD TableLexer::RestartLineState() {
+	return 0;
+}
+
+Sci_Position SCI_METHOD TableLexer::RestartLine(Sci_Position line, Sci_Position, IDocument *) {
+	// Any line may be a restart point: a line starting inside a token fails validation.
+	return line;
+}
@@ -0,0 +1,117 @@
+// Hyperion source code edit control
+/** @file TableLexer.hpp
+ ** Lexer driven by a declarative token grammar compiled into DFA tables.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+enum class FoldMethod { none, braces, indentation };
+
+struct TokenRule {
+	int style;
+	const char *pattern;
+	bool keywords = false;	///< Restyle through the word lists when the token is a listed word
+	char followedBy = 0;	///< Use styleFollowed when the next non-blank character on the line is this
+	int styleFollowed = 0;
+};
+
+struct StyleDescription {
+	int style;
+	const char *name;
+	const char *tags;
+	const char *description;
+};
+
+struct LexerDefinition {
+	const char *name;
+	int identifier;
+	int styleDefault;
+	std::vector<TokenRule> rules;
+	/// Style for words found in each word list, in priority order.
+	std::vector<int> keywordStyles;
+	const char *wordListDescriptions;	///< One description per line
+	std::vector<const char *> defaultWordLists;
+	std::vector<StyleDescription> styles;
+	FoldMethod fold = FoldMethod::none;
+	int styleFoldBrace = 0;	///< Only brackets in this style fold
+	const char *foldOpen = "{[";
+	const char *foldClose = "}]";
+	/// Styles that may have substyles, one byte each.
+	const char *subStyleBases = "";
+};
+
+/**
+ * Lexer implementing ILexer5 from a LexerDefinition.
+ * Each token is the longest match of any rule starting at the current position and unmatched
+ * characters are given the default style. When a token in a non-default style is still matching
+ * at the end of a line, the DFA state is saved as that line's state and the token continues on
+ * the next line, so rules for tokens that span lines should accept at every line end.
+ * Lex only touches local state so it is restartable at any line and may run concurrently.
+ */
+class TableLexer final : public ILexer5Restartable {
+	struct SubStyleBlock {
+		int base;
+		int start;
+		int length;
+		std::vector<std::string> identifiers;	///< Word list for each substyle
+		KeywordSet classifier;
+	};
+	const LexerDefinition &definition;
+	std::shared_ptr<const TokenDFA> dfa;
+	std::vector<std::string> wordLists;
+	KeywordSet keywords;	///< Words of all lists mapped to their style
+	std::vector<SubStyleBlock> subStyles;
+	int subStylesAllocated = 0;
+	bool fold = false;
+	std::string propertyValue;
+
+	int BlockFromBase(int styleBase) const noexcept;
+	int BlockFromStyle(int style) const noexcept;
+	int Classify(const TokenRule &rule, std::string_view token) const noexcept;
+	void FoldBraces(Sci_PositionU startPos, Sci_Position lengthDoc, IDocument *pAccess) const;
+	void FoldIndentation(Sci_PositionU startPos, Sci_Position lengthDoc, IDocument *pAccess) const;
+
+public:
+	TableLexer(const LexerDefinition &definition_, std::shared_ptr<const TokenDFA> dfa_);
+
+	int SCI_METHOD Version() const override;
+	void SCI_METHOD Release() override;
+	const char * SCI_METHOD PropertyNames() override;
+	int SCI_METHOD PropertyType(const char *name) override;
+	const char * SCI_METHOD DescribeProperty(const char *name) override;
+	Sci_Position SCI_METHOD PropertySet(const char *key, const char *val) override;
+	const char * SCI_METHOD DescribeWordListSets() override;
+	Sci_Position SCI_METHOD WordListSet(int n, const char *wl) override;
+	void SCI_METHOD Lex(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, IDocument *pAccess) override;
+	void SCI_METHOD Fold(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, IDocument *pAccess) override;
+	void * SCI_METHOD PrivateCall(int operation, void *pointer) override;
+	int SCI_METHOD LineEndTypesSupported() override;
+	int SCI_METHOD AllocateSubStyles(int styleBase, int numberStyles) override;
+	int SCI_METHOD SubStylesStart(int styleBase) override;
+	int SCI_METHOD SubStylesLength(int styleBase) override;
+	int SCI_METHOD StyleFromSubStyle(int subStyle) override;
+	int SCI_METHOD PrimaryStyleFromStyle(int style) override;
+	void SCI_METHOD FreeSubStyles() override;
+	void SCI_METHOD SetIdentifiers(int style, const char *identifiers) override;
+	int SCI_METHOD DistanceToSecondaryStyles() override;
+	const char * SCI_METHOD GetSubStyleBases() override;
+	int SCI_METHOD NamedStyles() override;
+	const char * SCI_METHOD NameOfStyle(int style) override;
+	const char * SCI_METHOD TagsOfStyle(int style) override;
+	const char * SCI_METHOD DescriptionOfStyle(int style) override;
+	const char * SCI_METHOD GetName() override;
+	int SCI_METHOD GetIdentifier() override;
+	const char * SCI_METHOD PropertyGet(const char *key) override;
+	int SCI_METHOD RestartStyle() override;
+	int SCI_METHOD RestartLineState() override;
+	Sci_Position SCI_METHOD RestartLine(Sci_Position line, Sci_Position lineLimit, IDocument *pAccess) override;
+};
+
+extern const LexerDefinition lexerDefinitionCFamily;
+extern const LexerDefinition lexerDefinitionJSON;
+extern const LexerDefinition lexerDefinitionLog;
+
+}
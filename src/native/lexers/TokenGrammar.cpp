@@ -0,0 +1,367 @@
+// Hyperion source code edit control
+/** @file TokenGrammar.cpp
+ ** Compile a list of token patterns into a deterministic finite automaton.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <bitset>
+#include <algorithm>
+
+#include "../include/Hyp_Position.hpp"
+
+#include "TokenGrammar.hpp"
+
+using namespace Hyperion::Internal;
+
+namespace {
+
+using ByteSet = std::bitset<256>;
+
+// Thompson construction: each state has at most one byte set transition and any
+// number of empty transitions.
+struct NFAState {
+	ByteSet bytes;
+	int next = -1;
+	std::vector<int> empty;
+	int accept = TokenDFA::noMatch;
+};
+
+class NFABuilder {
+	struct Fragment {
+		int start;
+		int end;	// Has no outgoing transitions until linked into an enclosing fragment
+	};
+	const char *pattern = nullptr;
+	const char *p = nullptr;
+
+	[[noreturn]] void Fail(const char *reason) const {
+		throw std::invalid_argument(std::string("token pattern ") + reason + ": " + pattern);
+	}
+
+	int NewState() {
+		states.emplace_back();
+		return static_cast<int>(states.size() - 1);
+	}
+
+	void Link(int from, int to) {
+		states[from].empty.push_back(to);
+	}
+
+	static int HexDigit(char ch) noexcept {
+		if (ch >= '0' && ch <= '9')
+			return ch - '0';
+		if (ch >= 'a' && ch <= 'f')
+			return ch - 'a' + 10;
+		if (ch >= 'A' && ch <= 'F')
+			return ch - 'A' + 10;
+		return -1;
+	}
+
+	static void AddRange(ByteSet &set, int first, int last) {
+		for (int ch = first; ch <= last; ch++) {
+			set.set(ch);
+		}
+	}
+
+	// Parse the escape after a '\'. Returns the byte for single byte escapes or -1 for classes.
+	int ParseEscape(ByteSet &set) {
+		const char ch = *p++;
+		switch (ch) {
+		case '\0':
+			Fail("ends with '\\'");
+		case 'd':
+			AddRange(set, '0', '9');
+			return -1;
+		case 'w':
+			AddRange(set, '0', '9');
+			AddRange(set, 'A', 'Z');
+			AddRange(set, 'a', 'z');
+			set.set('_');
+			return -1;
+		case 's':
+			for (const char space : std::string_view(" \t\r\n\f\v")) {
+				set.set(static_cast<unsigned char>(space));
+			}
+			return -1;
+		case 'n':
+			set.set('\n');
+			return '\n';
+		case 'r':
+			set.set('\r');
+			return '\r';
+		case 't':
+			set.set('\t');
+			return '\t';
+		case 'f':
+			set.set('\f');
+			return '\f';
+		case 'v':
+			set.set('\v');
+			return '\v';
+		case 'x': {
+				const int high = HexDigit(p[0]);
+				const int low = (high >= 0) ? HexDigit(p[1]) : -1;
+				if (low < 0) {
+					Fail("has a bad \\x escape");
+				}
+				p += 2;
+				const int value = high * 16 + low;
+				set.set(value);
+				return value;
+			}
+		default:
+			set.set(static_cast<unsigned char>(ch));
+			return static_cast<unsigned char>(ch);
+		}
+	}
+
+	ByteSet ParseClass() {
+		ByteSet set;
+		const bool negate = *p == '^';
+		if (negate) {
+			p++;
+		}
+		bool first = true;
+		while (*p != ']' || first) {
+			first = false;
+			if (*p == '\0') {
+				Fail("has an unterminated class");
+			}
+			ByteSet single;
+			int low = static_cast<unsigned char>(*p++);
+			if (low == '\\') {
+				low = ParseEscape(single);
+			} else {
+				single.set(low);
+			}
+			if (low >= 0 && p[0] == '-' && p[1] != ']' && p[1] != '\0') {
+				p++;
+				ByteSet ignored;
+				int high = static_cast<unsigned char>(*p++);
+				if (high == '\\') {
+					high = ParseEscape(ignored);
+				}
+				if (high < low) {
+					Fail("has a bad range");
+				}
+				AddRange(set, low, high);
+			} else {
+				set |= single;
+			}
+		}
+		p++;	// Skip ']'
+		return negate ? ~set : set;
+	}
+
+	Fragment ByteFragment(const ByteSet &set) {
+		const int start = NewState();
+		const int end = NewState();
+		states[start].bytes = set;
+		states[start].next = end;
+		return { start, end };
+	}
+
+	Fragment ParseAtom() {
+		const char ch = *p++;
+		switch (ch) {
+		case '(': {
+				const Fragment inner = ParseAlternation();
+				if (*p != ')') {
+					Fail("has an unbalanced '('");
+				}
+				p++;
+				return inner;
+			}
+		case '[':
+			return ByteFragment(ParseClass());
+		case '.': {
+				ByteSet set;
+				set.set();
+				set.reset('\n');
+				return ByteFragment(set);
+			}
+		case '\\': {
+				ByteSet set;
+				ParseEscape(set);
+				return ByteFragment(set);
+			}
+		case '*':
+		case '+':
+		case '?':
+			Fail("has a repeat with nothing to repeat");
+		default: {
+				ByteSet set;
+				set.set(static_cast<unsigned char>(ch));
+				return ByteFragment(set);
+			}
+		}
+	}
+
+	Fragment ParseRepeat() {
+		Fragment fragment = ParseAtom();
+		while (*p == '*' || *p == '+' || *p == '?') {
+			const char op = *p++;
+			const int start = NewState();
+			const int end = NewState();
+			Link(start, fragment.start);
+			Link(fragment.end, end);
+			if (op != '+') {
+				Link(start, end);
+			}
+			if (op != '?') {
+				Link(fragment.end, fragment.start);
+			}
+			fragment = { start, end };
+		}
+		return fragment;
+	}
+
+	Fragment ParseConcatenation() {
+		const int start = NewState();
+		int end = start;
+		while (*p != '\0' && *p != '|' && *p != ')') {
+			const Fragment next = ParseRepeat();
+			Link(end, next.start);
+			end = next.end;
+		}
+		return { start, end };
+	}
+
+	Fragment ParseAlternation() {
+		Fragment fragment = ParseConcatenation();
+		if (*p == '|') {
+			const int start = NewState();
+			const int end = NewState();
+			Link(start, fragment.start);
+			Link(fragment.end, end);
+			while (*p == '|') {
+				p++;
+				const Fragment alternative = ParseConcatenation();
+				Link(start, alternative.start);
+				Link(alternative.end, end);
+			}
+			fragment = { start, end };
+		}
+		return fragment;
+	}
+
+public:
+	std::vector<NFAState> states;
+
+	// Add a pattern as an alternative from the start state 0
+	void AddPattern(const char *pattern_, int index) {
+		if (states.empty()) {
+			NewState();
+		}
+		pattern = pattern_;
+		p = pattern;
+		const Fragment fragment = ParseAlternation();
+		if (*p != '\0') {
+			Fail("has an unbalanced ')'");
+		}
+		Link(0, fragment.start);
+		states[fragment.end].accept = index;
+	}
+};
+
+using StateSet = std::vector<int>;
+
+void Closure(const std::vector<NFAState> &states, StateSet &set) {
+	std::vector<bool> member(states.size());
+	for (const int s : set) {
+		member[s] = true;
+	}
+	for (size_t i = 0; i < set.size(); i++) {
+		for (const int to : states[set[i]].empty) {
+			if (!member[to]) {
+				member[to] = true;
+				set.push_back(to);
+			}
+		}
+	}
+	std::sort(set.begin(), set.end());
+}
+
+}
+
+TokenDFA::TokenDFA(const std::vector<const char *> &patterns) {
+	NFABuilder builder;
+	for (size_t i = 0; i < patterns.size(); i++) {
+		builder.AddPattern(patterns[i], static_cast<int>(i));
+	}
+	const std::vector<NFAState> &nfa = builder.states;
+
+	// Bytes that are treated identically by every transition share a class so the
+	// transition table has a column per class instead of per byte.
+	for (const NFAState &state : nfa) {
+		if (state.next < 0) {
+			continue;
+		}
+		std::map<std::pair<int, bool>, unsigned char> split;
+		for (int ch = 0; ch < 256; ch++) {
+			const std::pair<int, bool> key(byteClass[ch], state.bytes.test(ch));
+			const auto it = split.emplace(key, static_cast<unsigned char>(split.size())).first;
+			byteClass[ch] = it->second;
+		}
+		classes = split.size();
+	}
+	std::vector<unsigned char> representative(classes);
+	for (int ch = 255; ch >= 0; ch--) {
+		representative[byteClass[ch]] = static_cast<unsigned char>(ch);
+	}
+
+	// Subset construction with the empty set as the dead state 0 and the start state 1.
+	std::map<StateSet, unsigned int> known;
+	std::vector<StateSet> pending;
+	auto intern = [&](StateSet &&set) -> unsigned int {
+		const auto it = known.find(set);
+		if (it != known.end()) {
+			return it->second;
+		}
+		const unsigned int id = static_cast<unsigned int>(accepts.size());
+		if (id > UINT16_MAX) {
+			throw std::invalid_argument("token patterns need too many states");
+		}
+		int accept = noMatch;
+		for (const int s : set) {
+			if (nfa[s].accept != noMatch && (accept == noMatch || nfa[s].accept < accept)) {
+				accept = nfa[s].accept;
+			}
+		}
+		accepts.push_back(accept);
+		transitions.resize(accepts.size() * classes, deadState);
+		known.emplace(set, id);
+		pending.push_back(std::move(set));
+		return id;
+	};
+	intern(StateSet());
+	StateSet start { 0 };
+	Closure(nfa, start);
+	intern(std::move(start));
+
+	for (unsigned int id = 0; id < pending.size(); id++) {
+		for (size_t cls = 0; cls < classes; cls++) {
+			StateSet next;
+			for (const int s : pending[id]) {
+				if (nfa[s].next >= 0 && nfa[s].bytes.test(representative[cls])) {
+					next.push_back(nfa[s].next);
+				}
+			}
+			if (!next.empty()) {
+				Closure(nfa, next);
+				next.erase(std::unique(next.begin(), next.end()), next.end());
+				const unsigned int target = intern(std::move(next));
+				transitions[id * classes + cls] = static_cast<uint16_t>(target);
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+// Hyperion source code edit control
+/** @file TokenGrammar.hpp
+ ** Compile a list of token patterns into a deterministic finite automaton.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * A set of token patterns compiled into one DFA that finds the longest match at a position.
+ * When several patterns match the same longest text, the earliest pattern wins.
+ *
+ * Patterns use a small regular expression subset that works on bytes:
+ * literals, '.' (any byte except '\n'), [classes] with ranges and '^' negation,
+ * grouping with (), alternation with |, the repeats *, + and ?, and the escapes
+ * \d \w \s \n \r \t \f \v \xHH. Any other escaped character is a literal.
+ * There are no anchors, back references or lookahead.
+ */
+class TokenDFA {
+public:
+	static constexpr int noMatch = -1;
+
+	explicit TokenDFA(const std::vector<const char *> &patterns);
+
+	static constexpr unsigned int deadState = 0;
+	static constexpr unsigned int startState = 1;
+
+	/// Length of the longest match from state at position, looking no further than limit,
+	/// or 0 when no pattern matches. The index of the matching pattern is returned through
+	/// pattern and state becomes the state reached at limit or deadState if scanning stopped earlier.
+	/// Continuing from that state matches tokens that are split across several calls.
+	template <typename Reader>
+	Sci_Position Match(Reader &reader, Sci_Position position, Sci_Position limit, unsigned int &state, int &pattern) const {
+		pattern = noMatch;
+		Sci_Position lengthMatch = 0;
+		for (Sci_Position pos = position; pos < limit; pos++) {
+			state = transitions[state * classes + byteClass[reader.UCharAt(pos)]];
+			if (state == deadState) {
+				break;
+			}
+			if (accepts[state] != noMatch) {
+				pattern = accepts[state];
+				lengthMatch = pos - position + 1;
+			}
+		}
+		return lengthMatch;
+	}
+
+	size_t States() const noexcept {
+		return accepts.size();
+	}
+
+private:
+	unsigned char byteClass[256] {};
+	size_t classes = 1;
+	std::vector<uint16_t> transitions;
+	std::vector<int> accepts;
+};
+
+}
@@ -0,0 +1,53 @@
+// Hyperion source code edit control
+/** @file CpuFeatures.cpp
+ ** Detect instruction set extensions at run time so vectorized code can be chosen.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include "CpuFeatures.hpp"
+
+#if defined(HYPERION_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace Hyperion::Internal {
+
+namespace {
+
+bool DetectAVX2() noexcept {
+#if defined(HYPERION_AVX2) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#elif defined(HYPERION_AVX2) && defined(_MSC_VER)
+	int info[4] {};
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+	__cpuid(info, 1);
+	constexpr int osxsave = 1 << 27;
+	constexpr int avx = 1 << 28;
+	if ((info[2] & (osxsave | avx)) != (osxsave | avx)) {
+		return false;
+	}
+	// The operating system must save the YMM registers
+	if ((_xgetbv(0) & 6) != 6) {
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+}
+
+bool CpuHasAVX2() noexcept {
+	static const bool hasAVX2 = DetectAVX2();
+	return hasAVX2;
+}
+
+}
@@ -0,0 +1,35 @@
+// Hyperion source code edit control
+/** @file CpuFeatures.hpp
+ ** Detect instruction set extensions at run time so vectorized code can be chosen.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HYPERION_X86 1
+#endif
+
+// SSE2 is always present on x64 so only needs a compile time check.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HYPERION_SSE2 1
+#endif
+
+// Functions using AVX2 intrinsics are marked with HYPERION_TARGET_AVX2 and must only be
+// called after CpuHasAVX2 returns true. Visual C++ allows AVX2 intrinsics without marking.
+#if defined(HYPERION_X86)
+#if defined(__GNUC__) || defined(__clang__)
+#define HYPERION_AVX2 1
+#define HYPERION_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#define HYPERION_AVX2 1
+#define HYPERION_TARGET_AVX2
+#endif
+#endif
+
+namespace Hyperion::Internal {
+
+bool CpuHasAVX2() noexcept;
+
+}
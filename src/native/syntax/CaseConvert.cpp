@@ -8,649 +8,868 @@
 // Copyright 2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstddef>
 #include <cassert>
 #include <cstring>
 
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <vector>
+#include <iterator>
 #include <algorithm>
 
+#include "../platform/CpuFeatures.hpp"
+
+#if defined(HYPERION_SSE2)
+#include <emmintrin.h>
+#endif
+
 #include "CaseConvert.hpp"
 #include "UniConversion.hpp"
+#include "UTF8Scan.hpp"
 
 using namespace Hyperion::Internal;
 
 namespace {
 	// Use an unnamed namespace to protect the declarations from name conflicts
 
-// Unicode code points are ordered by groups and follow patterns.
-// Most characters (pitch==1) are in ranges for a particular alphabet and their
-// upper case forms are a fixed distance away.
-// Another pattern (pitch==2) is where each lower case letter is preceded by
-// the upper case form. These are also grouped into ranges.
-
-constexpr int symmetricCaseConversionRanges[] = {
-//lower, upper, range length, range pitch
-//++Autogenerated -- start of section automatically generated
-//**\(\*\n\)
-97,65,26,1,
-224,192,23,1,
-248,216,7,1,
-257,256,24,2,
-314,313,8,2,
-331,330,23,2,
-462,461,8,2,
-479,478,9,2,
-505,504,20,2,
-547,546,9,2,
-583,582,5,2,
-945,913,17,1,
-963,931,9,1,
-985,984,12,2,
-1072,1040,32,1,
-1104,1024,16,1,
-1121,1120,17,2,
-1163,1162,27,2,
-1218,1217,7,2,
-1233,1232,48,2,
-1377,1329,38,1,
-4304,7312,43,1,
-7681,7680,75,2,
-7841,7840,48,2,
-7936,7944,8,1,
-7952,7960,6,1,
-7968,7976,8,1,
-7984,7992,8,1,
-8000,8008,6,1,
-8032,8040,8,1,
-8560,8544,16,1,
-9424,9398,26,1,
-11312,11264,48,1,
-11393,11392,50,2,
-11520,4256,38,1,
-42561,42560,23,2,
-42625,42624,14,2,
-42787,42786,7,2,
-42803,42802,31,2,
-42879,42878,5,2,
-42903,42902,10,2,
-42933,42932,8,2,
-65345,65313,26,1,
-66600,66560,40,1,
-66776,66736,36,1,
-66967,66928,11,1,
-66979,66940,15,1,
-66995,66956,7,1,
-68800,68736,51,1,
-71872,71840,32,1,
-93792,93760,32,1,
-125218,125184,34,1,
+// Maximum length of a case conversion result is 6 bytes in UTF-8
+constexpr size_t maxConversionLength = 6;
 
-//--Autogenerated -- end of section automatically generated
+struct CharacterConversion {
+	int character;
+	char conversion[maxConversionLength+1];
 };
 
-// Code points that are symmetric but don't fit into a range of similar characters
-// are listed here.
+// Each table lists, in character order, the characters changed by one conversion with the
+// UTF-8 they convert to. The tables are constant so need no setup before the first conversion.
+// Conversions may produce more than one character for ligatures and other complex cases.
 
-constexpr int symmetricCaseConversions[] = {
-//lower, upper
+constexpr CharacterConversion foldConversions[] = {
 //++Autogenerated -- start of section automatically generated
-//**1 \(\*\n\)
-255,376,
-307,306,
-309,308,
-311,310,
-378,377,
-380,379,
-382,381,
-384,579,
-387,386,
-389,388,
-392,391,
-396,395,
-402,401,
-405,502,
-409,408,
-410,573,
-414,544,
-417,416,
-419,418,
-421,420,
-424,423,
-429,428,
-432,431,
-436,435,
-438,437,
-441,440,
-445,444,
-447,503,
-454,452,
-457,455,
-460,458,
-477,398,
-499,497,
-501,500,
-572,571,
-575,11390,
-576,11391,
-578,577,
-592,11375,
-593,11373,
-594,11376,
-595,385,
-596,390,
-598,393,
-599,394,
-601,399,
-603,400,
-604,42923,
-608,403,
-609,42924,
-611,404,
-613,42893,
-614,42922,
-616,407,
-617,406,
-618,42926,
-619,11362,
-620,42925,
-623,412,
-625,11374,
-626,413,
-629,415,
-637,11364,
-640,422,
-642,42949,
-643,425,
-647,42929,
-648,430,
-649,580,
-650,433,
-651,434,
-652,581,
-658,439,
-669,42930,
-670,42928,
-881,880,
-883,882,
-887,886,
-891,1021,
-892,1022,
-893,1023,
-940,902,
-941,904,
-942,905,
-943,906,
-972,908,
-973,910,
-974,911,
-983,975,
-1010,1017,
-1011,895,
-1016,1015,
-1019,1018,
-1231,1216,
-4349,7357,
-4350,7358,
-4351,7359,
-7545,42877,
-7549,11363,
-7566,42950,
-8017,8025,
-8019,8027,
-8021,8029,
-8023,8031,
-8048,8122,
-8049,8123,
-8050,8136,
-8051,8137,
-8052,8138,
-8053,8139,
-8054,8154,
-8055,8155,
-8056,8184,
-8057,8185,
-8058,8170,
-8059,8171,
-8060,8186,
-8061,8187,
-8112,8120,
-8113,8121,
-8144,8152,
-8145,8153,
-8160,8168,
-8161,8169,
-8165,8172,
-8526,8498,
-8580,8579,
-11361,11360,
-11365,570,
-11366,574,
-11368,11367,
-11370,11369,
-11372,11371,
-11379,11378,
-11382,11381,
-11500,11499,
-11502,11501,
-11507,11506,
-11559,4295,
-11565,4301,
-42874,42873,
-42876,42875,
-42892,42891,
-42897,42896,
-42899,42898,
-42900,42948,
-42952,42951,
-42954,42953,
-42961,42960,
-42967,42966,
-42969,42968,
-42998,42997,
-43859,42931,
-67003,66964,
-67004,66965,
-
+{65,"a"}, {66,"b"}, {67,"c"}, {68,"d"}, {69,"e"}, {70,"f"},
+{71,"g"}, {72,"h"}, {73,"i"}, {74,"j"}, {75,"k"}, {76,"l"},
+{77,"m"}, {78,"n"}, {79,"o"}, {80,"p"}, {81,"q"}, {82,"r"},
+{83,"s"}, {84,"t"}, {85,"u"}, {86,"v"}, {87,"w"}, {88,"x"},
+{89,"y"}, {90,"z"}, {181,"\xce\xbc"}, {192,"\xc3\xa0"}, {193,"\xc3\xa1"}, {194,"\xc3\xa2"},
+{195,"\xc3\xa3"}, {196,"\xc3\xa4"}, {197,"\xc3\xa5"}, {198,"\xc3\xa6"}, {199,"\xc3\xa7"}, {200,"\xc3\xa8"},
+{201,"\xc3\xa9"}, {202,"\xc3\xaa"}, {203,"\xc3\xab"}, {204,"\xc3\xac"}, {205,"\xc3\xad"}, {206,"\xc3\xae"},
+{207,"\xc3\xaf"}, {208,"\xc3\xb0"}, {209,"\xc3\xb1"}, {210,"\xc3\xb2"}, {211,"\xc3\xb3"}, {212,"\xc3\xb4"},
+{213,"\xc3\xb5"}, {214,"\xc3\xb6"}, {216,"\xc3\xb8"}, {217,"\xc3\xb9"}, {218,"\xc3\xba"}, {219,"\xc3\xbb"},
+{220,"\xc3\xbc"}, {221,"\xc3\xbd"}, {222,"\xc3\xbe"}, {223,"ss"}, {256,"\xc4\x81"}, {258,"\xc4\x83"},
+{260,"\xc4\x85"}, {262,"\xc4\x87"}, {264,"\xc4\x89"}, {266,"\xc4\x8b"}, {268,"\xc4\x8d"}, {270,"\xc4\x8f"},
+{272,"\xc4\x91"}, {274,"\xc4\x93"}, {276,"\xc4\x95"}, {278,"\xc4\x97"}, {280,"\xc4\x99"}, {282,"\xc4\x9b"},
+{284,"\xc4\x9d"}, {286,"\xc4\x9f"}, {288,"\xc4\xa1"}, {290,"\xc4\xa3"}, {292,"\xc4\xa5"}, {294,"\xc4\xa7"},
+{296,"\xc4\xa9"}, {298,"\xc4\xab"}, {300,"\xc4\xad"}, {302,"\xc4\xaf"}, {304,"i\xcc\x87"}, {306,"\xc4\xb3"},
+{308,"\xc4\xb5"}, {310,"\xc4\xb7"}, {313,"\xc4\xba"}, {315,"\xc4\xbc"}, {317,"\xc4\xbe"}, {319,"\xc5\x80"},
+{321,"\xc5\x82"}, {323,"\xc5\x84"}, {325,"\xc5\x86"}, {327,"\xc5\x88"}, {329,"\xca\xbcn"}, {330,"\xc5\x8b"},
+{332,"\xc5\x8d"}, {334,"\xc5\x8f"}, {336,"\xc5\x91"}, {338,"\xc5\x93"}, {340,"\xc5\x95"}, {342,"\xc5\x97"},
+{344,"\xc5\x99"}, {346,"\xc5\x9b"}, {348,"\xc5\x9d"}, {350,"\xc5\x9f"}, {352,"\xc5\xa1"}, {354,"\xc5\xa3"},
+{356,"\xc5\xa5"}, {358,"\xc5\xa7"}, {360,"\xc5\xa9"}, {362,"\xc5\xab"}, {364,"\xc5\xad"}, {366,"\xc5\xaf"},
+{368,"\xc5\xb1"}, {370,"\xc5\xb3"}, {372,"\xc5\xb5"}, {374,"\xc5\xb7"}, {376,"\xc3\xbf"}, {377,"\xc5\xba"},
+{379,"\xc5\xbc"}, {381,"\xc5\xbe"}, {383,"s"}, {385,"\xc9\x93"}, {386,"\xc6\x83"}, {388,"\xc6\x85"},
+{390,"\xc9\x94"}, {391,"\xc6\x88"}, {393,"\xc9\x96"}, {394,"\xc9\x97"}, {395,"\xc6\x8c"}, {398,"\xc7\x9d"},
+{399,"\xc9\x99"}, {400,"\xc9\x9b"}, {401,"\xc6\x92"}, {403,"\xc9\xa0"}, {404,"\xc9\xa3"}, {406,"\xc9\xa9"},
+{407,"\xc9\xa8"}, {408,"\xc6\x99"}, {412,"\xc9\xaf"}, {413,"\xc9\xb2"}, {415,"\xc9\xb5"}, {416,"\xc6\xa1"},
+{418,"\xc6\xa3"}, {420,"\xc6\xa5"}, {422,"\xca\x80"}, {423,"\xc6\xa8"}, {425,"\xca\x83"}, {428,"\xc6\xad"},
+{430,"\xca\x88"}, {431,"\xc6\xb0"}, {433,"\xca\x8a"}, {434,"\xca\x8b"}, {435,"\xc6\xb4"}, {437,"\xc6\xb6"},
+{439,"\xca\x92"}, {440,"\xc6\xb9"}, {444,"\xc6\xbd"}, {452,"\xc7\x86"}, {453,"\xc7\x86"}, {455,"\xc7\x89"},
+{456,"\xc7\x89"}, {458,"\xc7\x8c"}, {459,"\xc7\x8c"}, {461,"\xc7\x8e"}, {463,"\xc7\x90"}, {465,"\xc7\x92"},
+{467,"\xc7\x94"}, {469,"\xc7\x96"}, {471,"\xc7\x98"}, {473,"\xc7\x9a"}, {475,"\xc7\x9c"}, {478,"\xc7\x9f"},
+{480,"\xc7\xa1"}, {482,"\xc7\xa3"}, {484,"\xc7\xa5"}, {486,"\xc7\xa7"}, {488,"\xc7\xa9"}, {490,"\xc7\xab"},
+{492,"\xc7\xad"}, {494,"\xc7\xaf"}, {496,"j\xcc\x8c"}, {497,"\xc7\xb3"}, {498,"\xc7\xb3"}, {500,"\xc7\xb5"},
+{502,"\xc6\x95"}, {503,"\xc6\xbf"}, {504,"\xc7\xb9"}, {506,"\xc7\xbb"}, {508,"\xc7\xbd"}, {510,"\xc7\xbf"},
+{512,"\xc8\x81"}, {514,"\xc8\x83"}, {516,"\xc8\x85"}, {518,"\xc8\x87"}, {520,"\xc8\x89"}, {522,"\xc8\x8b"},
+{524,"\xc8\x8d"}, {526,"\xc8\x8f"}, {528,"\xc8\x91"}, {530,"\xc8\x93"}, {532,"\xc8\x95"}, {534,"\xc8\x97"},
+{536,"\xc8\x99"}, {538,"\xc8\x9b"}, {540,"\xc8\x9d"}, {542,"\xc8\x9f"}, {544,"\xc6\x9e"}, {546,"\xc8\xa3"},
+{548,"\xc8\xa5"}, {550,"\xc8\xa7"}, {552,"\xc8\xa9"}, {554,"\xc8\xab"}, {556,"\xc8\xad"}, {558,"\xc8\xaf"},
+{560,"\xc8\xb1"}, {562,"\xc8\xb3"}, {570,"\xe2\xb1\xa5"}, {571,"\xc8\xbc"}, {573,"\xc6\x9a"}, {574,"\xe2\xb1\xa6"},
+{577,"\xc9\x82"}, {579,"\xc6\x80"}, {580,"\xca\x89"}, {581,"\xca\x8c"}, {582,"\xc9\x87"}, {584,"\xc9\x89"},
+{586,"\xc9\x8b"}, {588,"\xc9\x8d"}, {590,"\xc9\x8f"}, {837,"\xce\xb9"}, {880,"\xcd\xb1"}, {882,"\xcd\xb3"},
+{886,"\xcd\xb7"}, {895,"\xcf\xb3"}, {902,"\xce\xac"}, {904,"\xce\xad"}, {905,"\xce\xae"}, {906,"\xce\xaf"},
+{908,"\xcf\x8c"}, {910,"\xcf\x8d"}, {911,"\xcf\x8e"}, {912,"\xce\xb9\xcc\x88\xcc\x81"}, {913,"\xce\xb1"}, {914,"\xce\xb2"},
+{915,"\xce\xb3"}, {916,"\xce\xb4"}, {917,"\xce\xb5"}, {918,"\xce\xb6"}, {919,"\xce\xb7"}, {920,"\xce\xb8"},
+{921,"\xce\xb9"}, {922,"\xce\xba"}, {923,"\xce\xbb"}, {924,"\xce\xbc"}, {925,"\xce\xbd"}, {926,"\xce\xbe"},
+{927,"\xce\xbf"}, {928,"\xcf\x80"}, {929,"\xcf\x81"}, {931,"\xcf\x83"}, {932,"\xcf\x84"}, {933,"\xcf\x85"},
+{934,"\xcf\x86"}, {935,"\xcf\x87"}, {936,"\xcf\x88"}, {937,"\xcf\x89"}, {938,"\xcf\x8a"}, {939,"\xcf\x8b"},
+{944,"\xcf\x85\xcc\x88\xcc\x81"}, {962,"\xcf\x83"}, {975,"\xcf\x97"}, {976,"\xce\xb2"}, {977,"\xce\xb8"}, {981,"\xcf\x86"},
+{982,"\xcf\x80"}, {984,"\xcf\x99"}, {986,"\xcf\x9b"}, {988,"\xcf\x9d"}, {990,"\xcf\x9f"}, {992,"\xcf\xa1"},
+{994,"\xcf\xa3"}, {996,"\xcf\xa5"}, {998,"\xcf\xa7"}, {1000,"\xcf\xa9"}, {1002,"\xcf\xab"}, {1004,"\xcf\xad"},
+{1006,"\xcf\xaf"}, {1008,"\xce\xba"}, {1009,"\xcf\x81"}, {1012,"\xce\xb8"}, {1013,"\xce\xb5"}, {1015,"\xcf\xb8"},
+{1017,"\xcf\xb2"}, {1018,"\xcf\xbb"}, {1021,"\xcd\xbb"}, {1022,"\xcd\xbc"}, {1023,"\xcd\xbd"}, {1024,"\xd1\x90"},
+{1025,"\xd1\x91"}, {1026,"\xd1\x92"}, {1027,"\xd1\x93"}, {1028,"\xd1\x94"}, {1029,"\xd1\x95"}, {1030,"\xd1\x96"},
+{1031,"\xd1\x97"}, {1032,"\xd1\x98"}, {1033,"\xd1\x99"}, {1034,"\xd1\x9a"}, {1035,"\xd1\x9b"}, {1036,"\xd1\x9c"},
+{1037,"\xd1\x9d"}, {1038,"\xd1\x9e"}, {1039,"\xd1\x9f"}, {1040,"\xd0\xb0"}, {1041,"\xd0\xb1"}, {1042,"\xd0\xb2"},
+{1043,"\xd0\xb3"}, {1044,"\xd0\xb4"}, {1045,"\xd0\xb5"}, {1046,"\xd0\xb6"}, {1047,"\xd0\xb7"}, {1048,"\xd0\xb8"},
+{1049,"\xd0\xb9"}, {1050,"\xd0\xba"}, {1051,"\xd0\xbb"}, {1052,"\xd0\xbc"}, {1053,"\xd0\xbd"}, {1054,"\xd0\xbe"},
+{1055,"\xd0\xbf"}, {1056,"\xd1\x80"}, {1057,"\xd1\x81"}, {1058,"\xd1\x82"}, {1059,"\xd1\x83"}, {1060,"\xd1\x84"},
+{1061,"\xd1\x85"}, {1062,"\xd1\x86"}, {1063,"\xd1\x87"}, {1064,"\xd1\x88"}, {1065,"\xd1\x89"}, {1066,"\xd1\x8a"},
+{1067,"\xd1\x8b"}, {1068,"\xd1\x8c"}, {1069,"\xd1\x8d"}, {1070,"\xd1\x8e"}, {1071,"\xd1\x8f"}, {1120,"\xd1\xa1"},
+{1122,"\xd1\xa3"}, {1124,"\xd1\xa5"}, {1126,"\xd1\xa7"}, {1128,"\xd1\xa9"}, {1130,"\xd1\xab"}, {1132,"\xd1\xad"},
+{1134,"\xd1\xaf"}, {1136,"\xd1\xb1"}, {1138,"\xd1\xb3"}, {1140,"\xd1\xb5"}, {1142,"\xd1\xb7"}, {1144,"\xd1\xb9"},
+{1146,"\xd1\xbb"}, {1148,"\xd1\xbd"}, {1150,"\xd1\xbf"}, {1152,"\xd2\x81"}, {1162,"\xd2\x8b"}, {1164,"\xd2\x8d"},
+{1166,"\xd2\x8f"}, {1168,"\xd2\x91"}, {1170,"\xd2\x93"}, {1172,"\xd2\x95"}, {1174,"\xd2\x97"}, {1176,"\xd2\x99"},
+{1178,"\xd2\x9b"}, {1180,"\xd2\x9d"}, {1182,"\xd2\x9f"}, {1184,"\xd2\xa1"}, {1186,"\xd2\xa3"}, {1188,"\xd2\xa5"},
+{1190,"\xd2\xa7"}, {1192,"\xd2\xa9"}, {1194,"\xd2\xab"}, {1196,"\xd2\xad"}, {1198,"\xd2\xaf"}, {1200,"\xd2\xb1"},
+{1202,"\xd2\xb3"}, {1204,"\xd2\xb5"}, {1206,"\xd2\xb7"}, {1208,"\xd2\xb9"}, {1210,"\xd2\xbb"}, {1212,"\xd2\xbd"},
+{1214,"\xd2\xbf"}, {1216,"\xd3\x8f"}, {1217,"\xd3\x82"}, {1219,"\xd3\x84"}, {1221,"\xd3\x86"}, {1223,"\xd3\x88"},
+{1225,"\xd3\x8a"}, {1227,"\xd3\x8c"}, {1229,"\xd3\x8e"}, {1232,"\xd3\x91"}, {1234,"\xd3\x93"}, {1236,"\xd3\x95"},
+{1238,"\xd3\x97"}, {1240,"\xd3\x99"}, {1242,"\xd3\x9b"}, {1244,"\xd3\x9d"}, {1246,"\xd3\x9f"}, {1248,"\xd3\xa1"},
+{1250,"\xd3\xa3"}, {1252,"\xd3\xa5"}, {1254,"\xd3\xa7"}, {1256,"\xd3\xa9"}, {1258,"\xd3\xab"}, {1260,"\xd3\xad"},
+{1262,"\xd3\xaf"}, {1264,"\xd3\xb1"}, {1266,"\xd3\xb3"}, {1268,"\xd3\xb5"}, {1270,"\xd3\xb7"}, {1272,"\xd3\xb9"},
+{1274,"\xd3\xbb"}, {1276,"\xd3\xbd"}, {1278,"\xd3\xbf"}, {1280,"\xd4\x81"}, {1282,"\xd4\x83"}, {1284,"\xd4\x85"},
+{1286,"\xd4\x87"}, {1288,"\xd4\x89"}, {1290,"\xd4\x8b"}, {1292,"\xd4\x8d"}, {1294,"\xd4\x8f"}, {1296,"\xd4\x91"},
+{1298,"\xd4\x93"}, {1300,"\xd4\x95"}, {1302,"\xd4\x97"}, {1304,"\xd4\x99"}, {1306,"\xd4\x9b"}, {1308,"\xd4\x9d"},
+{1310,"\xd4\x9f"}, {1312,"\xd4\xa1"}, {1314,"\xd4\xa3"}, {1316,"\xd4\xa5"}, {1318,"\xd4\xa7"}, {1320,"\xd4\xa9"},
+{1322,"\xd4\xab"}, {1324,"\xd4\xad"}, {1326,"\xd4\xaf"}, {1329,"\xd5\xa1"}, {1330,"\xd5\xa2"}, {1331,"\xd5\xa3"},
+{1332,"\xd5\xa4"}, {1333,"\xd5\xa5"}, {1334,"\xd5\xa6"}, {1335,"\xd5\xa7"}, {1336,"\xd5\xa8"}, {1337,"\xd5\xa9"},
+{1338,"\xd5\xaa"}, {1339,"\xd5\xab"}, {1340,"\xd5\xac"}, {1341,"\xd5\xad"}, {1342,"\xd5\xae"}, {1343,"\xd5\xaf"},
+{1344,"\xd5\xb0"}, {1345,"\xd5\xb1"}, {1346,"\xd5\xb2"}, {1347,"\xd5\xb3"}, {1348,"\xd5\xb4"}, {1349,"\xd5\xb5"},
+{1350,"\xd5\xb6"}, {1351,"\xd5\xb7"}, {1352,"\xd5\xb8"}, {1353,"\xd5\xb9"}, {1354,"\xd5\xba"}, {1355,"\xd5\xbb"},
+{1356,"\xd5\xbc"}, {1357,"\xd5\xbd"}, {1358,"\xd5\xbe"}, {1359,"\xd5\xbf"}, {1360,"\xd6\x80"}, {1361,"\xd6\x81"},
+{1362,"\xd6\x82"}, {1363,"\xd6\x83"}, {1364,"\xd6\x84"}, {1365,"\xd6\x85"}, {1366,"\xd6\x86"}, {1415,"\xd5\xa5\xd6\x82"},
+{4256,"\xe2\xb4\x80"}, {4257,"\xe2\xb4\x81"}, {4258,"\xe2\xb4\x82"}, {4259,"\xe2\xb4\x83"}, {4260,"\xe2\xb4\x84"}, {4261,"\xe2\xb4\x85"},
+{4262,"\xe2\xb4\x86"}, {4263,"\xe2\xb4\x87"}, {4264,"\xe2\xb4\x88"}, {4265,"\xe2\xb4\x89"}, {4266,"\xe2\xb4\x8a"}, {4267,"\xe2\xb4\x8b"},
+{4268,"\xe2\xb4\x8c"}, {4269,"\xe2\xb4\x8d"}, {4270,"\xe2\xb4\x8e"}, {4271,"\xe2\xb4\x8f"}, {4272,"\xe2\xb4\x90"}, {4273,"\xe2\xb4\x91"},
+{4274,"\xe2\xb4\x92"}, {4275,"\xe2\xb4\x93"}, {4276,"\xe2\xb4\x94"}, {4277,"\xe2\xb4\x95"}, {4278,"\xe2\xb4\x96"}, {4279,"\xe2\xb4\x97"},
+{4280,"\xe2\xb4\x98"}, {4281,"\xe2\xb4\x99"}, {4282,"\xe2\xb4\x9a"}, {4283,"\xe2\xb4\x9b"}, {4284,"\xe2\xb4\x9c"}, {4285,"\xe2\xb4\x9d"},
+{4286,"\xe2\xb4\x9e"}, {4287,"\xe2\xb4\x9f"}, {4288,"\xe2\xb4\xa0"}, {4289,"\xe2\xb4\xa1"}, {4290,"\xe2\xb4\xa2"}, {4291,"\xe2\xb4\xa3"},
+{4292,"\xe2\xb4\xa4"}, {4293,"\xe2\xb4\xa5"}, {4295,"\xe2\xb4\xa7"}, {4301,"\xe2\xb4\xad"}, {5112,"\xe1\x8f\xb0"}, {5113,"\xe1\x8f\xb1"},
+{5114,"\xe1\x8f\xb2"}, {5115,"\xe1\x8f\xb3"}, {5116,"\xe1\x8f\xb4"}, {5117,"\xe1\x8f\xb5"}, {7296,"\xd0\xb2"}, {7297,"\xd0\xb4"},
+{7298,"\xd0\xbe"}, {7299,"\xd1\x81"}, {7300,"\xd1\x82"}, {7301,"\xd1\x82"}, {7302,"\xd1\x8a"}, {7303,"\xd1\xa3"},
+{7304,"\xea\x99\x8b"}, {7312,"\xe1\x83\x90"}, {7313,"\xe1\x83\x91"}, {7314,"\xe1\x83\x92"}, {7315,"\xe1\x83\x93"}, {7316,"\xe1\x83\x94"},
+{7317,"\xe1\x83\x95"}, {7318,"\xe1\x83\x96"}, {7319,"\xe1\x83\x97"}, {7320,"\xe1\x83\x98"}, {7321,"\xe1\x83\x99"}, {7322,"\xe1\x83\x9a"},
+{7323,"\xe1\x83\x9b"}, {7324,"\xe1\x83\x9c"}, {7325,"\xe1\x83\x9d"}, {7326,"\xe1\x83\x9e"}, {7327,"\xe1\x83\x9f"}, {7328,"\xe1\x83\xa0"},
+{7329,"\xe1\x83\xa1"}, {7330,"\xe1\x83\xa2"}, {7331,"\xe1\x83\xa3"}, {7332,"\xe1\x83\xa4"}, {7333,"\xe1\x83\xa5"}, {7334,"\xe1\x83\xa6"},
+{7335,"\xe1\x83\xa7"}, {7336,"\xe1\x83\xa8"}, {7337,"\xe1\x83\xa9"}, {7338,"\xe1\x83\xaa"}, {7339,"\xe1\x83\xab"}, {7340,"\xe1\x83\xac"},
+{7341,"\xe1\x83\xad"}, {7342,"\xe1\x83\xae"}, {7343,"\xe1\x83\xaf"}, {7344,"\xe1\x83\xb0"}, {7345,"\xe1\x83\xb1"}, {7346,"\xe1\x83\xb2"},
+{7347,"\xe1\x83\xb3"}, {7348,"\xe1\x83\xb4"}, {7349,"\xe1\x83\xb5"}, {7350,"\xe1\x83\xb6"}, {7351,"\xe1\x83\xb7"}, {7352,"\xe1\x83\xb8"},
+{7353,"\xe1\x83\xb9"}, {7354,"\xe1\x83\xba"}, {7357,"\xe1\x83\xbd"}, {7358,"\xe1\x83\xbe"}, {7359,"\xe1\x83\xbf"}, {7680,"\xe1\xb8\x81"},
+{7682,"\xe1\xb8\x83"}, {7684,"\xe1\xb8\x85"}, {7686,"\xe1\xb8\x87"}, {7688,"\xe1\xb8\x89"}, {7690,"\xe1\xb8\x8b"}, {7692,"\xe1\xb8\x8d"},
+{7694,"\xe1\xb8\x8f"}, {7696,"\xe1\xb8\x91"}, {7698,"\xe1\xb8\x93"}, {7700,"\xe1\xb8\x95"}, {7702,"\xe1\xb8\x97"}, {7704,"\xe1\xb8\x99"},
+{7706,"\xe1\xb8\x9b"}, {7708,"\xe1\xb8\x9d"}, {7710,"\xe1\xb8\x9f"}, {7712,"\xe1\xb8\xa1"}, {7714,"\xe1\xb8\xa3"}, {7716,"\xe1\xb8\xa5"},
+{7718,"\xe1\xb8\xa7"}, {7720,"\xe1\xb8\xa9"}, {7722,"\xe1\xb8\xab"}, {7724,"\xe1\xb8\xad"}, {7726,"\xe1\xb8\xaf"}, {7728,"\xe1\xb8\xb1"},
+{7730,"\xe1\xb8\xb3"}, {7732,"\xe1\xb8\xb5"}, {7734,"\xe1\xb8\xb7"}, {7736,"\xe1\xb8\xb9"}, {7738,"\xe1\xb8\xbb"}, {7740,"\xe1\xb8\xbd"},
+{7742,"\xe1\xb8\xbf"}, {7744,"\xe1\xb9\x81"}, {7746,"\xe1\xb9\x83"}, {7748,"\xe1\xb9\x85"}, {7750,"\xe1\xb9\x87"}, {7752,"\xe1\xb9\x89"},
+{7754,"\xe1\xb9\x8b"}, {7756,"\xe1\xb9\x8d"}, {7758,"\xe1\xb9\x8f"}, {7760,"\xe1\xb9\x91"}, {7762,"\xe1\xb9\x93"}, {7764,"\xe1\xb9\x95"},
+{7766,"\xe1\xb9\x97"}, {7768,"\xe1\xb9\x99"}, {7770,"\xe1\xb9\x9b"}, {7772,"\xe1\xb9\x9d"}, {7774,"\xe1\xb9\x9f"}, {7776,"\xe1\xb9\xa1"},
+{7778,"\xe1\xb9\xa3"}, {7780,"\xe1\xb9\xa5"}, {7782,"\xe1\xb9\xa7"}, {7784,"\xe1\xb9\xa9"}, {7786,"\xe1\xb9\xab"}, {7788,"\xe1\xb9\xad"},
+{7790,"\xe1\xb9\xaf"}, {7792,"\xe1\xb9\xb1"}, {7794,"\xe1\xb9\xb3"}, {7796,"\xe1\xb9\xb5"}, {7798,"\xe1\xb9\xb7"}, {7800,"\xe1\xb9\xb9"},
+{7802,"\xe1\xb9\xbb"}, {7804,"\xe1\xb9\xbd"}, {7806,"\xe1\xb9\xbf"}, {7808,"\xe1\xba\x81"}, {7810,"\xe1\xba\x83"}, {7812,"\xe1\xba\x85"},
+{7814,"\xe1\xba\x87"}, {7816,"\xe1\xba\x89"}, {7818,"\xe1\xba\x8b"}, {7820,"\xe1\xba\x8d"}, {7822,"\xe1\xba\x8f"}, {7824,"\xe1\xba\x91"},
+{7826,"\xe1\xba\x93"}, {7828,"\xe1\xba\x95"}, {7830,"h\xcc\xb1"}, {7831,"t\xcc\x88"}, {7832,"w\xcc\x8a"}, {7833,"y\xcc\x8a"},
+{7834,"a\xca\xbe"}, {7835,"\xe1\xb9\xa1"}, {7838,"ss"}, {7840,"\xe1\xba\xa1"}, {7842,"\xe1\xba\xa3"}, {7844,"\xe1\xba\xa5"},
+{7846,"\xe1\xba\xa7"}, {7848,"\xe1\xba\xa9"}, {7850,"\xe1\xba\xab"}, {7852,"\xe1\xba\xad"}, {7854,"\xe1\xba\xaf"}, {7856,"\xe1\xba\xb1"},
+{7858,"\xe1\xba\xb3"}, {7860,"\xe1\xba\xb5"}, {7862,"\xe1\xba\xb7"}, {7864,"\xe1\xba\xb9"}, {7866,"\xe1\xba\xbb"}, {7868,"\xe1\xba\xbd"},
+{7870,"\xe1\xba\xbf"}, {7872,"\xe1\xbb\x81"}, {7874,"\xe1\xbb\x83"}, {7876,"\xe1\xbb\x85"}, {7878,"\xe1\xbb\x87"}, {7880,"\xe1\xbb\x89"},
+{7882,"\xe1\xbb\x8b"}, {7884,"\xe1\xbb\x8d"}, {7886,"\xe1\xbb\x8f"}, {7888,"\xe1\xbb\x91"}, {7890,"\xe1\xbb\x93"}, {7892,"\xe1\xbb\x95"},
+{7894,"\xe1\xbb\x97"}, {7896,"\xe1\xbb\x99"}, {7898,"\xe1\xbb\x9b"}, {7900,"\xe1\xbb\x9d"}, {7902,"\xe1\xbb\x9f"}, {7904,"\xe1\xbb\xa1"},
+{7906,"\xe1\xbb\xa3"}, {7908,"\xe1\xbb\xa5"}, {7910,"\xe1\xbb\xa7"}, {7912,"\xe1\xbb\xa9"}, {7914,"\xe1\xbb\xab"}, {7916,"\xe1\xbb\xad"},
+{7918,"\xe1\xbb\xaf"}, {7920,"\xe1\xbb\xb1"}, {7922,"\xe1\xbb\xb3"}, {7924,"\xe1\xbb\xb5"}, {7926,"\xe1\xbb\xb7"}, {7928,"\xe1\xbb\xb9"},
+{7930,"\xe1\xbb\xbb"}, {7932,"\xe1\xbb\xbd"}, {7934,"\xe1\xbb\xbf"}, {7944,"\xe1\xbc\x80"}, {7945,"\xe1\xbc\x81"}, {7946,"\xe1\xbc\x82"},
+{7947,"\xe1\xbc\x83"}, {7948,"\xe1\xbc\x84"}, {7949,"\xe1\xbc\x85"}, {7950,"\xe1\xbc\x86"}, {7951,"\xe1\xbc\x87"}, {7960,"\xe1\xbc\x90"},
+{7961,"\xe1\xbc\x91"}, {7962,"\xe1\xbc\x92"}, {7963,"\xe1\xbc\x93"}, {7964,"\xe1\xbc\x94"}, {7965,"\xe1\xbc\x95"}, {7976,"\xe1\xbc\xa0"},
+{7977,"\xe1\xbc\xa1"}, {7978,"\xe1\xbc\xa2"}, {7979,"\xe1\xbc\xa3"}, {7980,"\xe1\xbc\xa4"}, {7981,"\xe1\xbc\xa5"}, {7982,"\xe1\xbc\xa6"},
+{7983,"\xe1\xbc\xa7"}, {7992,"\xe1\xbc\xb0"}, {7993,"\xe1\xbc\xb1"}, {7994,"\xe1\xbc\xb2"}, {7995,"\xe1\xbc\xb3"}, {7996,"\xe1\xbc\xb4"},
+{7997,"\xe1\xbc\xb5"}, {7998,"\xe1\xbc\xb6"}, {7999,"\xe1\xbc\xb7"}, {8008,"\xe1\xbd\x80"}, {8009,"\xe1\xbd\x81"}, {8010,"\xe1\xbd\x82"},
+{8011,"\xe1\xbd\x83"}, {8012,"\xe1\xbd\x84"}, {8013,"\xe1\xbd\x85"}, {8016,"\xcf\x85\xcc\x93"}, {8018,"\xcf\x85\xcc\x93\xcc\x80"}, {8020,"\xcf\x85\xcc\x93\xcc\x81"},
+{8022,"\xcf\x85\xcc\x93\xcd\x82"}, {8025,"\xe1\xbd\x91"}, {8027,"\xe1\xbd\x93"}, {8029,"\xe1\xbd\x95"}, {8031,"\xe1\xbd\x97"}, {8040,"\xe1\xbd\xa0"},
+{8041,"\xe1\xbd\xa1"}, {8042,"\xe1\xbd\xa2"}, {8043,"\xe1\xbd\xa3"}, {8044,"\xe1\xbd\xa4"}, {8045,"\xe1\xbd\xa5"}, {8046,"\xe1\xbd\xa6"},
+{8047,"\xe1\xbd\xa7"}, {8064,"\xe1\xbc\x80\xce\xb9"}, {8065,"\xe1\xbc\x81\xce\xb9"}, {8066,"\xe1\xbc\x82\xce\xb9"}, {8067,"\xe1\xbc\x83\xce\xb9"}, {8068,"\xe1\xbc\x84\xce\xb9"},
+{8069,"\xe1\xbc\x85\xce\xb9"}, {8070,"\xe1\xbc\x86\xce\xb9"}, {8071,"\xe1\xbc\x87\xce\xb9"}, {8072,"\xe1\xbc\x80\xce\xb9"}, {8073,"\xe1\xbc\x81\xce\xb9"}, {8074,"\xe1\xbc\x82\xce\xb9"},
+{8075,"\xe1\xbc\x83\xce\xb9"}, {8076,"\xe1\xbc\x84\xce\xb9"}, {8077,"\xe1\xbc\x85\xce\xb9"}, {8078,"\xe1\xbc\x86\xce\xb9"}, {8079,"\xe1\xbc\x87\xce\xb9"}, {8080,"\xe1\xbc\xa0\xce\xb9"},
+{8081,"\xe1\xbc\xa1\xce\xb9"}, {8082,"\xe1\xbc\xa2\xce\xb9"}, {8083,"\xe1\xbc\xa3\xce\xb9"}, {8084,"\xe1\xbc\xa4\xce\xb9"}, {8085,"\xe1\xbc\xa5\xce\xb9"}, {8086,"\xe1\xbc\xa6\xce\xb9"},
+{8087,"\xe1\xbc\xa7\xce\xb9"}, {8088,"\xe1\xbc\xa0\xce\xb9"}, {8089,"\xe1\xbc\xa1\xce\xb9"}, {8090,"\xe1\xbc\xa2\xce\xb9"}, {8091,"\xe1\xbc\xa3\xce\xb9"}, {8092,"\xe1\xbc\xa4\xce\xb9"},
+{8093,"\xe1\xbc\xa5\xce\xb9"}, {8094,"\xe1\xbc\xa6\xce\xb9"}, {8095,"\xe1\xbc\xa7\xce\xb9"}, {8096,"\xe1\xbd\xa0\xce\xb9"}, {8097,"\xe1\xbd\xa1\xce\xb9"}, {8098,"\xe1\xbd\xa2\xce\xb9"},
+{8099,"\xe1\xbd\xa3\xce\xb9"}, {8100,"\xe1\xbd\xa4\xce\xb9"}, {8101,"\xe1\xbd\xa5\xce\xb9"}, {8102,"\xe1\xbd\xa6\xce\xb9"}, {8103,"\xe1\xbd\xa7\xce\xb9"}, {8104,"\xe1\xbd\xa0\xce\xb9"},
+{8105,"\xe1\xbd\xa1\xce\xb9"}, {8106,"\xe1\xbd\xa2\xce\xb9"}, {8107,"\xe1\xbd\xa3\xce\xb9"}, {8108,"\xe1\xbd\xa4\xce\xb9"}, {8109,"\xe1\xbd\xa5\xce\xb9"}, {8110,"\xe1\xbd\xa6\xce\xb9"},
+{8111,"\xe1\xbd\xa7\xce\xb9"}, {8114,"\xe1\xbd\xb0\xce\xb9"}, {8115,"\xce\xb1\xce\xb9"}, {8116,"\xce\xac\xce\xb9"}, {8118,"\xce\xb1\xcd\x82"}, {8119,"\xce\xb1\xcd\x82\xce\xb9"},
+{8120,"\xe1\xbe\xb0"}, {8121,"\xe1\xbe\xb1"}, {8122,"\xe1\xbd\xb0"}, {8123,"\xe1\xbd\xb1"}, {8124,"\xce\xb1\xce\xb9"}, {8126,"\xce\xb9"},
+{8130,"\xe1\xbd\xb4\xce\xb9"}, {8131,"\xce\xb7\xce\xb9"}, {8132,"\xce\xae\xce\xb9"}, {8134,"\xce\xb7\xcd\x82"}, {8135,"\xce\xb7\xcd\x82\xce\xb9"}, {8136,"\xe1\xbd\xb2"},
+{8137,"\xe1\xbd\xb3"}, {8138,"\xe1\xbd\xb4"}, {8139,"\xe1\xbd\xb5"}, {8140,"\xce\xb7\xce\xb9"}, {8146,"\xce\xb9\xcc\x88\xcc\x80"}, {8147,"\xce\xb9\xcc\x88\xcc\x81"},
+{8150,"\xce\xb9\xcd\x82"}, {8151,"\xce\xb9\xcc\x88\xcd\x82"}, {8152,"\xe1\xbf\x90"}, {8153,"\xe1\xbf\x91"}, {8154,"\xe1\xbd\xb6"}, {8155,"\xe1\xbd\xb7"},
+{8162,"\xcf\x85\xcc\x88\xcc\x80"}, {8163,"\xcf\x85\xcc\x88\xcc\x81"}, {8164,"\xcf\x81\xcc\x93"}, {8166,"\xcf\x85\xcd\x82"}, {8167,"\xcf\x85\xcc\x88\xcd\x82"}, {8168,"\xe1\xbf\xa0"},
+{8169,"\xe1\xbf\xa1"}, {8170,"\xe1\xbd\xba"}, {8171,"\xe1\xbd\xbb"}, {8172,"\xe1\xbf\xa5"}, {8178,"\xe1\xbd\xbc\xce\xb9"}, {8179,"\xcf\x89\xce\xb9"},
+{8180,"\xcf\x8e\xce\xb9"}, {8182,"\xcf\x89\xcd\x82"}, {8183,"\xcf\x89\xcd\x82\xce\xb9"}, {8184,"\xe1\xbd\xb8"}, {8185,"\xe1\xbd\xb9"}, {8186,"\xe1\xbd\xbc"},
+{8187,"\xe1\xbd\xbd"}, {8188,"\xcf\x89\xce\xb9"}, {8486,"\xcf\x89"}, {8490,"k"}, {8491,"\xc3\xa5"}, {8498,"\xe2\x85\x8e"},
+{8544,"\xe2\x85\xb0"}, {8545,"\xe2\x85\xb1"}, {8546,"\xe2\x85\xb2"}, {8547,"\xe2\x85\xb3"}, {8548,"\xe2\x85\xb4"}, {8549,"\xe2\x85\xb5"},
+{8550,"\xe2\x85\xb6"}, {8551,"\xe2\x85\xb7"}, {8552,"\xe2\x85\xb8"}, {8553,"\xe2\x85\xb9"}, {8554,"\xe2\x85\xba"}, {8555,"\xe2\x85\xbb"},
+{8556,"\xe2\x85\xbc"}, {8557,"\xe2\x85\xbd"}, {8558,"\xe2\x85\xbe"}, {8559,"\xe2\x85\xbf"}, {8579,"\xe2\x86\x84"}, {9398,"\xe2\x93\x90"},
+{9399,"\xe2\x93\x91"}, {9400,"\xe2\x93\x92"}, {9401,"\xe2\x93\x93"}, {9402,"\xe2\x93\x94"}, {9403,"\xe2\x93\x95"}, {9404,"\xe2\x93\x96"},
+{9405,"\xe2\x93\x97"}, {9406,"\xe2\x93\x98"}, {9407,"\xe2\x93\x99"}, {9408,"\xe2\x93\x9a"}, {9409,"\xe2\x93\x9b"}, {9410,"\xe2\x93\x9c"},
+{9411,"\xe2\x93\x9d"}, {9412,"\xe2\x93\x9e"}, {9413,"\xe2\x93\x9f"}, {9414,"\xe2\x93\xa0"}, {9415,"\xe2\x93\xa1"}, {9416,"\xe2\x93\xa2"},
+{9417,"\xe2\x93\xa3"}, {9418,"\xe2\x93\xa4"}, {9419,"\xe2\x93\xa5"}, {9420,"\xe2\x93\xa6"}, {9421,"\xe2\x93\xa7"}, {9422,"\xe2\x93\xa8"},
+{9423,"\xe2\x93\xa9"}, {11264,"\xe2\xb0\xb0"}, {11265,"\xe2\xb0\xb1"}, {11266,"\xe2\xb0\xb2"}, {11267,"\xe2\xb0\xb3"}, {11268,"\xe2\xb0\xb4"},
+{11269,"\xe2\xb0\xb5"}, {11270,"\xe2\xb0\xb6"}, {11271,"\xe2\xb0\xb7"}, {11272,"\xe2\xb0\xb8"}, {11273,"\xe2\xb0\xb9"}, {11274,"\xe2\xb0\xba"},
+{11275,"\xe2\xb0\xbb"}, {11276,"\xe2\xb0\xbc"}, {11277,"\xe2\xb0\xbd"}, {11278,"\xe2\xb0\xbe"}, {11279,"\xe2\xb0\xbf"}, {11280,"\xe2\xb1\x80"},
+{11281,"\xe2\xb1\x81"}, {11282,"\xe2\xb1\x82"}, {11283,"\xe2\xb1\x83"}, {11284,"\xe2\xb1\x84"}, {11285,"\xe2\xb1\x85"}, {11286,"\xe2\xb1\x86"},
+{11287,"\xe2\xb1\x87"}, {11288,"\xe2\xb1\x88"}, {11289,"\xe2\xb1\x89"}, {11290,"\xe2\xb1\x8a"}, {11291,"\xe2\xb1\x8b"}, {11292,"\xe2\xb1\x8c"},
+{11293,"\xe2\xb1\x8d"}, {11294,"\xe2\xb1\x8e"}, {11295,"\xe2\xb1\x8f"}, {11296,"\xe2\xb1\x90"}, {11297,"\xe2\xb1\x91"}, {11298,"\xe2\xb1\x92"},
+{11299,"\xe2\xb1\x93"}, {11300,"\xe2\xb1\x94"}, {11301,"\xe2\xb1\x95"}, {11302,"\xe2\xb1\x96"}, {11303,"\xe2\xb1\x97"}, {11304,"\xe2\xb1\x98"},
+{11305,"\xe2\xb1\x99"}, {11306,"\xe2\xb1\x9a"}, {11307,"\xe2\xb1\x9b"}, {11308,"\xe2\xb1\x9c"}, {11309,"\xe2\xb1\x9d"}, {11310,"\xe2\xb1\x9e"},
+{11311,"\xe2\xb1\x9f"}, {11360,"\xe2\xb1\xa1"}, {11362,"\xc9\xab"}, {11363,"\xe1\xb5\xbd"}, {11364,"\xc9\xbd"}, {11367,"\xe2\xb1\xa8"},
+{11369,"\xe2\xb1\xaa"}, {11371,"\xe2\xb1\xac"}, {11373,"\xc9\x91"}, {11374,"\xc9\xb1"}, {11375,"\xc9\x90"}, {11376,"\xc9\x92"},
+{11378,"\xe2\xb1\xb3"}, {11381,"\xe2\xb1\xb6"}, {11390,"\xc8\xbf"}, {11391,"\xc9\x80"}, {11392,"\xe2\xb2\x81"}, {11394,"\xe2\xb2\x83"},
+{11396,"\xe2\xb2\x85"}, {11398,"\xe2\xb2\x87"}, {11400,"\xe2\xb2\x89"}, {11402,"\xe2\xb2\x8b"}, {11404,"\xe2\xb2\x8d"}, {11406,"\xe2\xb2\x8f"},
+{11408,"\xe2\xb2\x91"}, {11410,"\xe2\xb2\x93"}, {11412,"\xe2\xb2\x95"}, {11414,"\xe2\xb2\x97"}, {11416,"\xe2\xb2\x99"}, {11418,"\xe2\xb2\x9b"},
+{11420,"\xe2\xb2\x9d"}, {11422,"\xe2\xb2\x9f"}, {11424,"\xe2\xb2\xa1"}, {11426,"\xe2\xb2\xa3"}, {11428,"\xe2\xb2\xa5"}, {11430,"\xe2\xb2\xa7"},
+{11432,"\xe2\xb2\xa9"}, {11434,"\xe2\xb2\xab"}, {11436,"\xe2\xb2\xad"}, {11438,"\xe2\xb2\xaf"}, {11440,"\xe2\xb2\xb1"}, {11442,"\xe2\xb2\xb3"},
+{11444,"\xe2\xb2\xb5"}, {11446,"\xe2\xb2\xb7"}, {11448,"\xe2\xb2\xb9"}, {11450,"\xe2\xb2\xbb"}, {11452,"\xe2\xb2\xbd"}, {11454,"\xe2\xb2\xbf"},
+{11456,"\xe2\xb3\x81"}, {11458,"\xe2\xb3\x83"}, {11460,"\xe2\xb3\x85"}, {11462,"\xe2\xb3\x87"}, {11464,"\xe2\xb3\x89"}, {11466,"\xe2\xb3\x8b"},
+{11468,"\xe2\xb3\x8d"}, {11470,"\xe2\xb3\x8f"}, {11472,"\xe2\xb3\x91"}, {11474,"\xe2\xb3\x93"}, {11476,"\xe2\xb3\x95"}, {11478,"\xe2\xb3\x97"},
+{11480,"\xe2\xb3\x99"}, {11482,"\xe2\xb3\x9b"}, {11484,"\xe2\xb3\x9d"}, {11486,"\xe2\xb3\x9f"}, {11488,"\xe2\xb3\xa1"}, {11490,"\xe2\xb3\xa3"},
+{11499,"\xe2\xb3\xac"}, {11501,"\xe2\xb3\xae"}, {11506,"\xe2\xb3\xb3"}, {42560,"\xea\x99\x81"}, {42562,"\xea\x99\x83"}, {42564,"\xea\x99\x85"},
+{42566,"\xea\x99\x87"}, {42568,"\xea\x99\x89"}, {42570,"\xea\x99\x8b"}, {42572,"\xea\x99\x8d"}, {42574,"\xea\x99\x8f"}, {42576,"\xea\x99\x91"},
+{42578,"\xea\x99\x93"}, {42580,"\xea\x99\x95"}, {42582,"\xea\x99\x97"}, {42584,"\xea\x99\x99"}, {42586,"\xea\x99\x9b"}, {42588,"\xea\x99\x9d"},
+{42590,"\xea\x99\x9f"}, {42592,"\xea\x99\xa1"}, {42594,"\xea\x99\xa3"}, {42596,"\xea\x99\xa5"}, {42598,"\xea\x99\xa7"}, {42600,"\xea\x99\xa9"},
+{42602,"\xea\x99\xab"}, {42604,"\xea\x99\xad"}, {42624,"\xea\x9a\x81"}, {42626,"\xea\x9a\x83"}, {42628,"\xea\x9a\x85"}, {42630,"\xea\x9a\x87"},
+{42632,"\xea\x9a\x89"}, {42634,"\xea\x9a\x8b"}, {42636,"\xea\x9a\x8d"}, {42638,"\xea\x9a\x8f"}, {42640,"\xea\x9a\x91"}, {42642,"\xea\x9a\x93"},
+{42644,"\xea\x9a\x95"}, {42646,"\xea\x9a\x97"}, {42648,"\xea\x9a\x99"}, {42650,"\xea\x9a\x9b"}, {42786,"\xea\x9c\xa3"}, {42788,"\xea\x9c\xa5"},
+{42790,"\xea\x9c\xa7"}, {42792,"\xea\x9c\xa9"}, {42794,"\xea\x9c\xab"}, {42796,"\xea\x9c\xad"}, {42798,"\xea\x9c\xaf"}, {42802,"\xea\x9c\xb3"},
+{42804,"\xea\x9c\xb5"}, {42806,"\xea\x9c\xb7"}, {42808,"\xea\x9c\xb9"}, {42810,"\xea\x9c\xbb"}, {42812,"\xea\x9c\xbd"}, {42814,"\xea\x9c\xbf"},
+{42816,"\xea\x9d\x81"}, {42818,"\xea\x9d\x83"}, {42820,"\xea\x9d\x85"}, {42822,"\xea\x9d\x87"}, {42824,"\xea\x9d\x89"}, {42826,"\xea\x9d\x8b"},
+{42828,"\xea\x9d\x8d"}, {42830,"\xea\x9d\x8f"}, {42832,"\xea\x9d\x91"}, {42834,"\xea\x9d\x93"}, {42836,"\xea\x9d\x95"}, {42838,"\xea\x9d\x97"},
+{42840,"\xea\x9d\x99"}, {42842,"\xea\x9d\x9b"}, {42844,"\xea\x9d\x9d"}, {42846,"\xea\x9d\x9f"}, {42848,"\xea\x9d\xa1"}, {42850,"\xea\x9d\xa3"},
+{42852,"\xea\x9d\xa5"}, {42854,"\xea\x9d\xa7"}, {42856,"\xea\x9d\xa9"}, {42858,"\xea\x9d\xab"}, {42860,"\xea\x9d\xad"}, {42862,"\xea\x9d\xaf"},
+{42873,"\xea\x9d\xba"}, {42875,"\xea\x9d\xbc"}, {42877,"\xe1\xb5\xb9"}, {42878,"\xea\x9d\xbf"}, {42880,"\xea\x9e\x81"}, {42882,"\xea\x9e\x83"},
+{42884,"\xea\x9e\x85"}, {42886,"\xea\x9e\x87"}, {42891,"\xea\x9e\x8c"}, {42893,"\xc9\xa5"}, {42896,"\xea\x9e\x91"}, {42898,"\xea\x9e\x93"},
+{42902,"\xea\x9e\x97"}, {42904,"\xea\x9e\x99"}, {42906,"\xea\x9e\x9b"}, {42908,"\xea\x9e\x9d"}, {42910,"\xea\x9e\x9f"}, {42912,"\xea\x9e\xa1"},
+{42914,"\xea\x9e\xa3"}, {42916,"\xea\x9e\xa5"}, {42918,"\xea\x9e\xa7"}, {42920,"\xea\x9e\xa9"}, {42922,"\xc9\xa6"}, {42923,"\xc9\x9c"},
+{42924,"\xc9\xa1"}, {42925,"\xc9\xac"}, {42926,"\xc9\xaa"}, {42928,"\xca\x9e"}, {42929,"\xca\x87"}, {42930,"\xca\x9d"},
+{42931,"\xea\xad\x93"}, {42932,"\xea\x9e\xb5"}, {42934,"\xea\x9e\xb7"}, {42936,"\xea\x9e\xb9"}, {42938,"\xea\x9e\xbb"}, {42940,"\xea\x9e\xbd"},
+{42942,"\xea\x9e\xbf"}, {42944,"\xea\x9f\x81"}, {42946,"\xea\x9f\x83"}, {42948,"\xea\x9e\x94"}, {42949,"\xca\x82"}, {42950,"\xe1\xb6\x8e"},
+{42951,"\xea\x9f\x88"}, {42953,"\xea\x9f\x8a"}, {42960,"\xea\x9f\x91"}, {42966,"\xea\x9f\x97"}, {42968,"\xea\x9f\x99"}, {42997,"\xea\x9f\xb6"},
+{43888,"\xe1\x8e\xa0"}, {43889,"\xe1\x8e\xa1"}, {43890,"\xe1\x8e\xa2"}, {43891,"\xe1\x8e\xa3"}, {43892,"\xe1\x8e\xa4"}, {43893,"\xe1\x8e\xa5"},
+{43894,"\xe1\x8e\xa6"}, {43895,"\xe1\x8e\xa7"}, {43896,"\xe1\x8e\xa8"}, {43897,"\xe1\x8e\xa9"}, {43898,"\xe1\x8e\xaa"}, {43899,"\xe1\x8e\xab"},
+{43900,"\xe1\x8e\xac"}, {43901,"\xe1\x8e\xad"}, {43902,"\xe1\x8e\xae"}, {43903,"\xe1\x8e\xaf"}, {43904,"\xe1\x8e\xb0"}, {43905,"\xe1\x8e\xb1"},
+{43906,"\xe1\x8e\xb2"}, {43907,"\xe1\x8e\xb3"}, {43908,"\xe1\x8e\xb4"}, {43909,"\xe1\x8e\xb5"}, {43910,"\xe1\x8e\xb6"}, {43911,"\xe1\x8e\xb7"},
+{43912,"\xe1\x8e\xb8"}, {43913,"\xe1\x8e\xb9"}, {43914,"\xe1\x8e\xba"}, {43915,"\xe1\x8e\xbb"}, {43916,"\xe1\x8e\xbc"}, {43917,"\xe1\x8e\xbd"},
+{43918,"\xe1\x8e\xbe"}, {43919,"\xe1\x8e\xbf"}, {43920,"\xe1\x8f\x80"}, {43921,"\xe1\x8f\x81"}, {43922,"\xe1\x8f\x82"}, {43923,"\xe1\x8f\x83"},
+{43924,"\xe1\x8f\x84"}, {43925,"\xe1\x8f\x85"}, {43926,"\xe1\x8f\x86"}, {43927,"\xe1\x8f\x87"}, {43928,"\xe1\x8f\x88"}, {43929,"\xe1\x8f\x89"},
+{43930,"\xe1\x8f\x8a"}, {43931,"\xe1\x8f\x8b"}, {43932,"\xe1\x8f\x8c"}, {43933,"\xe1\x8f\x8d"}, {43934,"\xe1\x8f\x8e"}, {43935,"\xe1\x8f\x8f"},
+{43936,"\xe1\x8f\x90"}, {43937,"\xe1\x8f\x91"}, {43938,"\xe1\x8f\x92"}, {43939,"\xe1\x8f\x93"}, {43940,"\xe1\x8f\x94"}, {43941,"\xe1\x8f\x95"},
+{43942,"\xe1\x8f\x96"}, {43943,"\xe1\x8f\x97"}, {43944,"\xe1\x8f\x98"}, {43945,"\xe1\x8f\x99"}, {43946,"\xe1\x8f\x9a"}, {43947,"\xe1\x8f\x9b"},
+{43948,"\xe1\x8f\x9c"}, {43949,"\xe1\x8f\x9d"}, {43950,"\xe1\x8f\x9e"}, {43951,"\xe1\x8f\x9f"}, {43952,"\xe1\x8f\xa0"}, {43953,"\xe1\x8f\xa1"},
+{43954,"\xe1\x8f\xa2"}, {43955,"\xe1\x8f\xa3"}, {43956,"\xe1\x8f\xa4"}, {43957,"\xe1\x8f\xa5"}, {43958,"\xe1\x8f\xa6"}, {43959,"\xe1\x8f\xa7"},
+{43960,"\xe1\x8f\xa8"}, {43961,"\xe1\x8f\xa9"}, {43962,"\xe1\x8f\xaa"}, {43963,"\xe1\x8f\xab"}, {43964,"\xe1\x8f\xac"}, {43965,"\xe1\x8f\xad"},
+{43966,"\xe1\x8f\xae"}, {43967,"\xe1\x8f\xaf"}, {64256,"ff"}, {64257,"fi"}, {64258,"fl"}, {64259,"ffi"},
+{64260,"ffl"}, {64261,"st"}, {64262,"st"}, {64275,"\xd5\xb4\xd5\xb6"}, {64276,"\xd5\xb4\xd5\xa5"}, {64277,"\xd5\xb4\xd5\xab"},
+{64278,"\xd5\xbe\xd5\xb6"}, {64279,"\xd5\xb4\xd5\xad"}, {65313,"\xef\xbd\x81"}, {65314,"\xef\xbd\x82"}, {65315,"\xef\xbd\x83"}, {65316,"\xef\xbd\x84"},
+{65317,"\xef\xbd\x85"}, {65318,"\xef\xbd\x86"}, {65319,"\xef\xbd\x87"}, {65320,"\xef\xbd\x88"}, {65321,"\xef\xbd\x89"}, {65322,"\xef\xbd\x8a"},
+{65323,"\xef\xbd\x8b"}, {65324,"\xef\xbd\x8c"}, {65325,"\xef\xbd\x8d"}, {65326,"\xef\xbd\x8e"}, {65327,"\xef\xbd\x8f"}, {65328,"\xef\xbd\x90"},
+{65329,"\xef\xbd\x91"}, {65330,"\xef\xbd\x92"}, {65331,"\xef\xbd\x93"}, {65332,"\xef\xbd\x94"}, {65333,"\xef\xbd\x95"}, {65334,"\xef\xbd\x96"},
+{65335,"\xef\xbd\x97"}, {65336,"\xef\xbd\x98"}, {65337,"\xef\xbd\x99"}, {65338,"\xef\xbd\x9a"}, {66560,"\xf0\x90\x90\xa8"}, {66561,"\xf0\x90\x90\xa9"},
+{66562,"\xf0\x90\x90\xaa"}, {66563,"\xf0\x90\x90\xab"}, {66564,"\xf0\x90\x90\xac"}, {66565,"\xf0\x90\x90\xad"}, {66566,"\xf0\x90\x90\xae"}, {66567,"\xf0\x90\x90\xaf"},
+{66568,"\xf0\x90\x90\xb0"}, {66569,"\xf0\x90\x90\xb1"}, {66570,"\xf0\x90\x90\xb2"}, {66571,"\xf0\x90\x90\xb3"}, {66572,"\xf0\x90\x90\xb4"}, {66573,"\xf0\x90\x90\xb5"},
+{66574,"\xf0\x90\x90\xb6"}, {66575,"\xf0\x90\x90\xb7"}, {66576,"\xf0\x90\x90\xb8"}, {66577,"\xf0\x90\x90\xb9"}, {66578,"\xf0\x90\x90\xba"}, {66579,"\xf0\x90\x90\xbb"},
+{66580,"\xf0\x90\x90\xbc"}, {66581,"\xf0\x90\x90\xbd"}, {66582,"\xf0\x90\x90\xbe"}, {66583,"\xf0\x90\x90\xbf"}, {66584,"\xf0\x90\x91\x80"}, {66585,"\xf0\x90\x91\x81"},
+{66586,"\xf0\x90\x91\x82"}, {66587,"\xf0\x90\x91\x83"}, {66588,"\xf0\x90\x91\x84"}, {66589,"\xf0\x90\x91\x85"}, {66590,"\xf0\x90\x91\x86"}, {66591,"\xf0\x90\x91\x87"},
+{66592,"\xf0\x90\x91\x88"}, {66593,"\xf0\x90\x91\x89"}, {66594,"\xf0\x90\x91\x8a"}, {66595,"\xf0\x90\x91\x8b"}, {66596,"\xf0\x90\x91\x8c"}, {66597,"\xf0\x90\x91\x8d"},
+{66598,"\xf0\x90\x91\x8e"}, {66599,"\xf0\x90\x91\x8f"}, {66736,"\xf0\x90\x93\x98"}, {66737,"\xf0\x90\x93\x99"}, {66738,"\xf0\x90\x93\x9a"}, {66739,"\xf0\x90\x93\x9b"},
+{66740,"\xf0\x90\x93\x9c"}, {66741,"\xf0\x90\x93\x9d"}, {66742,"\xf0\x90\x93\x9e"}, {66743,"\xf0\x90\x93\x9f"}, {66744,"\xf0\x90\x93\xa0"}, {66745,"\xf0\x90\x93\xa1"},
+{66746,"\xf0\x90\x93\xa2"}, {66747,"\xf0\x90\x93\xa3"}, {66748,"\xf0\x90\x93\xa4"}, {66749,"\xf0\x90\x93\xa5"}, {66750,"\xf0\x90\x93\xa6"}, {66751,"\xf0\x90\x93\xa7"},
+{66752,"\xf0\x90\x93\xa8"}, {66753,"\xf0\x90\x93\xa9"}, {66754,"\xf0\x90\x93\xaa"}, {66755,"\xf0\x90\x93\xab"}, {66756,"\xf0\x90\x93\xac"}, {66757,"\xf0\x90\x93\xad"},
+{66758,"\xf0\x90\x93\xae"}, {66759,"\xf0\x90\x93\xaf"}, {66760,"\xf0\x90\x93\xb0"}, {66761,"\xf0\x90\x93\xb1"}, {66762,"\xf0\x90\x93\xb2"}, {66763,"\xf0\x90\x93\xb3"},
+{66764,"\xf0\x90\x93\xb4"}, {66765,"\xf0\x90\x93\xb5"}, {66766,"\xf0\x90\x93\xb6"}, {66767,"\xf0\x90\x93\xb7"}, {66768,"\xf0\x90\x93\xb8"}, {66769,"\xf0\x90\x93\xb9"},
+{66770,"\xf0\x90\x93\xba"}, {66771,"\xf0\x90\x93\xbb"}, {66928,"\xf0\x90\x96\x97"}, {66929,"\xf0\x90\x96\x98"}, {66930,"\xf0\x90\x96\x99"}, {66931,"\xf0\x90\x96\x9a"},
+{66932,"\xf0\x90\x96\x9b"}, {66933,"\xf0\x90\x96\x9c"}, {66934,"\xf0\x90\x96\x9d"}, {66935,"\xf0\x90\x96\x9e"}, {66936,"\xf0\x90\x96\x9f"}, {66937,"\xf0\x90\x96\xa0"},
+{66938,"\xf0\x90\x96\xa1"}, {66940,"\xf0\x90\x96\xa3"}, {66941,"\xf0\x90\x96\xa4"}, {66942,"\xf0\x90\x96\xa5"}, {66943,"\xf0\x90\x96\xa6"}, {66944,"\xf0\x90\x96\xa7"},
+{66945,"\xf0\x90\x96\xa8"}, {66946,"\xf0\x90\x96\xa9"}, {66947,"\xf0\x90\x96\xaa"}, {66948,"\xf0\x90\x96\xab"}, {66949,"\xf0\x90\x96\xac"}, {66950,"\xf0\x90\x96\xad"},
+{66951,"\xf0\x90\x96\xae"}, {66952,"\xf0\x90\x96\xaf"}, {66953,"\xf0\x90\x96\xb0"}, {66954,"\xf0\x90\x96\xb1"}, {66956,"\xf0\x90\x96\xb3"}, {66957,"\xf0\x90\x96\xb4"},
+{66958,"\xf0\x90\x96\xb5"}, {66959,"\xf0\x90\x96\xb6"}, {66960,"\xf0\x90\x96\xb7"}, {66961,"\xf0\x90\x96\xb8"}, {66962,"\xf0\x90\x96\xb9"}, {66964,"\xf0\x90\x96\xbb"},
+{66965,"\xf0\x90\x96\xbc"}, {68736,"\xf0\x90\xb3\x80"}, {68737,"\xf0\x90\xb3\x81"}, {68738,"\xf0\x90\xb3\x82"}, {68739,"\xf0\x90\xb3\x83"}, {68740,"\xf0\x90\xb3\x84"},
+{68741,"\xf0\x90\xb3\x85"}, {68742,"\xf0\x90\xb3\x86"}, {68743,"\xf0\x90\xb3\x87"}, {68744,"\xf0\x90\xb3\x88"}, {68745,"\xf0\x90\xb3\x89"}, {68746,"\xf0\x90\xb3\x8a"},
+{68747,"\xf0\x90\xb3\x8b"}, {68748,"\xf0\x90\xb3\x8c"}, {68749,"\xf0\x90\xb3\x8d"}, {68750,"\xf0\x90\xb3\x8e"}, {68751,"\xf0\x90\xb3\x8f"}, {68752,"\xf0\x90\xb3\x90"},
+{68753,"\xf0\x90\xb3\x91"}, {68754,"\xf0\x90\xb3\x92"}, {68755,"\xf0\x90\xb3\x93"}, {68756,"\xf0\x90\xb3\x94"}, {68757,"\xf0\x90\xb3\x95"}, {68758,"\xf0\x90\xb3\x96"},
+{68759,"\xf0\x90\xb3\x97"}, {68760,"\xf0\x90\xb3\x98"}, {68761,"\xf0\x90\xb3\x99"}, {68762,"\xf0\x90\xb3\x9a"}, {68763,"\xf0\x90\xb3\x9b"}, {68764,"\xf0\x90\xb3\x9c"},
+{68765,"\xf0\x90\xb3\x9d"}, {68766,"\xf0\x90\xb3\x9e"}, {68767,"\xf0\x90\xb3\x9f"}, {68768,"\xf0\x90\xb3\xa0"}, {68769,"\xf0\x90\xb3\xa1"}, {68770,"\xf0\x90\xb3\xa2"},
+{68771,"\xf0\x90\xb3\xa3"}, {68772,"\xf0\x90\xb3\xa4"}, {68773,"\xf0\x90\xb3\xa5"}, {68774,"\xf0\x90\xb3\xa6"}, {68775,"\xf0\x90\xb3\xa7"}, {68776,"\xf0\x90\xb3\xa8"},
+{68777,"\xf0\x90\xb3\xa9"}, {68778,"\xf0\x90\xb3\xaa"}, {68779,"\xf0\x90\xb3\xab"}, {68780,"\xf0\x90\xb3\xac"}, {68781,"\xf0\x90\xb3\xad"}, {68782,"\xf0\x90\xb3\xae"},
+{68783,"\xf0\x90\xb3\xaf"}, {68784,"\xf0\x90\xb3\xb0"}, {68785,"\xf0\x90\xb3\xb1"}, {68786,"\xf0\x90\xb3\xb2"}, {71840,"\xf0\x91\xa3\x80"}, {71841,"\xf0\x91\xa3\x81"},
+{71842,"\xf0\x91\xa3\x82"}, {71843,"\xf0\x91\xa3\x83"}, {71844,"\xf0\x91\xa3\x84"}, {71845,"\xf0\x91\xa3\x85"}, {71846,"\xf0\x91\xa3\x86"}, {71847,"\xf0\x91\xa3\x87"},
+{71848,"\xf0\x91\xa3\x88"}, {71849,"\xf0\x91\xa3\x89"}, {71850,"\xf0\x91\xa3\x8a"}, {71851,"\xf0\x91\xa3\x8b"}, {71852,"\xf0\x91\xa3\x8c"}, {71853,"\xf0\x91\xa3\x8d"},
+{71854,"\xf0\x91\xa3\x8e"}, {71855,"\xf0\x91\xa3\x8f"}, {71856,"\xf0\x91\xa3\x90"}, {71857,"\xf0\x91\xa3\x91"}, {71858,"\xf0\x91\xa3\x92"}, {71859,"\xf0\x91\xa3\x93"},
+{71860,"\xf0\x91\xa3\x94"}, {71861,"\xf0\x91\xa3\x95"}, {71862,"\xf0\x91\xa3\x96"}, {71863,"\xf0\x91\xa3\x97"}, {71864,"\xf0\x91\xa3\x98"}, {71865,"\xf0\x91\xa3\x99"},
+{71866,"\xf0\x91\xa3\x9a"}, {71867,"\xf0\x91\xa3\x9b"}, {71868,"\xf0\x91\xa3\x9c"}, {71869,"\xf0\x91\xa3\x9d"}, {71870,"\xf0\x91\xa3\x9e"}, {71871,"\xf0\x91\xa3\x9f"},
+{93760,"\xf0\x96\xb9\xa0"}, {93761,"\xf0\x96\xb9\xa1"}, {93762,"\xf0\x96\xb9\xa2"}, {93763,"\xf0\x96\xb9\xa3"}, {93764,"\xf0\x96\xb9\xa4"}, {93765,"\xf0\x96\xb9\xa5"},
+{93766,"\xf0\x96\xb9\xa6"}, {93767,"\xf0\x96\xb9\xa7"}, {93768,"\xf0\x96\xb9\xa8"}, {93769,"\xf0\x96\xb9\xa9"}, {93770,"\xf0\x96\xb9\xaa"}, {93771,"\xf0\x96\xb9\xab"},
+{93772,"\xf0\x96\xb9\xac"}, {93773,"\xf0\x96\xb9\xad"}, {93774,"\xf0\x96\xb9\xae"}, {93775,"\xf0\x96\xb9\xaf"}, {93776,"\xf0\x96\xb9\xb0"}, {93777,"\xf0\x96\xb9\xb1"},
+{93778,"\xf0\x96\xb9\xb2"}, {93779,"\xf0\x96\xb9\xb3"}, {93780,"\xf0\x96\xb9\xb4"}, {93781,"\xf0\x96\xb9\xb5"}, {93782,"\xf0\x96\xb9\xb6"}, {93783,"\xf0\x96\xb9\xb7"},
+{93784,"\xf0\x96\xb9\xb8"}, {93785,"\xf0\x96\xb9\xb9"}, {93786,"\xf0\x96\xb9\xba"}, {93787,"\xf0\x96\xb9\xbb"}, {93788,"\xf0\x96\xb9\xbc"}, {93789,"\xf0\x96\xb9\xbd"},
+{93790,"\xf0\x96\xb9\xbe"}, {93791,"\xf0\x96\xb9\xbf"}, {125184,"\xf0\x9e\xa4\xa2"}, {125185,"\xf0\x9e\xa4\xa3"}, {125186,"\xf0\x9e\xa4\xa4"}, {125187,"\xf0\x9e\xa4\xa5"},
+{125188,"\xf0\x9e\xa4\xa6"}, {125189,"\xf0\x9e\xa4\xa7"}, {125190,"\xf0\x9e\xa4\xa8"}, {125191,"\xf0\x9e\xa4\xa9"}, {125192,"\xf0\x9e\xa4\xaa"}, {125193,"\xf0\x9e\xa4\xab"},
+{125194,"\xf0\x9e\xa4\xac"}, {125195,"\xf0\x9e\xa4\xad"}, {125196,"\xf0\x9e\xa4\xae"}, {125197,"\xf0\x9e\xa4\xaf"}, {125198,"\xf0\x9e\xa4\xb0"}, {125199,"\xf0\x9e\xa4\xb1"},
+{125200,"\xf0\x9e\xa4\xb2"}, {125201,"\xf0\x9e\xa4\xb3"}, {125202,"\xf0\x9e\xa4\xb4"}, {125203,"\xf0\x9e\xa4\xb5"}, {125204,"\xf0\x9e\xa4\xb6"}, {125205,"\xf0\x9e\xa4\xb7"},
+{125206,"\xf0\x9e\xa4\xb8"}, {125207,"\xf0\x9e\xa4\xb9"}, {125208,"\xf0\x9e\xa4\xba"}, {125209,"\xf0\x9e\xa4\xbb"}, {125210,"\xf0\x9e\xa4\xbc"}, {125211,"\xf0\x9e\xa4\xbd"},
+{125212,"\xf0\x9e\xa4\xbe"}, {125213,"\xf0\x9e\xa4\xbf"}, {125214,"\xf0\x9e\xa5\x80"}, {125215,"\xf0\x9e\xa5\x81"}, {125216,"\xf0\x9e\xa5\x82"}, {125217,"\xf0\x9e\xa5\x83"},
 //--Autogenerated -- end of section automatically generated
 };
 
-// Characters that have complex case conversions are listed here.
-// This includes cases where more than one character is needed for a conversion,
-// folding is different to lowering, or (as appropriate) upper(lower(x)) != x or
-// lower(upper(x)) != x.
-
-constexpr std::string_view complexCaseConversions =
-// Original | Folded | Upper | Lower |
+constexpr CharacterConversion upperConversions[] = {
 //++Autogenerated -- start of section automatically generated
-//**2 \(\*\n\)
-"\xc2\xb5|\xce\xbc|\xce\x9c||"
-"\xc3\x9f|ss|SS||"
-"\xc4\xb0|i\xcc\x87||i\xcc\x87|"
-"\xc4\xb1||I||"
-"\xc5\x89|\xca\xbcn|\xca\xbcN||"
-"\xc5\xbf|s|S||"
-"\xc7\x85|\xc7\x86|\xc7\x84|\xc7\x86|"
-"\xc7\x88|\xc7\x89|\xc7\x87|\xc7\x89|"
-"\xc7\x8b|\xc7\x8c|\xc7\x8a|\xc7\x8c|"
-"\xc7\xb0|j\xcc\x8c|J\xcc\x8c||"
-"\xc7\xb2|\xc7\xb3|\xc7\xb1|\xc7\xb3|"
-"\xcd\x85|\xce\xb9|\xce\x99||"
-"\xce\x90|\xce\xb9\xcc\x88\xcc\x81|\xce\x99\xcc\x88\xcc\x81||"
-"\xce\xb0|\xcf\x85\xcc\x88\xcc\x81|\xce\xa5\xcc\x88\xcc\x81||"
-"\xcf\x82|\xcf\x83|\xce\xa3||"
-"\xcf\x90|\xce\xb2|\xce\x92||"
-"\xcf\x91|\xce\xb8|\xce\x98||"
-"\xcf\x95|\xcf\x86|\xce\xa6||"
-"\xcf\x96|\xcf\x80|\xce\xa0||"
-"\xcf\xb0|\xce\xba|\xce\x9a||"
-"\xcf\xb1|\xcf\x81|\xce\xa1||"
-"\xcf\xb4|\xce\xb8||\xce\xb8|"
-"\xcf\xb5|\xce\xb5|\xce\x95||"
-"\xd6\x87|\xd5\xa5\xd6\x82|\xd4\xb5\xd5\x92||"
-"\xe1\x8e\xa0|||\xea\xad\xb0|"
-"\xe1\x8e\xa1|||\xea\xad\xb1|"
-"\xe1\x8e\xa2|||\xea\xad\xb2|"
-"\xe1\x8e\xa3|||\xea\xad\xb3|"
-"\xe1\x8e\xa4|||\xea\xad\xb4|"
-"\xe1\x8e\xa5|||\xea\xad\xb5|"
-"\xe1\x8e\xa6|||\xea\xad\xb6|"
-"\xe1\x8e\xa7|||\xea\xad\xb7|"
-"\xe1\x8e\xa8|||\xea\xad\xb8|"
-"\xe1\x8e\xa9|||\xea\xad\xb9|"
-"\xe1\x8e\xaa|||\xea\xad\xba|"
-"\xe1\x8e\xab|||\xea\xad\xbb|"
-"\xe1\x8e\xac|||\xea\xad\xbc|"
-"\xe1\x8e\xad|||\xea\xad\xbd|"
-"\xe1\x8e\xae|||\xea\xad\xbe|"
-"\xe1\x8e\xaf|||\xea\xad\xbf|"
-"\xe1\x8e\xb0|||\xea\xae\x80|"
-"\xe1\x8e\xb1|||\xea\xae\x81|"
-"\xe1\x8e\xb2|||\xea\xae\x82|"
-"\xe1\x8e\xb3|||\xea\xae\x83|"
-"\xe1\x8e\xb4|||\xea\xae\x84|"
-"\xe1\x8e\xb5|||\xea\xae\x85|"
-"\xe1\x8e\xb6|||\xea\xae\x86|"
-"\xe1\x8e\xb7|||\xea\xae\x87|"
-"\xe1\x8e\xb8|||\xea\xae\x88|"
-"\xe1\x8e\xb9|||\xea\xae\x89|"
-"\xe1\x8e\xba|||\xea\xae\x8a|"
-"\xe1\x8e\xbb|||\xea\xae\x8b|"
-"\xe1\x8e\xbc|||\xea\xae\x8c|"
-"\xe1\x8e\xbd|||\xea\xae\x8d|"
-"\xe1\x8e\xbe|||\xea\xae\x8e|"
-"\xe1\x8e\xbf|||\xea\xae\x8f|"
-"\xe1\x8f\x80|||\xea\xae\x90|"
-"\xe1\x8f\x81|||\xea\xae\x91|"
-"\xe1\x8f\x82|||\xea\xae\x92|"
-"\xe1\x8f\x83|||\xea\xae\x93|"
-"\xe1\x8f\x84|||\xea\xae\x94|"
-"\xe1\x8f\x85|||\xea\xae\x95|"
-"\xe1\x8f\x86|||\xea\xae\x96|"
-"\xe1\x8f\x87|||\xea\xae\x97|"
-"\xe1\x8f\x88|||\xea\xae\x98|"
-"\xe1\x8f\x89|||\xea\xae\x99|"
-"\xe1\x8f\x8a|||\xea\xae\x9a|"
-"\xe1\x8f\x8b|||\xea\xae\x9b|"
-"\xe1\x8f\x8c|||\xea\xae\x9c|"
-"\xe1\x8f\x8d|||\xea\xae\x9d|"
-"\xe1\x8f\x8e|||\xea\xae\x9e|"
-"\xe1\x8f\x8f|||\xea\xae\x9f|"
-"\xe1\x8f\x90|||\xea\xae\xa0|"
-"\xe1\x8f\x91|||\xea\xae\xa1|"
-"\xe1\x8f\x92|||\xea\xae\xa2|"
-"\xe1\x8f\x93|||\xea\xae\xa3|"
-"\xe1\x8f\x94|||\xea\xae\xa4|"
-"\xe1\x8f\x95|||\xea\xae\xa5|"
-"\xe1\x8f\x96|||\xea\xae\xa6|"
-"\xe1\x8f\x97|||\xea\xae\xa7|"
-"\xe1\x8f\x98|||\xea\xae\xa8|"
-"\xe1\x8f\x99|||\xea\xae\xa9|"
-"\xe1\x8f\x9a|||\xea\xae\xaa|"
-"\xe1\x8f\x9b|||\xea\xae\xab|"
-"\xe1\x8f\x9c|||\xea\xae\xac|"
-"\xe1\x8f\x9d|||\xea\xae\xad|"
-"\xe1\x8f\x9e|||\xea\xae\xae|"
-"\xe1\x8f\x9f|||\xea\xae\xaf|"
-"\xe1\x8f\xa0|||\xea\xae\xb0|"
-"\xe1\x8f\xa1|||\xea\xae\xb1|"
-"\xe1\x8f\xa2|||\xea\xae\xb2|"
-"\xe1\x8f\xa3|||\xea\xae\xb3|"
-"\xe1\x8f\xa4|||\xea\xae\xb4|"
-"\xe1\x8f\xa5|||\xea\xae\xb5|"
-"\xe1\x8f\xa6|||\xea\xae\xb6|"
-"\xe1\x8f\xa7|||\xea\xae\xb7|"
-"\xe1\x8f\xa8|||\xea\xae\xb8|"
-"\xe1\x8f\xa9|||\xea\xae\xb9|"
-"\xe1\x8f\xaa|||\xea\xae\xba|"
-"\xe1\x8f\xab|||\xea\xae\xbb|"
-"\xe1\x8f\xac|||\xea\xae\xbc|"
-"\xe1\x8f\xad|||\xea\xae\xbd|"
-"\xe1\x8f\xae|||\xea\xae\xbe|"
-"\xe1\x8f\xaf|||\xea\xae\xbf|"
-"\xe1\x8f\xb0|||\xe1\x8f\xb8|"
-"\xe1\x8f\xb1|||\xe1\x8f\xb9|"
-"\xe1\x8f\xb2|||\xe1\x8f\xba|"
-"\xe1\x8f\xb3|||\xe1\x8f\xbb|"
-"\xe1\x8f\xb4|||\xe1\x8f\xbc|"
-"\xe1\x8f\xb5|||\xe1\x8f\xbd|"
-"\xe1\x8f\xb8|\xe1\x8f\xb0|\xe1\x8f\xb0||"
-"\xe1\x8f\xb9|\xe1\x8f\xb1|\xe1\x8f\xb1||"
-"\xe1\x8f\xba|\xe1\x8f\xb2|\xe1\x8f\xb2||"
-"\xe1\x8f\xbb|\xe1\x8f\xb3|\xe1\x8f\xb3||"
-"\xe1\x8f\xbc|\xe1\x8f\xb4|\xe1\x8f\xb4||"
-"\xe1\x8f\xbd|\xe1\x8f\xb5|\xe1\x8f\xb5||"
-"\xe1\xb2\x80|\xd0\xb2|\xd0\x92||"
-"\xe1\xb2\x81|\xd0\xb4|\xd0\x94||"
-"\xe1\xb2\x82|\xd0\xbe|\xd0\x9e||"
-"\xe1\xb2\x83|\xd1\x81|\xd0\xa1||"
-"\xe1\xb2\x84|\xd1\x82|\xd0\xa2||"
-"\xe1\xb2\x85|\xd1\x82|\xd0\xa2||"
-"\xe1\xb2\x86|\xd1\x8a|\xd0\xaa||"
-"\xe1\xb2\x87|\xd1\xa3|\xd1\xa2||"
-"\xe1\xb2\x88|\xea\x99\x8b|\xea\x99\x8a||"
-"\xe1\xba\x96|h\xcc\xb1|H\xcc\xb1||"
-"\xe1\xba\x97|t\xcc\x88|T\xcc\x88||"
-"\xe1\xba\x98|w\xcc\x8a|W\xcc\x8a||"
-"\xe1\xba\x99|y\xcc\x8a|Y\xcc\x8a||"
-"\xe1\xba\x9a|a\xca\xbe|A\xca\xbe||"
-"\xe1\xba\x9b|\xe1\xb9\xa1|\xe1\xb9\xa0||"
-"\xe1\xba\x9e|ss||\xc3\x9f|"
-"\xe1\xbd\x90|\xcf\x85\xcc\x93|\xce\xa5\xcc\x93||"
-"\xe1\xbd\x92|\xcf\x85\xcc\x93\xcc\x80|\xce\xa5\xcc\x93\xcc\x80||"
-"\xe1\xbd\x94|\xcf\x85\xcc\x93\xcc\x81|\xce\xa5\xcc\x93\xcc\x81||"
-"\xe1\xbd\x96|\xcf\x85\xcc\x93\xcd\x82|\xce\xa5\xcc\x93\xcd\x82||"
-"\xe1\xbe\x80|\xe1\xbc\x80\xce\xb9|\xe1\xbc\x88\xce\x99||"
-"\xe1\xbe\x81|\xe1\xbc\x81\xce\xb9|\xe1\xbc\x89\xce\x99||"
-"\xe1\xbe\x82|\xe1\xbc\x82\xce\xb9|\xe1\xbc\x8a\xce\x99||"
-"\xe1\xbe\x83|\xe1\xbc\x83\xce\xb9|\xe1\xbc\x8b\xce\x99||"
-"\xe1\xbe\x84|\xe1\xbc\x84\xce\xb9|\xe1\xbc\x8c\xce\x99||"
-"\xe1\xbe\x85|\xe1\xbc\x85\xce\xb9|\xe1\xbc\x8d\xce\x99||"
-"\xe1\xbe\x86|\xe1\xbc\x86\xce\xb9|\xe1\xbc\x8e\xce\x99||"
-"\xe1\xbe\x87|\xe1\xbc\x87\xce\xb9|\xe1\xbc\x8f\xce\x99||"
-"\xe1\xbe\x88|\xe1\xbc\x80\xce\xb9|\xe1\xbc\x88\xce\x99|\xe1\xbe\x80|"
-"\xe1\xbe\x89|\xe1\xbc\x81\xce\xb9|\xe1\xbc\x89\xce\x99|\xe1\xbe\x81|"
-"\xe1\xbe\x8a|\xe1\xbc\x82\xce\xb9|\xe1\xbc\x8a\xce\x99|\xe1\xbe\x82|"
-"\xe1\xbe\x8b|\xe1\xbc\x83\xce\xb9|\xe1\xbc\x8b\xce\x99|\xe1\xbe\x83|"
-"\xe1\xbe\x8c|\xe1\xbc\x84\xce\xb9|\xe1\xbc\x8c\xce\x99|\xe1\xbe\x84|"
-"\xe1\xbe\x8d|\xe1\xbc\x85\xce\xb9|\xe1\xbc\x8d\xce\x99|\xe1\xbe\x85|"
-"\xe1\xbe\x8e|\xe1\xbc\x86\xce\xb9|\xe1\xbc\x8e\xce\x99|\xe1\xbe\x86|"
-"\xe1\xbe\x8f|\xe1\xbc\x87\xce\xb9|\xe1\xbc\x8f\xce\x99|\xe1\xbe\x87|"
-"\xe1\xbe\x90|\xe1\xbc\xa0\xce\xb9|\xe1\xbc\xa8\xce\x99||"
-"\xe1\xbe\x91|\xe1\xbc\xa1\xce\xb9|\xe1\xbc\xa9\xce\x99||"
-"\xe1\xbe\x92|\xe1\xbc\xa2\xce\xb9|\xe1\xbc\xaa\xce\x99||"
-"\xe1\xbe\x93|\xe1\xbc\xa3\xce\xb9|\xe1\xbc\xab\xce\x99||"
-"\xe1\xbe\x94|\xe1\xbc\xa4\xce\xb9|\xe1\xbc\xac\xce\x99||"
-"\xe1\xbe\x95|\xe1\xbc\xa5\xce\xb9|\xe1\xbc\xad\xce\x99||"
-"\xe1\xbe\x96|\xe1\xbc\xa6\xce\xb9|\xe1\xbc\xae\xce\x99||"
-"\xe1\xbe\x97|\xe1\xbc\xa7\xce\xb9|\xe1\xbc\xaf\xce\x99||"
-"\xe1\xbe\x98|\xe1\xbc\xa0\xce\xb9|\xe1\xbc\xa8\xce\x99|\xe1\xbe\x90|"
-"\xe1\xbe\x99|\xe1\xbc\xa1\xce\xb9|\xe1\xbc\xa9\xce\x99|\xe1\xbe\x91|"
-"\xe1\xbe\x9a|\xe1\xbc\xa2\xce\xb9|\xe1\xbc\xaa\xce\x99|\xe1\xbe\x92|"
-"\xe1\xbe\x9b|\xe1\xbc\xa3\xce\xb9|\xe1\xbc\xab\xce\x99|\xe1\xbe\x93|"
-"\xe1\xbe\x9c|\xe1\xbc\xa4\xce\xb9|\xe1\xbc\xac\xce\x99|\xe1\xbe\x94|"
-"\xe1\xbe\x9d|\xe1\xbc\xa5\xce\xb9|\xe1\xbc\xad\xce\x99|\xe1\xbe\x95|"
-"\xe1\xbe\x9e|\xe1\xbc\xa6\xce\xb9|\xe1\xbc\xae\xce\x99|\xe1\xbe\x96|"
-"\xe1\xbe\x9f|\xe1\xbc\xa7\xce\xb9|\xe1\xbc\xaf\xce\x99|\xe1\xbe\x97|"
-"\xe1\xbe\xa0|\xe1\xbd\xa0\xce\xb9|\xe1\xbd\xa8\xce\x99||"
-"\xe1\xbe\xa1|\xe1\xbd\xa1\xce\xb9|\xe1\xbd\xa9\xce\x99||"
-"\xe1\xbe\xa2|\xe1\xbd\xa2\xce\xb9|\xe1\xbd\xaa\xce\x99||"
-"\xe1\xbe\xa3|\xe1\xbd\xa3\xce\xb9|\xe1\xbd\xab\xce\x99||"
-"\xe1\xbe\xa4|\xe1\xbd\xa4\xce\xb9|\xe1\xbd\xac\xce\x99||"
-"\xe1\xbe\xa5|\xe1\xbd\xa5\xce\xb9|\xe1\xbd\xad\xce\x99||"
-"\xe1\xbe\xa6|\xe1\xbd\xa6\xce\xb9|\xe1\xbd\xae\xce\x99||"
-"\xe1\xbe\xa7|\xe1\xbd\xa7\xce\xb9|\xe1\xbd\xaf\xce\x99||"
-"\xe1\xbe\xa8|\xe1\xbd\xa0\xce\xb9|\xe1\xbd\xa8\xce\x99|\xe1\xbe\xa0|"
-"\xe1\xbe\xa9|\xe1\xbd\xa1\xce\xb9|\xe1\xbd\xa9\xce\x99|\xe1\xbe\xa1|"
-"\xe1\xbe\xaa|\xe1\xbd\xa2\xce\xb9|\xe1\xbd\xaa\xce\x99|\xe1\xbe\xa2|"
-"\xe1\xbe\xab|\xe1\xbd\xa3\xce\xb9|\xe1\xbd\xab\xce\x99|\xe1\xbe\xa3|"
-"\xe1\xbe\xac|\xe1\xbd\xa4\xce\xb9|\xe1\xbd\xac\xce\x99|\xe1\xbe\xa4|"
-"\xe1\xbe\xad|\xe1\xbd\xa5\xce\xb9|\xe1\xbd\xad\xce\x99|\xe1\xbe\xa5|"
-"\xe1\xbe\xae|\xe1\xbd\xa6\xce\xb9|\xe1\xbd\xae\xce\x99|\xe1\xbe\xa6|"
-"\xe1\xbe\xaf|\xe1\xbd\xa7\xce\xb9|\xe1\xbd\xaf\xce\x99|\xe1\xbe\xa7|"
-"\xe1\xbe\xb2|\xe1\xbd\xb0\xce\xb9|\xe1\xbe\xba\xce\x99||"
-"\xe1\xbe\xb3|\xce\xb1\xce\xb9|\xce\x91\xce\x99||"
-"\xe1\xbe\xb4|\xce\xac\xce\xb9|\xce\x86\xce\x99||"
-"\xe1\xbe\xb6|\xce\xb1\xcd\x82|\xce\x91\xcd\x82||"
-"\xe1\xbe\xb7|\xce\xb1\xcd\x82\xce\xb9|\xce\x91\xcd\x82\xce\x99||"
-"\xe1\xbe\xbc|\xce\xb1\xce\xb9|\xce\x91\xce\x99|\xe1\xbe\xb3|"
-"\xe1\xbe\xbe|\xce\xb9|\xce\x99||"
-"\xe1\xbf\x82|\xe1\xbd\xb4\xce\xb9|\xe1\xbf\x8a\xce\x99||"
-"\xe1\xbf\x83|\xce\xb7\xce\xb9|\xce\x97\xce\x99||"
-"\xe1\xbf\x84|\xce\xae\xce\xb9|\xce\x89\xce\x99||"
-"\xe1\xbf\x86|\xce\xb7\xcd\x82|\xce\x97\xcd\x82||"
-"\xe1\xbf\x87|\xce\xb7\xcd\x82\xce\xb9|\xce\x97\xcd\x82\xce\x99||"
-"\xe1\xbf\x8c|\xce\xb7\xce\xb9|\xce\x97\xce\x99|\xe1\xbf\x83|"
-"\xe1\xbf\x92|\xce\xb9\xcc\x88\xcc\x80|\xce\x99\xcc\x88\xcc\x80||"
-"\xe1\xbf\x93|\xce\xb9\xcc\x88\xcc\x81|\xce\x99\xcc\x88\xcc\x81||"
-"\xe1\xbf\x96|\xce\xb9\xcd\x82|\xce\x99\xcd\x82||"
-"\xe1\xbf\x97|\xce\xb9\xcc\x88\xcd\x82|\xce\x99\xcc\x88\xcd\x82||"
-"\xe1\xbf\xa2|\xcf\x85\xcc\x88\xcc\x80|\xce\xa5\xcc\x88\xcc\x80||"
-"\xe1\xbf\xa3|\xcf\x85\xcc\x88\xcc\x81|\xce\xa5\xcc\x88\xcc\x81||"
-"\xe1\xbf\xa4|\xcf\x81\xcc\x93|\xce\xa1\xcc\x93||"
-"\xe1\xbf\xa6|\xcf\x85\xcd\x82|\xce\xa5\xcd\x82||"
-"\xe1\xbf\xa7|\xcf\x85\xcc\x88\xcd\x82|\xce\xa5\xcc\x88\xcd\x82||"
-"\xe1\xbf\xb2|\xe1\xbd\xbc\xce\xb9|\xe1\xbf\xba\xce\x99||"
-"\xe1\xbf\xb3|\xcf\x89\xce\xb9|\xce\xa9\xce\x99||"
-"\xe1\xbf\xb4|\xcf\x8e\xce\xb9|\xce\x8f\xce\x99||"
-"\xe1\xbf\xb6|\xcf\x89\xcd\x82|\xce\xa9\xcd\x82||"
-"\xe1\xbf\xb7|\xcf\x89\xcd\x82\xce\xb9|\xce\xa9\xcd\x82\xce\x99||"
-"\xe1\xbf\xbc|\xcf\x89\xce\xb9|\xce\xa9\xce\x99|\xe1\xbf\xb3|"
-"\xe2\x84\xa6|\xcf\x89||\xcf\x89|"
-"\xe2\x84\xaa|k||k|"
-"\xe2\x84\xab|\xc3\xa5||\xc3\xa5|"
-"\xea\xad\xb0|\xe1\x8e\xa0|\xe1\x8e\xa0||"
-"\xea\xad\xb1|\xe1\x8e\xa1|\xe1\x8e\xa1||"
-"\xea\xad\xb2|\xe1\x8e\xa2|\xe1\x8e\xa2||"
-"\xea\xad\xb3|\xe1\x8e\xa3|\xe1\x8e\xa3||"
-"\xea\xad\xb4|\xe1\x8e\xa4|\xe1\x8e\xa4||"
-"\xea\xad\xb5|\xe1\x8e\xa5|\xe1\x8e\xa5||"
-"\xea\xad\xb6|\xe1\x8e\xa6|\xe1\x8e\xa6||"
-"\xea\xad\xb7|\xe1\x8e\xa7|\xe1\x8e\xa7||"
-"\xea\xad\xb8|\xe1\x8e\xa8|\xe1\x8e\xa8||"
-"\xea\xad\xb9|\xe1\x8e\xa9|\xe1\x8e\xa9||"
-"\xea\xad\xba|\xe1\x8e\xaa|\xe1\x8e\xaa||"
-"\xea\xad\xbb|\xe1\x8e\xab|\xe1\x8e\xab||"
-"\xea\xad\xbc|\xe1\x8e\xac|\xe1\x8e\xac||"
-"\xea\xad\xbd|\xe1\x8e\xad|\xe1\x8e\xad||"
-"\xea\xad\xbe|\xe1\x8e\xae|\xe1\x8e\xae||"
-"\xea\xad\xbf|\xe1\x8e\xaf|\xe1\x8e\xaf||"
-"\xea\xae\x80|\xe1\x8e\xb0|\xe1\x8e\xb0||"
-"\xea\xae\x81|\xe1\x8e\xb1|\xe1\x8e\xb1||"
-"\xea\xae\x82|\xe1\x8e\xb2|\xe1\x8e\xb2||"
-"\xea\xae\x83|\xe1\x8e\xb3|\xe1\x8e\xb3||"
-"\xea\xae\x84|\xe1\x8e\xb4|\xe1\x8e\xb4||"
-"\xea\xae\x85|\xe1\x8e\xb5|\xe1\x8e\xb5||"
-"\xea\xae\x86|\xe1\x8e\xb6|\xe1\x8e\xb6||"
-"\xea\xae\x87|\xe1\x8e\xb7|\xe1\x8e\xb7||"
-"\xea\xae\x88|\xe1\x8e\xb8|\xe1\x8e\xb8||"
-"\xea\xae\x89|\xe1\x8e\xb9|\xe1\x8e\xb9||"
-"\xea\xae\x8a|\xe1\x8e\xba|\xe1\x8e\xba||"
-"\xea\xae\x8b|\xe1\x8e\xbb|\xe1\x8e\xbb||"
-"\xea\xae\x8c|\xe1\x8e\xbc|\xe1\x8e\xbc||"
-"\xea\xae\x8d|\xe1\x8e\xbd|\xe1\x8e\xbd||"
-"\xea\xae\x8e|\xe1\x8e\xbe|\xe1\x8e\xbe||"
-"\xea\xae\x8f|\xe1\x8e\xbf|\xe1\x8e\xbf||"
-"\xea\xae\x90|\xe1\x8f\x80|\xe1\x8f\x80||"
-"\xea\xae\x91|\xe1\x8f\x81|\xe1\x8f\x81||"
-"\xea\xae\x92|\xe1\x8f\x82|\xe1\x8f\x82||"
-"\xea\xae\x93|\xe1\x8f\x83|\xe1\x8f\x83||"
-"\xea\xae\x94|\xe1\x8f\x84|\xe1\x8f\x84||"
-"\xea\xae\x95|\xe1\x8f\x85|\xe1\x8f\x85||"
-"\xea\xae\x96|\xe1\x8f\x86|\xe1\x8f\x86||"
-"\xea\xae\x97|\xe1\x8f\x87|\xe1\x8f\x87||"
-"\xea\xae\x98|\xe1\x8f\x88|\xe1\x8f\x88||"
-"\xea\xae\x99|\xe1\x8f\x89|\xe1\x8f\x89||"
-"\xea\xae\x9a|\xe1\x8f\x8a|\xe1\x8f\x8a||"
-"\xea\xae\x9b|\xe1\x8f\x8b|\xe1\x8f\x8b||"
-"\xea\xae\x9c|\xe1\x8f\x8c|\xe1\x8f\x8c||"
-"\xea\xae\x9d|\xe1\x8f\x8d|\xe1\x8f\x8d||"
-"\xea\xae\x9e|\xe1\x8f\x8e|\xe1\x8f\x8e||"
-"\xea\xae\x9f|\xe1\x8f\x8f|\xe1\x8f\x8f||"
-"\xea\xae\xa0|\xe1\x8f\x90|\xe1\x8f\x90||"
-"\xea\xae\xa1|\xe1\x8f\x91|\xe1\x8f\x91||"
-"\xea\xae\xa2|\xe1\x8f\x92|\xe1\x8f\x92||"
-"\xea\xae\xa3|\xe1\x8f\x93|\xe1\x8f\x93||"
-"\xea\xae\xa4|\xe1\x8f\x94|\xe1\x8f\x94||"
-"\xea\xae\xa5|\xe1\x8f\x95|\xe1\x8f\x95||"
-"\xea\xae\xa6|\xe1\x8f\x96|\xe1\x8f\x96||"
-"\xea\xae\xa7|\xe1\x8f\x97|\xe1\x8f\x97||"
-"\xea\xae\xa8|\xe1\x8f\x98|\xe1\x8f\x98||"
-"\xea\xae\xa9|\xe1\x8f\x99|\xe1\x8f\x99||"
-"\xea\xae\xaa|\xe1\x8f\x9a|\xe1\x8f\x9a||"
-"\xea\xae\xab|\xe1\x8f\x9b|\xe1\x8f\x9b||"
-"\xea\xae\xac|\xe1\x8f\x9c|\xe1\x8f\x9c||"
-"\xea\xae\xad|\xe1\x8f\x9d|\xe1\x8f\x9d||"
-"\xea\xae\xae|\xe1\x8f\x9e|\xe1\x8f\x9e||"
-"\xea\xae\xaf|\xe1\x8f\x9f|\xe1\x8f\x9f||"
-"\xea\xae\xb0|\xe1\x8f\xa0|\xe1\x8f\xa0||"
-"\xea\xae\xb1|\xe1\x8f\xa1|\xe1\x8f\xa1||"
-"\xea\xae\xb2|\xe1\x8f\xa2|\xe1\x8f\xa2||"
-"\xea\xae\xb3|\xe1\x8f\xa3|\xe1\x8f\xa3||"
-"\xea\xae\xb4|\xe1\x8f\xa4|\xe1\x8f\xa4||"
-"\xea\xae\xb5|\xe1\x8f\xa5|\xe1\x8f\xa5||"
-"\xea\xae\xb6|\xe1\x8f\xa6|\xe1\x8f\xa6||"
-"\xea\xae\xb7|\xe1\x8f\xa7|\xe1\x8f\xa7||"
-"\xea\xae\xb8|\xe1\x8f\xa8|\xe1\x8f\xa8||"
-"\xea\xae\xb9|\xe1\x8f\xa9|\xe1\x8f\xa9||"
-"\xea\xae\xba|\xe1\x8f\xaa|\xe1\x8f\xaa||"
-"\xea\xae\xbb|\xe1\x8f\xab|\xe1\x8f\xab||"
-"\xea\xae\xbc|\xe1\x8f\xac|\xe1\x8f\xac||"
-"\xea\xae\xbd|\xe1\x8f\xad|\xe1\x8f\xad||"
-"\xea\xae\xbe|\xe1\x8f\xae|\xe1\x8f\xae||"
-"\xea\xae\xbf|\xe1\x8f\xaf|\xe1\x8f\xaf||"
-"\xef\xac\x80|ff|FF||"
-"\xef\xac\x81|fi|FI||"
-"\xef\xac\x82|fl|FL||"
-"\xef\xac\x83|ffi|FFI||"
-"\xef\xac\x84|ffl|FFL||"
-"\xef\xac\x85|st|ST||"
-"\xef\xac\x86|st|ST||"
-"\xef\xac\x93|\xd5\xb4\xd5\xb6|\xd5\x84\xd5\x86||"
-"\xef\xac\x94|\xd5\xb4\xd5\xa5|\xd5\x84\xd4\xb5||"
-"\xef\xac\x95|\xd5\xb4\xd5\xab|\xd5\x84\xd4\xbb||"
-"\xef\xac\x96|\xd5\xbe\xd5\xb6|\xd5\x8e\xd5\x86||"
-"\xef\xac\x97|\xd5\xb4\xd5\xad|\xd5\x84\xd4\xbd||"
-
+{97,"A"}, {98,"B"}, {99,"C"}, {100,"D"}, {101,"E"}, {102,"F"},
+{103,"G"}, {104,"H"}, {105,"I"}, {106,"J"}, {107,"K"}, {108,"L"},
+{109,"M"}, {110,"N"}, {111,"O"}, {112,"P"}, {113,"Q"}, {114,"R"},
+{115,"S"}, {116,"T"}, {117,"U"}, {118,"V"}, {119,"W"}, {120,"X"},
+{121,"Y"}, {122,"Z"}, {181,"\xce\x9c"}, {223,"SS"}, {224,"\xc3\x80"}, {225,"\xc3\x81"},
+{226,"\xc3\x82"}, {227,"\xc3\x83"}, {228,"\xc3\x84"}, {229,"\xc3\x85"}, {230,"\xc3\x86"}, {231,"\xc3\x87"},
+{232,"\xc3\x88"}, {233,"\xc3\x89"}, {234,"\xc3\x8a"}, {235,"\xc3\x8b"}, {236,"\xc3\x8c"}, {237,"\xc3\x8d"},
+{238,"\xc3\x8e"}, {239,"\xc3\x8f"}, {240,"\xc3\x90"}, {241,"\xc3\x91"}, {242,"\xc3\x92"}, {243,"\xc3\x93"},
+{244,"\xc3\x94"}, {245,"\xc3\x95"}, {246,"\xc3\x96"}, {248,"\xc3\x98"}, {249,"\xc3\x99"}, {250,"\xc3\x9a"},
+{251,"\xc3\x9b"}, {252,"\xc3\x9c"}, {253,"\xc3\x9d"}, {254,"\xc3\x9e"}, {255,"\xc5\xb8"}, {257,"\xc4\x80"},
+{259,"\xc4\x82"}, {261,"\xc4\x84"}, {263,"\xc4\x86"}, {265,"\xc4\x88"}, {267,"\xc4\x8a"}, {269,"\xc4\x8c"},
+{271,"\xc4\x8e"}, {273,"\xc4\x90"}, {275,"\xc4\x92"}, {277,"\xc4\x94"}, {279,"\xc4\x96"}, {281,"\xc4\x98"},
+{283,"\xc4\x9a"}, {285,"\xc4\x9c"}, {287,"\xc4\x9e"}, {289,"\xc4\xa0"}, {291,"\xc4\xa2"}, {293,"\xc4\xa4"},
+{295,"\xc4\xa6"}, {297,"\xc4\xa8"}, {299,"\xc4\xaa"}, {301,"\xc4\xac"}, {303,"\xc4\xae"}, {305,"I"},
+{307,"\xc4\xb2"}, {309,"\xc4\xb4"}, {311,"\xc4\xb6"}, {314,"\xc4\xb9"}, {316,"\xc4\xbb"}, {318,"\xc4\xbd"},
+{320,"\xc4\xbf"}, {322,"\xc5\x81"}, {324,"\xc5\x83"}, {326,"\xc5\x85"}, {328,"\xc5\x87"}, {329,"\xca\xbcN"},
+{331,"\xc5\x8a"}, {333,"\xc5\x8c"}, {335,"\xc5\x8e"}, {337,"\xc5\x90"}, {339,"\xc5\x92"}, {341,"\xc5\x94"},
+{343,"\xc5\x96"}, {345,"\xc5\x98"}, {347,"\xc5\x9a"}, {349,"\xc5\x9c"}, {351,"\xc5\x9e"}, {353,"\xc5\xa0"},
+{355,"\xc5\xa2"}, {357,"\xc5\xa4"}, {359,"\xc5\xa6"}, {361,"\xc5\xa8"}, {363,"\xc5\xaa"}, {365,"\xc5\xac"},
+{367,"\xc5\xae"}, {369,"\xc5\xb0"}, {371,"\xc5\xb2"}, {373,"\xc5\xb4"}, {375,"\xc5\xb6"}, {378,"\xc5\xb9"},
+{380,"\xc5\xbb"}, {382,"\xc5\xbd"}, {383,"S"}, {384,"\xc9\x83"}, {387,"\xc6\x82"}, {389,"\xc6\x84"},
+{392,"\xc6\x87"}, {396,"\xc6\x8b"}, {402,"\xc6\x91"}, {405,"\xc7\xb6"}, {409,"\xc6\x98"}, {410,"\xc8\xbd"},
+{414,"\xc8\xa0"}, {417,"\xc6\xa0"}, {419,"\xc6\xa2"}, {421,"\xc6\xa4"}, {424,"\xc6\xa7"}, {429,"\xc6\xac"},
+{432,"\xc6\xaf"}, {436,"\xc6\xb3"}, {438,"\xc6\xb5"}, {441,"\xc6\xb8"}, {445,"\xc6\xbc"}, {447,"\xc7\xb7"},
+{453,"\xc7\x84"}, {454,"\xc7\x84"}, {456,"\xc7\x87"}, {457,"\xc7\x87"}, {459,"\xc7\x8a"}, {460,"\xc7\x8a"},
+{462,"\xc7\x8d"}, {464,"\xc7\x8f"}, {466,"\xc7\x91"}, {468,"\xc7\x93"}, {470,"\xc7\x95"}, {472,"\xc7\x97"},
+{474,"\xc7\x99"}, {476,"\xc7\x9b"}, {477,"\xc6\x8e"}, {479,"\xc7\x9e"}, {481,"\xc7\xa0"}, {483,"\xc7\xa2"},
+{485,"\xc7\xa4"}, {487,"\xc7\xa6"}, {489,"\xc7\xa8"}, {491,"\xc7\xaa"}, {493,"\xc7\xac"}, {495,"\xc7\xae"},
+{496,"J\xcc\x8c"}, {498,"\xc7\xb1"}, {499,"\xc7\xb1"}, {501,"\xc7\xb4"}, {505,"\xc7\xb8"}, {507,"\xc7\xba"},
+{509,"\xc7\xbc"}, {511,"\xc7\xbe"}, {513,"\xc8\x80"}, {515,"\xc8\x82"}, {517,"\xc8\x84"}, {519,"\xc8\x86"},
+{521,"\xc8\x88"}, {523,"\xc8\x8a"}, {525,"\xc8\x8c"}, {527,"\xc8\x8e"}, {529,"\xc8\x90"}, {531,"\xc8\x92"},
+{533,"\xc8\x94"}, {535,"\xc8\x96"}, {537,"\xc8\x98"}, {539,"\xc8\x9a"}, {541,"\xc8\x9c"}, {543,"\xc8\x9e"},
+{547,"\xc8\xa2"}, {549,"\xc8\xa4"}, {551,"\xc8\xa6"}, {553,"\xc8\xa8"}, {555,"\xc8\xaa"}, {557,"\xc8\xac"},
+{559,"\xc8\xae"}, {561,"\xc8\xb0"}, {563,"\xc8\xb2"}, {572,"\xc8\xbb"}, {575,"\xe2\xb1\xbe"}, {576,"\xe2\xb1\xbf"},
+{578,"\xc9\x81"}, {583,"\xc9\x86"}, {585,"\xc9\x88"}, {587,"\xc9\x8a"}, {589,"\xc9\x8c"}, {591,"\xc9\x8e"},
+{592,"\xe2\xb1\xaf"}, {593,"\xe2\xb1\xad"}, {594,"\xe2\xb1\xb0"}, {595,"\xc6\x81"}, {596,"\xc6\x86"}, {598,"\xc6\x89"},
+{599,"\xc6\x8a"}, {601,"\xc6\x8f"}, {603,"\xc6\x90"}, {604,"\xea\x9e\xab"}, {608,"\xc6\x93"}, {609,"\xea\x9e\xac"},
+{611,"\xc6\x94"}, {613,"\xea\x9e\x8d"}, {614,"\xea\x9e\xaa"}, {616,"\xc6\x97"}, {617,"\xc6\x96"}, {618,"\xea\x9e\xae"},
+{619,"\xe2\xb1\xa2"}, {620,"\xea\x9e\xad"}, {623,"\xc6\x9c"}, {625,"\xe2\xb1\xae"}, {626,"\xc6\x9d"}, {629,"\xc6\x9f"},
+{637,"\xe2\xb1\xa4"}, {640,"\xc6\xa6"}, {642,"\xea\x9f\x85"}, {643,"\xc6\xa9"}, {647,"\xea\x9e\xb1"}, {648,"\xc6\xae"},
+{649,"\xc9\x84"}, {650,"\xc6\xb1"}, {651,"\xc6\xb2"}, {652,"\xc9\x85"}, {658,"\xc6\xb7"}, {669,"\xea\x9e\xb2"},
+{670,"\xea\x9e\xb0"}, {837,"\xce\x99"}, {881,"\xcd\xb0"}, {883,"\xcd\xb2"}, {887,"\xcd\xb6"}, {891,"\xcf\xbd"},
+{892,"\xcf\xbe"}, {893,"\xcf\xbf"}, {912,"\xce\x99\xcc\x88\xcc\x81"}, {940,"\xce\x86"}, {941,"\xce\x88"}, {942,"\xce\x89"},
+{943,"\xce\x8a"}, {944,"\xce\xa5\xcc\x88\xcc\x81"}, {945,"\xce\x91"}, {946,"\xce\x92"}, {947,"\xce\x93"}, {948,"\xce\x94"},
+{949,"\xce\x95"}, {950,"\xce\x96"}, {951,"\xce\x97"}, {952,"\xce\x98"}, {953,"\xce\x99"}, {954,"\xce\x9a"},
+{955,"\xce\x9b"}, {956,"\xce\x9c"}, {957,"\xce\x9d"}, {958,"\xce\x9e"}, {959,"\xce\x9f"}, {960,"\xce\xa0"},
+{961,"\xce\xa1"}, {962,"\xce\xa3"}, {963,"\xce\xa3"}, {964,"\xce\xa4"}, {965,"\xce\xa5"}, {966,"\xce\xa6"},
+{967,"\xce\xa7"}, {968,"\xce\xa8"}, {969,"\xce\xa9"}, {970,"\xce\xaa"}, {971,"\xce\xab"}, {972,"\xce\x8c"},
+{973,"\xce\x8e"}, {974,"\xce\x8f"}, {976,"\xce\x92"}, {977,"\xce\x98"}, {981,"\xce\xa6"}, {982,"\xce\xa0"},
+{983,"\xcf\x8f"}, {985,"\xcf\x98"}, {987,"\xcf\x9a"}, {989,"\xcf\x9c"}, {991,"\xcf\x9e"}, {993,"\xcf\xa0"},
+{995,"\xcf\xa2"}, {997,"\xcf\xa4"}, {999,"\xcf\xa6"}, {1001,"\xcf\xa8"}, {1003,"\xcf\xaa"}, {1005,"\xcf\xac"},
+{1007,"\xcf\xae"}, {1008,"\xce\x9a"}, {1009,"\xce\xa1"}, {1010,"\xcf\xb9"}, {1011,"\xcd\xbf"}, {1013,"\xce\x95"},
+{1016,"\xcf\xb7"}, {1019,"\xcf\xba"}, {1072,"\xd0\x90"}, {1073,"\xd0\x91"}, {1074,"\xd0\x92"}, {1075,"\xd0\x93"},
+{1076,"\xd0\x94"}, {1077,"\xd0\x95"}, {1078,"\xd0\x96"}, {1079,"\xd0\x97"}, {1080,"\xd0\x98"}, {1081,"\xd0\x99"},
+{1082,"\xd0\x9a"}, {1083,"\xd0\x9b"}, {1084,"\xd0\x9c"}, {1085,"\xd0\x9d"}, {1086,"\xd0\x9e"}, {1087,"\xd0\x9f"},
+{1088,"\xd0\xa0"}, {1089,"\xd0\xa1"}, {1090,"\xd0\xa2"}, {1091,"\xd0\xa3"}, {1092,"\xd0\xa4"}, {1093,"\xd0\xa5"},
+{1094,"\xd0\xa6"}, {1095,"\xd0\xa7"}, {1096,"\xd0\xa8"}, {1097,"\xd0\xa9"}, {1098,"\xd0\xaa"}, {1099,"\xd0\xab"},
+{1100,"\xd0\xac"}, {1101,"\xd0\xad"}, {1102,"\xd0\xae"}, {1103,"\xd0\xaf"}, {1104,"\xd0\x80"}, {1105,"\xd0\x81"},
+{1106,"\xd0\x82"}, {1107,"\xd0\x83"}, {1108,"\xd0\x84"}, {1109,"\xd0\x85"}, {1110,"\xd0\x86"}, {1111,"\xd0\x87"},
+{1112,"\xd0\x88"}, {1113,"\xd0\x89"}, {1114,"\xd0\x8a"}, {1115,"\xd0\x8b"}, {1116,"\xd0\x8c"}, {1117,"\xd0\x8d"},
+{1118,"\xd0\x8e"}, {1119,"\xd0\x8f"}, {1121,"\xd1\xa0"}, {1123,"\xd1\xa2"}, {1125,"\xd1\xa4"}, {1127,"\xd1\xa6"},
+{1129,"\xd1\xa8"}, {1131,"\xd1\xaa"}, {1133,"\xd1\xac"}, {1135,"\xd1\xae"}, {1137,"\xd1\xb0"}, {1139,"\xd1\xb2"},
+{1141,"\xd1\xb4"}, {1143,"\xd1\xb6"}, {1145,"\xd1\xb8"}, {1147,"\xd1\xba"}, {1149,"\xd1\xbc"}, {1151,"\xd1\xbe"},
+{1153,"\xd2\x80"}, {1163,"\xd2\x8a"}, {1165,"\xd2\x8c"}, {1167,"\xd2\x8e"}, {1169,"\xd2\x90"}, {1171,"\xd2\x92"},
+{1173,"\xd2\x94"}, {1175,"\xd2\x96"}, {1177,"\xd2\x98"}, {1179,"\xd2\x9a"}, {1181,"\xd2\x9c"}, {1183,"\xd2\x9e"},
+{1185,"\xd2\xa0"}, {1187,"\xd2\xa2"}, {1189,"\xd2\xa4"}, {1191,"\xd2\xa6"}, {1193,"\xd2\xa8"}, {1195,"\xd2\xaa"},
+{1197,"\xd2\xac"}, {1199,"\xd2\xae"}, {1201,"\xd2\xb0"}, {1203,"\xd2\xb2"}, {1205,"\xd2\xb4"}, {1207,"\xd2\xb6"},
+{1209,"\xd2\xb8"}, {1211,"\xd2\xba"}, {1213,"\xd2\xbc"}, {1215,"\xd2\xbe"}, {1218,"\xd3\x81"}, {1220,"\xd3\x83"},
+{1222,"\xd3\x85"}, {1224,"\xd3\x87"}, {1226,"\xd3\x89"}, {1228,"\xd3\x8b"}, {1230,"\xd3\x8d"}, {1231,"\xd3\x80"},
+{1233,"\xd3\x90"}, {1235,"\xd3\x92"}, {1237,"\xd3\x94"}, {1239,"\xd3\x96"}, {1241,"\xd3\x98"}, {1243,"\xd3\x9a"},
+{1245,"\xd3\x9c"}, {1247,"\xd3\x9e"}, {1249,"\xd3\xa0"}, {1251,"\xd3\xa2"}, {1253,"\xd3\xa4"}, {1255,"\xd3\xa6"},
+{1257,"\xd3\xa8"}, {1259,"\xd3\xaa"}, {1261,"\xd3\xac"}, {1263,"\xd3\xae"}, {1265,"\xd3\xb0"}, {1267,"\xd3\xb2"},
+{1269,"\xd3\xb4"}, {1271,"\xd3\xb6"}, {1273,"\xd3\xb8"}, {1275,"\xd3\xba"}, {1277,"\xd3\xbc"}, {1279,"\xd3\xbe"},
+{1281,"\xd4\x80"}, {1283,"\xd4\x82"}, {1285,"\xd4\x84"}, {1287,"\xd4\x86"}, {1289,"\xd4\x88"}, {1291,"\xd4\x8a"},
+{1293,"\xd4\x8c"}, {1295,"\xd4\x8e"}, {1297,"\xd4\x90"}, {1299,"\xd4\x92"}, {1301,"\xd4\x94"}, {1303,"\xd4\x96"},
+{1305,"\xd4\x98"}, {1307,"\xd4\x9a"}, {1309,"\xd4\x9c"}, {1311,"\xd4\x9e"}, {1313,"\xd4\xa0"}, {1315,"\xd4\xa2"},
+{1317,"\xd4\xa4"}, {1319,"\xd4\xa6"}, {1321,"\xd4\xa8"}, {1323,"\xd4\xaa"}, {1325,"\xd4\xac"}, {1327,"\xd4\xae"},
+{1377,"\xd4\xb1"}, {1378,"\xd4\xb2"}, {1379,"\xd4\xb3"}, {1380,"\xd4\xb4"}, {1381,"\xd4\xb5"}, {1382,"\xd4\xb6"},
+{1383,"\xd4\xb7"}, {1384,"\xd4\xb8"}, {1385,"\xd4\xb9"}, {1386,"\xd4\xba"}, {1387,"\xd4\xbb"}, {1388,"\xd4\xbc"},
+{1389,"\xd4\xbd"}, {1390,"\xd4\xbe"}, {1391,"\xd4\xbf"}, {1392,"\xd5\x80"}, {1393,"\xd5\x81"}, {1394,"\xd5\x82"},
+{1395,"\xd5\x83"}, {1396,"\xd5\x84"}, {1397,"\xd5\x85"}, {1398,"\xd5\x86"}, {1399,"\xd5\x87"}, {1400,"\xd5\x88"},
+{1401,"\xd5\x89"}, {1402,"\xd5\x8a"}, {1403,"\xd5\x8b"}, {1404,"\xd5\x8c"}, {1405,"\xd5\x8d"}, {1406,"\xd5\x8e"},
+{1407,"\xd5\x8f"}, {1408,"\xd5\x90"}, {1409,"\xd5\x91"}, {1410,"\xd5\x92"}, {1411,"\xd5\x93"}, {1412,"\xd5\x94"},
+{1413,"\xd5\x95"}, {1414,"\xd5\x96"}, {1415,"\xd4\xb5\xd5\x92"}, {4304,"\xe1\xb2\x90"}, {4305,"\xe1\xb2\x91"}, {4306,"\xe1\xb2\x92"},
+{4307,"\xe1\xb2\x93"}, {4308,"\xe1\xb2\x94"}, {4309,"\xe1\xb2\x95"}, {4310,"\xe1\xb2\x96"}, {4311,"\xe1\xb2\x97"}, {4312,"\xe1\xb2\x98"},
+{4313,"\xe1\xb2\x99"}, {4314,"\xe1\xb2\x9a"}, {4315,"\xe1\xb2\x9b"}, {4316,"\xe1\xb2\x9c"}, {4317,"\xe1\xb2\x9d"}, {4318,"\xe1\xb2\x9e"},
+{4319,"\xe1\xb2\x9f"}, {4320,"\xe1\xb2\xa0"}, {4321,"\xe1\xb2\xa1"}, {4322,"\xe1\xb2\xa2"}, {4323,"\xe1\xb2\xa3"}, {4324,"\xe1\xb2\xa4"},
+{4325,"\xe1\xb2\xa5"}, {4326,"\xe1\xb2\xa6"}, {4327,"\xe1\xb2\xa7"}, {4328,"\xe1\xb2\xa8"}, {4329,"\xe1\xb2\xa9"}, {4330,"\xe1\xb2\xaa"},
+{4331,"\xe1\xb2\xab"}, {4332,"\xe1\xb2\xac"}, {4333,"\xe1\xb2\xad"}, {4334,"\xe1\xb2\xae"}, {4335,"\xe1\xb2\xaf"}, {4336,"\xe1\xb2\xb0"},
+{4337,"\xe1\xb2\xb1"}, {4338,"\xe1\xb2\xb2"}, {4339,"\xe1\xb2\xb3"}, {4340,"\xe1\xb2\xb4"}, {4341,"\xe1\xb2\xb5"}, {4342,"\xe1\xb2\xb6"},
+{4343,"\xe1\xb2\xb7"}, {4344,"\xe1\xb2\xb8"}, {4345,"\xe1\xb2\xb9"}, {4346,"\xe1\xb2\xba"}, {4349,"\xe1\xb2\xbd"}, {4350,"\xe1\xb2\xbe"},
+{4351,"\xe1\xb2\xbf"}, {5112,"\xe1\x8f\xb0"}, {5113,"\xe1\x8f\xb1"}, {5114,"\xe1\x8f\xb2"}, {5115,"\xe1\x8f\xb3"}, {5116,"\xe1\x8f\xb4"},
+{5117,"\xe1\x8f\xb5"}, {7296,"\xd0\x92"}, {7297,"\xd0\x94"}, {7298,"\xd0\x9e"}, {7299,"\xd0\xa1"}, {7300,"\xd0\xa2"},
+{7301,"\xd0\xa2"}, {7302,"\xd0\xaa"}, {7303,"\xd1\xa2"}, {7304,"\xea\x99\x8a"}, {7545,"\xea\x9d\xbd"}, {7549,"\xe2\xb1\xa3"},
+{7566,"\xea\x9f\x86"}, {7681,"\xe1\xb8\x80"}, {7683,"\xe1\xb8\x82"}, {7685,"\xe1\xb8\x84"}, {7687,"\xe1\xb8\x86"}, {7689,"\xe1\xb8\x88"},
+{7691,"\xe1\xb8\x8a"}, {7693,"\xe1\xb8\x8c"}, {7695,"\xe1\xb8\x8e"}, {7697,"\xe1\xb8\x90"}, {7699,"\xe1\xb8\x92"}, {7701,"\xe1\xb8\x94"},
+{7703,"\xe1\xb8\x96"}, {7705,"\xe1\xb8\x98"}, {7707,"\xe1\xb8\x9a"}, {7709,"\xe1\xb8\x9c"}, {7711,"\xe1\xb8\x9e"}, {7713,"\xe1\xb8\xa0"},
+{7715,"\xe1\xb8\xa2"}, {7717,"\xe1\xb8\xa4"}, {7719,"\xe1\xb8\xa6"}, {7721,"\xe1\xb8\xa8"}, {7723,"\xe1\xb8\xaa"}, {7725,"\xe1\xb8\xac"},
+{7727,"\xe1\xb8\xae"}, {7729,"\xe1\xb8\xb0"}, {7731,"\xe1\xb8\xb2"}, {7733,"\xe1\xb8\xb4"}, {7735,"\xe1\xb8\xb6"}, {7737,"\xe1\xb8\xb8"},
+{7739,"\xe1\xb8\xba"}, {7741,"\xe1\xb8\xbc"}, {7743,"\xe1\xb8\xbe"}, {7745,"\xe1\xb9\x80"}, {7747,"\xe1\xb9\x82"}, {7749,"\xe1\xb9\x84"},
+{7751,"\xe1\xb9\x86"}, {7753,"\xe1\xb9\x88"}, {7755,"\xe1\xb9\x8a"}, {7757,"\xe1\xb9\x8c"}, {7759,"\xe1\xb9\x8e"}, {7761,"\xe1\xb9\x90"},
+{7763,"\xe1\xb9\x92"}, {7765,"\xe1\xb9\x94"}, {7767,"\xe1\xb9\x96"}, {7769,"\xe1\xb9\x98"}, {7771,"\xe1\xb9\x9a"}, {7773,"\xe1\xb9\x9c"},
+{7775,"\xe1\xb9\x9e"}, {7777,"\xe1\xb9\xa0"}, {7779,"\xe1\xb9\xa2"}, {7781,"\xe1\xb9\xa4"}, {7783,"\xe1\xb9\xa6"}, {7785,"\xe1\xb9\xa8"},
+{7787,"\xe1\xb9\xaa"}, {7789,"\xe1\xb9\xac"}, {7791,"\xe1\xb9\xae"}, {7793,"\xe1\xb9\xb0"}, {7795,"\xe1\xb9\xb2"}, {7797,"\xe1\xb9\xb4"},
+{7799,"\xe1\xb9\xb6"}, {7801,"\xe1\xb9\xb8"}, {7803,"\xe1\xb9\xba"}, {7805,"\xe1\xb9\xbc"}, {7807,"\xe1\xb9\xbe"}, {7809,"\xe1\xba\x80"},
+{7811,"\xe1\xba\x82"}, {7813,"\xe1\xba\x84"}, {7815,"\xe1\xba\x86"}, {7817,"\xe1\xba\x88"}, {7819,"\xe1\xba\x8a"}, {7821,"\xe1\xba\x8c"},
+{7823,"\xe1\xba\x8e"}, {7825,"\xe1\xba\x90"}, {7827,"\xe1\xba\x92"}, {7829,"\xe1\xba\x94"}, {7830,"H\xcc\xb1"}, {7831,"T\xcc\x88"},
+{7832,"W\xcc\x8a"}, {7833,"Y\xcc\x8a"}, {7834,"A\xca\xbe"}, {7835,"\xe1\xb9\xa0"}, {7841,"\xe1\xba\xa0"}, {7843,"\xe1\xba\xa2"},
+{7845,"\xe1\xba\xa4"}, {7847,"\xe1\xba\xa6"}, {7849,"\xe1\xba\xa8"}, {7851,"\xe1\xba\xaa"}, {7853,"\xe1\xba\xac"}, {7855,"\xe1\xba\xae"},
+{7857,"\xe1\xba\xb0"}, {7859,"\xe1\xba\xb2"}, {7861,"\xe1\xba\xb4"}, {7863,"\xe1\xba\xb6"}, {7865,"\xe1\xba\xb8"}, {7867,"\xe1\xba\xba"},
+{7869,"\xe1\xba\xbc"}, {7871,"\xe1\xba\xbe"}, {7873,"\xe1\xbb\x80"}, {7875,"\xe1\xbb\x82"}, {7877,"\xe1\xbb\x84"}, {7879,"\xe1\xbb\x86"},
+{7881,"\xe1\xbb\x88"}, {7883,"\xe1\xbb\x8a"}, {7885,"\xe1\xbb\x8c"}, {7887,"\xe1\xbb\x8e"}, {7889,"\xe1\xbb\x90"}, {7891,"\xe1\xbb\x92"},
+{7893,"\xe1\xbb\x94"}, {7895,"\xe1\xbb\x96"}, {7897,"\xe1\xbb\x98"}, {7899,"\xe1\xbb\x9a"}, {7901,"\xe1\xbb\x9c"}, {7903,"\xe1\xbb\x9e"},
+{7905,"\xe1\xbb\xa0"}, {7907,"\xe1\xbb\xa2"}, {7909,"\xe1\xbb\xa4"}, {7911,"\xe1\xbb\xa6"}, {7913,"\xe1\xbb\xa8"}, {7915,"\xe1\xbb\xaa"},
+{7917,"\xe1\xbb\xac"}, {7919,"\xe1\xbb\xae"}, {7921,"\xe1\xbb\xb0"}, {7923,"\xe1\xbb\xb2"}, {7925,"\xe1\xbb\xb4"}, {7927,"\xe1\xbb\xb6"},
+{7929,"\xe1\xbb\xb8"}, {7931,"\xe1\xbb\xba"}, {7933,"\xe1\xbb\xbc"}, {7935,"\xe1\xbb\xbe"}, {7936,"\xe1\xbc\x88"}, {7937,"\xe1\xbc\x89"},
+{7938,"\xe1\xbc\x8a"}, {7939,"\xe1\xbc\x8b"}, {7940,"\xe1\xbc\x8c"}, {7941,"\xe1\xbc\x8d"}, {7942,"\xe1\xbc\x8e"}, {7943,"\xe1\xbc\x8f"},
+{7952,"\xe1\xbc\x98"}, {7953,"\xe1\xbc\x99"}, {7954,"\xe1\xbc\x9a"}, {7955,"\xe1\xbc\x9b"}, {7956,"\xe1\xbc\x9c"}, {7957,"\xe1\xbc\x9d"},
+{7968,"\xe1\xbc\xa8"}, {7969,"\xe1\xbc\xa9"}, {7970,"\xe1\xbc\xaa"}, {7971,"\xe1\xbc\xab"}, {7972,"\xe1\xbc\xac"}, {7973,"\xe1\xbc\xad"},
+{7974,"\xe1\xbc\xae"}, {7975,"\xe1\xbc\xaf"}, {7984,"\xe1\xbc\xb8"}, {7985,"\xe1\xbc\xb9"}, {7986,"\xe1\xbc\xba"}, {7987,"\xe1\xbc\xbb"},
+{7988,"\xe1\xbc\xbc"}, {7989,"\xe1\xbc\xbd"}, {7990,"\xe1\xbc\xbe"}, {7991,"\xe1\xbc\xbf"}, {8000,"\xe1\xbd\x88"}, {8001,"\xe1\xbd\x89"},
+{8002,"\xe1\xbd\x8a"}, {8003,"\xe1\xbd\x8b"}, {8004,"\xe1\xbd\x8c"}, {8005,"\xe1\xbd\x8d"}, {8016,"\xce\xa5\xcc\x93"}, {8017,"\xe1\xbd\x99"},
+{8018,"\xce\xa5\xcc\x93\xcc\x80"}, {8019,"\xe1\xbd\x9b"}, {8020,"\xce\xa5\xcc\x93\xcc\x81"}, {8021,"\xe1\xbd\x9d"}, {8022,"\xce\xa5\xcc\x93\xcd\x82"}, {8023,"\xe1\xbd\x9f"},
+{8032,"\xe1\xbd\xa8"}, {8033,"\xe1\xbd\xa9"}, {8034,"\xe1\xbd\xaa"}, {8035,"\xe1\xbd\xab"}, {8036,"\xe1\xbd\xac"}, {8037,"\xe1\xbd\xad"},
+{8038,"\xe1\xbd\xae"}, {8039,"\xe1\xbd\xaf"}, {8048,"\xe1\xbe\xba"}, {8049,"\xe1\xbe\xbb"}, {8050,"\xe1\xbf\x88"}, {8051,"\xe1\xbf\x89"},
+{8052,"\xe1\xbf\x8a"}, {8053,"\xe1\xbf\x8b"}, {8054,"\xe1\xbf\x9a"}, {8055,"\xe1\xbf\x9b"}, {8056,"\xe1\xbf\xb8"}, {8057,"\xe1\xbf\xb9"},
+{8058,"\xe1\xbf\xaa"}, {8059,"\xe1\xbf\xab"}, {8060,"\xe1\xbf\xba"}, {8061,"\xe1\xbf\xbb"}, {8064,"\xe1\xbc\x88\xce\x99"}, {8065,"\xe1\xbc\x89\xce\x99"},
+{8066,"\xe1\xbc\x8a\xce\x99"}, {8067,"\xe1\xbc\x8b\xce\x99"}, {8068,"\xe1\xbc\x8c\xce\x99"}, {8069,"\xe1\xbc\x8d\xce\x99"}, {8070,"\xe1\xbc\x8e\xce\x99"}, {8071,"\xe1\xbc\x8f\xce\x99"},
+{8072,"\xe1\xbc\x88\xce\x99"}, {8073,"\xe1\xbc\x89\xce\x99"}, {8074,"\xe1\xbc\x8a\xce\x99"}, {8075,"\xe1\xbc\x8b\xce\x99"}, {8076,"\xe1\xbc\x8c\xce\x99"}, {8077,"\xe1\xbc\x8d\xce\x99"},
+{8078,"\xe1\xbc\x8e\xce\x99"}, {8079,"\xe1\xbc\x8f\xce\x99"}, {8080,"\xe1\xbc\xa8\xce\x99"}, {8081,"\xe1\xbc\xa9\xce\x99"}, {8082,"\xe1\xbc\xaa\xce\x99"}, {8083,"\xe1\xbc\xab\xce\x99"},
+{8084,"\xe1\xbc\xac\xce\x99"}, {8085,"\xe1\xbc\xad\xce\x99"}, {8086,"\xe1\xbc\xae\xce\x99"}, {8087,"\xe1\xbc\xaf\xce\x99"}, {8088,"\xe1\xbc\xa8\xce\x99"}, {8089,"\xe1\xbc\xa9\xce\x99"},
+{8090,"\xe1\xbc\xaa\xce\x99"}, {8091,"\xe1\xbc\xab\xce\x99"}, {8092,"\xe1\xbc\xac\xce\x99"}, {8093,"\xe1\xbc\xad\xce\x99"}, {8094,"\xe1\xbc\xae\xce\x99"}, {8095,"\xe1\xbc\xaf\xce\x99"},
+{8096,"\xe1\xbd\xa8\xce\x99"}, {8097,"\xe1\xbd\xa9\xce\x99"}, {8098,"\xe1\xbd\xaa\xce\x99"}, {8099,"\xe1\xbd\xab\xce\x99"}, {8100,"\xe1\xbd\xac\xce\x99"}, {8101,"\xe1\xbd\xad\xce\x99"},
+{8102,"\xe1\xbd\xae\xce\x99"}, {8103,"\xe1\xbd\xaf\xce\x99"}, {8104,"\xe1\xbd\xa8\xce\x99"}, {8105,"\xe1\xbd\xa9\xce\x99"}, {8106,"\xe1\xbd\xaa\xce\x99"}, {8107,"\xe1\xbd\xab\xce\x99"},
+{8108,"\xe1\xbd\xac\xce\x99"}, {8109,"\xe1\xbd\xad\xce\x99"}, {8110,"\xe1\xbd\xae\xce\x99"}, {8111,"\xe1\xbd\xaf\xce\x99"}, {8112,"\xe1\xbe\xb8"}, {8113,"\xe1\xbe\xb9"},
+{8114,"\xe1\xbe\xba\xce\x99"}, {8115,"\xce\x91\xce\x99"}, {8116,"\xce\x86\xce\x99"}, {8118,"\xce\x91\xcd\x82"}, {8119,"\xce\x91\xcd\x82\xce\x99"}, {8124,"\xce\x91\xce\x99"},
+{8126,"\xce\x99"}, {8130,"\xe1\xbf\x8a\xce\x99"}, {8131,"\xce\x97\xce\x99"}, {8132,"\xce\x89\xce\x99"}, {8134,"\xce\x97\xcd\x82"}, {8135,"\xce\x97\xcd\x82\xce\x99"},
+{8140,"\xce\x97\xce\x99"}, {8144,"\xe1\xbf\x98"}, {8145,"\xe1\xbf\x99"}, {8146,"\xce\x99\xcc\x88\xcc\x80"}, {8147,"\xce\x99\xcc\x88\xcc\x81"}, {8150,"\xce\x99\xcd\x82"},
+{8151,"\xce\x99\xcc\x88\xcd\x82"}, {8160,"\xe1\xbf\xa8"}, {8161,"\xe1\xbf\xa9"}, {8162,"\xce\xa5\xcc\x88\xcc\x80"}, {8163,"\xce\xa5\xcc\x88\xcc\x81"}, {8164,"\xce\xa1\xcc\x93"},
+{8165,"\xe1\xbf\xac"}, {8166,"\xce\xa5\xcd\x82"}, {8167,"\xce\xa5\xcc\x88\xcd\x82"}, {8178,"\xe1\xbf\xba\xce\x99"}, {8179,"\xce\xa9\xce\x99"}, {8180,"\xce\x8f\xce\x99"},
+{8182,"\xce\xa9\xcd\x82"}, {8183,"\xce\xa9\xcd\x82\xce\x99"}, {8188,"\xce\xa9\xce\x99"}, {8526,"\xe2\x84\xb2"}, {8560,"\xe2\x85\xa0"}, {8561,"\xe2\x85\xa1"},
+{8562,"\xe2\x85\xa2"}, {8563,"\xe2\x85\xa3"}, {8564,"\xe2\x85\xa4"}, {8565,"\xe2\x85\xa5"}, {8566,"\xe2\x85\xa6"}, {8567,"\xe2\x85\xa7"},
+{8568,"\xe2\x85\xa8"}, {8569,"\xe2\x85\xa9"}, {8570,"\xe2\x85\xaa"}, {8571,"\xe2\x85\xab"}, {8572,"\xe2\x85\xac"}, {8573,"\xe2\x85\xad"},
+{8574,"\xe2\x85\xae"}, {8575,"\xe2\x85\xaf"}, {8580,"\xe2\x86\x83"}, {9424,"\xe2\x92\xb6"}, {9425,"\xe2\x92\xb7"}, {9426,"\xe2\x92\xb8"},
+{9427,"\xe2\x92\xb9"}, {9428,"\xe2\x92\xba"}, {9429,"\xe2\x92\xbb"}, {9430,"\xe2\x92\xbc"}, {9431,"\xe2\x92\xbd"}, {9432,"\xe2\x92\xbe"},
+{9433,"\xe2\x92\xbf"}, {9434,"\xe2\x93\x80"}, {9435,"\xe2\x93\x81"}, {9436,"\xe2\x93\x82"}, {9437,"\xe2\x93\x83"}, {9438,"\xe2\x93\x84"},
+{9439,"\xe2\x93\x85"}, {9440,"\xe2\x93\x86"}, {9441,"\xe2\x93\x87"}, {9442,"\xe2\x93\x88"}, {9443,"\xe2\x93\x89"}, {9444,"\xe2\x93\x8a"},
+{9445,"\xe2\x93\x8b"}, {9446,"\xe2\x93\x8c"}, {9447,"\xe2\x93\x8d"}, {9448,"\xe2\x93\x8e"}, {9449,"\xe2\x93\x8f"}, {11312,"\xe2\xb0\x80"},
+{11313,"\xe2\xb0\x81"}, {11314,"\xe2\xb0\x82"}, {11315,"\xe2\xb0\x83"}, {11316,"\xe2\xb0\x84"}, {11317,"\xe2\xb0\x85"}, {11318,"\xe2\xb0\x86"},
+{11319,"\xe2\xb0\x87"}, {11320,"\xe2\xb0\x88"}, {11321,"\xe2\xb0\x89"}, {11322,"\xe2\xb0\x8a"}, {11323,"\xe2\xb0\x8b"}, {11324,"\xe2\xb0\x8c"},
+{11325,"\xe2\xb0\x8d"}, {11326,"\xe2\xb0\x8e"}, {11327,"\xe2\xb0\x8f"}, {11328,"\xe2\xb0\x90"}, {11329,"\xe2\xb0\x91"}, {11330,"\xe2\xb0\x92"},
+{11331,"\xe2\xb0\x93"}, {11332,"\xe2\xb0\x94"}, {11333,"\xe2\xb0\x95"}, {11334,"\xe2\xb0\x96"}, {11335,"\xe2\xb0\x97"}, {11336,"\xe2\xb0\x98"},
+{11337,"\xe2\xb0\x99"}, {11338,"\xe2\xb0\x9a"}, {11339,"\xe2\xb0\x9b"}, {11340,"\xe2\xb0\x9c"}, {11341,"\xe2\xb0\x9d"}, {11342,"\xe2\xb0\x9e"},
+{11343,"\xe2\xb0\x9f"}, {11344,"\xe2\xb0\xa0"}, {11345,"\xe2\xb0\xa1"}, {11346,"\xe2\xb0\xa2"}, {11347,"\xe2\xb0\xa3"}, {11348,"\xe2\xb0\xa4"},
+{11349,"\xe2\xb0\xa5"}, {11350,"\xe2\xb0\xa6"}, {11351,"\xe2\xb0\xa7"}, {11352,"\xe2\xb0\xa8"}, {11353,"\xe2\xb0\xa9"}, {11354,"\xe2\xb0\xaa"},
+{11355,"\xe2\xb0\xab"}, {11356,"\xe2\xb0\xac"}, {11357,"\xe2\xb0\xad"}, {11358,"\xe2\xb0\xae"}, {11359,"\xe2\xb0\xaf"}, {11361,"\xe2\xb1\xa0"},
+{11365,"\xc8\xba"}, {11366,"\xc8\xbe"}, {11368,"\xe2\xb1\xa7"}, {11370,"\xe2\xb1\xa9"}, {11372,"\xe2\xb1\xab"}, {11379,"\xe2\xb1\xb2"},
+{11382,"\xe2\xb1\xb5"}, {11393,"\xe2\xb2\x80"}, {11395,"\xe2\xb2\x82"}, {11397,"\xe2\xb2\x84"}, {11399,"\xe2\xb2\x86"}, {11401,"\xe2\xb2\x88"},
+{11403,"\xe2\xb2\x8a"}, {11405,"\xe2\xb2\x8c"}, {11407,"\xe2\xb2\x8e"}, {11409,"\xe2\xb2\x90"}, {11411,"\xe2\xb2\x92"}, {11413,"\xe2\xb2\x94"},
+{11415,"\xe2\xb2\x96"}, {11417,"\xe2\xb2\x98"}, {11419,"\xe2\xb2\x9a"}, {11421,"\xe2\xb2\x9c"}, {11423,"\xe2\xb2\x9e"}, {11425,"\xe2\xb2\xa0"},
+{11427,"\xe2\xb2\xa2"}, {11429,"\xe2\xb2\xa4"}, {11431,"\xe2\xb2\xa6"}, {11433,"\xe2\xb2\xa8"}, {11435,"\xe2\xb2\xaa"}, {11437,"\xe2\xb2\xac"},
+{11439,"\xe2\xb2\xae"}, {11441,"\xe2\xb2\xb0"}, {11443,"\xe2\xb2\xb2"}, {11445,"\xe2\xb2\xb4"}, {11447,"\xe2\xb2\xb6"}, {11449,"\xe2\xb2\xb8"},
+{11451,"\xe2\xb2\xba"}, {11453,"\xe2\xb2\xbc"}, {11455,"\xe2\xb2\xbe"}, {11457,"\xe2\xb3\x80"}, {11459,"\xe2\xb3\x82"}, {11461,"\xe2\xb3\x84"},
+{11463,"\xe2\xb3\x86"}, {11465,"\xe2\xb3\x88"}, {11467,"\xe2\xb3\x8a"}, {11469,"\xe2\xb3\x8c"}, {11471,"\xe2\xb3\x8e"}, {11473,"\xe2\xb3\x90"},
+{11475,"\xe2\xb3\x92"}, {11477,"\xe2\xb3\x94"}, {11479,"\xe2\xb3\x96"}, {11481,"\xe2\xb3\x98"}, {11483,"\xe2\xb3\x9a"}, {11485,"\xe2\xb3\x9c"},
+{11487,"\xe2\xb3\x9e"}, {11489,"\xe2\xb3\xa0"}, {11491,"\xe2\xb3\xa2"}, {11500,"\xe2\xb3\xab"}, {11502,"\xe2\xb3\xad"}, {11507,"\xe2\xb3\xb2"},
+{11520,"\xe1\x82\xa0"}, {11521,"\xe1\x82\xa1"}, {11522,"\xe1\x82\xa2"}, {11523,"\xe1\x82\xa3"}, {11524,"\xe1\x82\xa4"}, {11525,"\xe1\x82\xa5"},
+{11526,"\xe1\x82\xa6"}, {11527,"\xe1\x82\xa7"}, {11528,"\xe1\x82\xa8"}, {11529,"\xe1\x82\xa9"}, {11530,"\xe1\x82\xaa"}, {11531,"\xe1\x82\xab"},
+{11532,"\xe1\x82\xac"}, {11533,"\xe1\x82\xad"}, {11534,"\xe1\x82\xae"}, {11535,"\xe1\x82\xaf"}, {11536,"\xe1\x82\xb0"}, {11537,"\xe1\x82\xb1"},
+{11538,"\xe1\x82\xb2"}, {11539,"\xe1\x82\xb3"}, {11540,"\xe1\x82\xb4"}, {11541,"\xe1\x82\xb5"}, {11542,"\xe1\x82\xb6"}, {11543,"\xe1\x82\xb7"},
+{11544,"\xe1\x82\xb8"}, {11545,"\xe1\x82\xb9"}, {11546,"\xe1\x82\xba"}, {11547,"\xe1\x82\xbb"}, {11548,"\xe1\x82\xbc"}, {11549,"\xe1\x82\xbd"},
+{11550,"\xe1\x82\xbe"}, {11551,"\xe1\x82\xbf"}, {11552,"\xe1\x83\x80"}, {11553,"\xe1\x83\x81"}, {11554,"\xe1\x83\x82"}, {11555,"\xe1\x83\x83"},
+{11556,"\xe1\x83\x84"}, {11557,"\xe1\x83\x85"}, {11559,"\xe1\x83\x87"}, {11565,"\xe1\x83\x8d"}, {42561,"\xea\x99\x80"}, {42563,"\xea\x99\x82"},
+{42565,"\xea\x99\x84"}, {42567,"\xea\x99\x86"}, {42569,"\xea\x99\x88"}, {42571,"\xea\x99\x8a"}, {42573,"\xea\x99\x8c"}, {42575,"\xea\x99\x8e"},
+{42577,"\xea\x99\x90"}, {42579,"\xea\x99\x92"}, {42581,"\xea\x99\x94"}, {42583,"\xea\x99\x96"}, {42585,"\xea\x99\x98"}, {42587,"\xea\x99\x9a"},
+{42589,"\xea\x99\x9c"}, {42591,"\xea\x99\x9e"}, {42593,"\xea\x99\xa0"}, {42595,"\xea\x99\xa2"}, {42597,"\xea\x99\xa4"}, {42599,"\xea\x99\xa6"},
+{42601,"\xea\x99\xa8"}, {42603,"\xea\x99\xaa"}, {42605,"\xea\x99\xac"}, {42625,"\xea\x9a\x80"}, {42627,"\xea\x9a\x82"}, {42629,"\xea\x9a\x84"},
+{42631,"\xea\x9a\x86"}, {42633,"\xea\x9a\x88"}, {42635,"\xea\x9a\x8a"}, {42637,"\xea\x9a\x8c"}, {42639,"\xea\x9a\x8e"}, {42641,"\xea\x9a\x90"},
+{42643,"\xea\x9a\x92"}, {42645,"\xea\x9a\x94"}, {42647,"\xea\x9a\x96"}, {42649,"\xea\x9a\x98"}, {42651,"\xea\x9a\x9a"}, {42787,"\xea\x9c\xa2"},
+{42789,"\xea\x9c\xa4"}, {42791,"\xea\x9c\xa6"}, {42793,"\xea\x9c\xa8"}, {42795,"\xea\x9c\xaa"}, {42797,"\xea\x9c\xac"}, {42799,"\xea\x9c\xae"},
+{42803,"\xea\x9c\xb2"}, {42805,"\xea\x9c\xb4"}, {42807,"\xea\x9c\xb6"}, {42809,"\xea\x9c\xb8"}, {42811,"\xea\x9c\xba"}, {42813,"\xea\x9c\xbc"},
+{42815,"\xea\x9c\xbe"}, {42817,"\xea\x9d\x80"}, {42819,"\xea\x9d\x82"}, {42821,"\xea\x9d\x84"}, {42823,"\xea\x9d\x86"}, {42825,"\xea\x9d\x88"},
+{42827,"\xea\x9d\x8a"}, {42829,"\xea\x9d\x8c"}, {42831,"\xea\x9d\x8e"}, {42833,"\xea\x9d\x90"}, {42835,"\xea\x9d\x92"}, {42837,"\xea\x9d\x94"},
+{42839,"\xea\x9d\x96"}, {42841,"\xea\x9d\x98"}, {42843,"\xea\x9d\x9a"}, {42845,"\xea\x9d\x9c"}, {42847,"\xea\x9d\x9e"}, {42849,"\xea\x9d\xa0"},
+{42851,"\xea\x9d\xa2"}, {42853,"\xea\x9d\xa4"}, {42855,"\xea\x9d\xa6"}, {42857,"\xea\x9d\xa8"}, {42859,"\xea\x9d\xaa"}, {42861,"\xea\x9d\xac"},
+{42863,"\xea\x9d\xae"}, {42874,"\xea\x9d\xb9"}, {42876,"\xea\x9d\xbb"}, {42879,"\xea\x9d\xbe"}, {42881,"\xea\x9e\x80"}, {42883,"\xea\x9e\x82"},
+{42885,"\xea\x9e\x84"}, {42887,"\xea\x9e\x86"}, {42892,"\xea\x9e\x8b"}, {42897,"\xea\x9e\x90"}, {42899,"\xea\x9e\x92"}, {42900,"\xea\x9f\x84"},
+{42903,"\xea\x9e\x96"}, {42905,"\xea\x9e\x98"}, {42907,"\xea\x9e\x9a"}, {42909,"\xea\x9e\x9c"}, {42911,"\xea\x9e\x9e"}, {42913,"\xea\x9e\xa0"},
+{42915,"\xea\x9e\xa2"}, {42917,"\xea\x9e\xa4"}, {42919,"\xea\x9e\xa6"}, {42921,"\xea\x9e\xa8"}, {42933,"\xea\x9e\xb4"}, {42935,"\xea\x9e\xb6"},
+{42937,"\xea\x9e\xb8"}, {42939,"\xea\x9e\xba"}, {42941,"\xea\x9e\xbc"}, {42943,"\xea\x9e\xbe"}, {42945,"\xea\x9f\x80"}, {42947,"\xea\x9f\x82"},
+{42952,"\xea\x9f\x87"}, {42954,"\xea\x9f\x89"}, {42961,"\xea\x9f\x90"}, {42967,"\xea\x9f\x96"}, {42969,"\xea\x9f\x98"}, {42998,"\xea\x9f\xb5"},
+{43859,"\xea\x9e\xb3"}, {43888,"\xe1\x8e\xa0"}, {43889,"\xe1\x8e\xa1"}, {43890,"\xe1\x8e\xa2"}, {43891,"\xe1\x8e\xa3"}, {43892,"\xe1\x8e\xa4"},
+{43893,"\xe1\x8e\xa5"}, {43894,"\xe1\x8e\xa6"}, {43895,"\xe1\x8e\xa7"}, {43896,"\xe1\x8e\xa8"}, {43897,"\xe1\x8e\xa9"}, {43898,"\xe1\x8e\xaa"},
+{43899,"\xe1\x8e\xab"}, {43900,"\xe1\x8e\xac"}, {43901,"\xe1\x8e\xad"}, {43902,"\xe1\x8e\xae"}, {43903,"\xe1\x8e\xaf"}, {43904,"\xe1\x8e\xb0"},
+{43905,"\xe1\x8e\xb1"}, {43906,"\xe1\x8e\xb2"}, {43907,"\xe1\x8e\xb3"}, {43908,"\xe1\x8e\xb4"}, {43909,"\xe1\x8e\xb5"}, {43910,"\xe1\x8e\xb6"},
+{43911,"\xe1\x8e\xb7"}, {43912,"\xe1\x8e\xb8"}, {43913,"\xe1\x8e\xb9"}, {43914,"\xe1\x8e\xba"}, {43915,"\xe1\x8e\xbb"}, {43916,"\xe1\x8e\xbc"},
+{43917,"\xe1\x8e\xbd"}, {43918,"\xe1\x8e\xbe"}, {43919,"\xe1\x8e\xbf"}, {43920,"\xe1\x8f\x80"}, {43921,"\xe1\x8f\x81"}, {43922,"\xe1\x8f\x82"},
+{43923,"\xe1\x8f\x83"}, {43924,"\xe1\x8f\x84"}, {43925,"\xe1\x8f\x85"}, {43926,"\xe1\x8f\x86"}, {43927,"\xe1\x8f\x87"}, {43928,"\xe1\x8f\x88"},
+{43929,"\xe1\x8f\x89"}, {43930,"\xe1\x8f\x8a"}, {43931,"\xe1\x8f\x8b"}, {43932,"\xe1\x8f\x8c"}, {43933,"\xe1\x8f\x8d"}, {43934,"\xe1\x8f\x8e"},
+{43935,"\xe1\x8f\x8f"}, {43936,"\xe1\x8f\x90"}, {43937,"\xe1\x8f\x91"}, {43938,"\xe1\x8f\x92"}, {43939,"\xe1\x8f\x93"}, {43940,"\xe1\x8f\x94"},
+{43941,"\xe1\x8f\x95"}, {43942,"\xe1\x8f\x96"}, {43943,"\xe1\x8f\x97"}, {43944,"\xe1\x8f\x98"}, {43945,"\xe1\x8f\x99"}, {43946,"\xe1\x8f\x9a"},
+{43947,"\xe1\x8f\x9b"}, {43948,"\xe1\x8f\x9c"}, {43949,"\xe1\x8f\x9d"}, {43950,"\xe1\x8f\x9e"}, {43951,"\xe1\x8f\x9f"}, {43952,"\xe1\x8f\xa0"},
+{43953,"\xe1\x8f\xa1"}, {43954,"\xe1\x8f\xa2"}, {43955,"\xe1\x8f\xa3"}, {43956,"\xe1\x8f\xa4"}, {43957,"\xe1\x8f\xa5"}, {43958,"\xe1\x8f\xa6"},
+{43959,"\xe1\x8f\xa7"}, {43960,"\xe1\x8f\xa8"}, {43961,"\xe1\x8f\xa9"}, {43962,"\xe1\x8f\xaa"}, {43963,"\xe1\x8f\xab"}, {43964,"\xe1\x8f\xac"},
+{43965,"\xe1\x8f\xad"}, {43966,"\xe1\x8f\xae"}, {43967,"\xe1\x8f\xaf"}, {64256,"FF"}, {64257,"FI"}, {64258,"FL"},
+{64259,"FFI"}, {64260,"FFL"}, {64261,"ST"}, {64262,"ST"}, {64275,"\xd5\x84\xd5\x86"}, {64276,"\xd5\x84\xd4\xb5"},
+{64277,"\xd5\x84\xd4\xbb"}, {64278,"\xd5\x8e\xd5\x86"}, {64279,"\xd5\x84\xd4\xbd"}, {65345,"\xef\xbc\xa1"}, {65346,"\xef\xbc\xa2"}, {65347,"\xef\xbc\xa3"},
+{65348,"\xef\xbc\xa4"}, {65349,"\xef\xbc\xa5"}, {65350,"\xef\xbc\xa6"}, {65351,"\xef\xbc\xa7"}, {65352,"\xef\xbc\xa8"}, {65353,"\xef\xbc\xa9"},
+{65354,"\xef\xbc\xaa"}, {65355,"\xef\xbc\xab"}, {65356,"\xef\xbc\xac"}, {65357,"\xef\xbc\xad"}, {65358,"\xef\xbc\xae"}, {65359,"\xef\xbc\xaf"},
+{65360,"\xef\xbc\xb0"}, {65361,"\xef\xbc\xb1"}, {65362,"\xef\xbc\xb2"}, {65363,"\xef\xbc\xb3"}, {65364,"\xef\xbc\xb4"}, {65365,"\xef\xbc\xb5"},
+{65366,"\xef\xbc\xb6"}, {65367,"\xef\xbc\xb7"}, {65368,"\xef\xbc\xb8"}, {65369,"\xef\xbc\xb9"}, {65370,"\xef\xbc\xba"}, {66600,"\xf0\x90\x90\x80"},
+{66601,"\xf0\x90\x90\x81"}, {66602,"\xf0\x90\x90\x82"}, {66603,"\xf0\x90\x90\x83"}, {66604,"\xf0\x90\x90\x84"}, {66605,"\xf0\x90\x90\x85"}, {66606,"\xf0\x90\x90\x86"},
+{66607,"\xf0\x90\x90\x87"}, {66608,"\xf0\x90\x90\x88"}, {66609,"\xf0\x90\x90\x89"}, {66610,"\xf0\x90\x90\x8a"}, {66611,"\xf0\x90\x90\x8b"}, {66612,"\xf0\x90\x90\x8c"},
+{66613,"\xf0\x90\x90\x8d"}, {66614,"\xf0\x90\x90\x8e"}, {66615,"\xf0\x90\x90\x8f"}, {66616,"\xf0\x90\x90\x90"}, {66617,"\xf0\x90\x90\x91"}, {66618,"\xf0\x90\x90\x92"},
+{66619,"\xf0\x90\x90\x93"}, {66620,"\xf0\x90\x90\x94"}, {66621,"\xf0\x90\x90\x95"}, {66622,"\xf0\x90\x90\x96"}, {66623,"\xf0\x90\x90\x97"}, {66624,"\xf0\x90\x90\x98"},
+{66625,"\xf0\x90\x90\x99"}, {66626,"\xf0\x90\x90\x9a"}, {66627,"\xf0\x90\x90\x9b"}, {66628,"\xf0\x90\x90\x9c"}, {66629,"\xf0\x90\x90\x9d"}, {66630,"\xf0\x90\x90\x9e"},
+{66631,"\xf0\x90\x90\x9f"}, {66632,"\xf0\x90\x90\xa0"}, {66633,"\xf0\x90\x90\xa1"}, {66634,"\xf0\x90\x90\xa2"}, {66635,"\xf0\x90\x90\xa3"}, {66636,"\xf0\x90\x90\xa4"},
+{66637,"\xf0\x90\x90\xa5"}, {66638,"\xf0\x90\x90\xa6"}, {66639,"\xf0\x90\x90\xa7"}, {66776,"\xf0\x90\x92\xb0"}, {66777,"\xf0\x90\x92\xb1"}, {66778,"\xf0\x90\x92\xb2"},
+{66779,"\xf0\x90\x92\xb3"}, {66780,"\xf0\x90\x92\xb4"}, {66781,"\xf0\x90\x92\xb5"}, {66782,"\xf0\x90\x92\xb6"}, {66783,"\xf0\x90\x92\xb7"}, {66784,"\xf0\x90\x92\xb8"},
+{66785,"\xf0\x90\x92\xb9"}, {66786,"\xf0\x90\x92\xba"}, {66787,"\xf0\x90\x92\xbb"}, {66788,"\xf0\x90\x92\xbc"}, {66789,"\xf0\x90\x92\xbd"}, {66790,"\xf0\x90\x92\xbe"},
+{66791,"\xf0\x90\x92\xbf"}, {66792,"\xf0\x90\x93\x80"}, {66793,"\xf0\x90\x93\x81"}, {66794,"\xf0\x90\x93\x82"}, {66795,"\xf0\x90\x93\x83"}, {66796,"\xf0\x90\x93\x84"},
+{66797,"\xf0\x90\x93\x85"}, {66798,"\xf0\x90\x93\x86"}, {66799,"\xf0\x90\x93\x87"}, {66800,"\xf0\x90\x93\x88"}, {66801,"\xf0\x90\x93\x89"}, {66802,"\xf0\x90\x93\x8a"},
+{66803,"\xf0\x90\x93\x8b"}, {66804,"\xf0\x90\x93\x8c"}, {66805,"\xf0\x90\x93\x8d"}, {66806,"\xf0\x90\x93\x8e"}, {66807,"\xf0\x90\x93\x8f"}, {66808,"\xf0\x90\x93\x90"},
+{66809,"\xf0\x90\x93\x91"}, {66810,"\xf0\x90\x93\x92"}, {66811,"\xf0\x90\x93\x93"}, {66967,"\xf0\x90\x95\xb0"}, {66968,"\xf0\x90\x95\xb1"}, {66969,"\xf0\x90\x95\xb2"},
+{66970,"\xf0\x90\x95\xb3"}, {66971,"\xf0\x90\x95\xb4"}, {66972,"\xf0\x90\x95\xb5"}, {66973,"\xf0\x90\x95\xb6"}, {66974,"\xf0\x90\x95\xb7"}, {66975,"\xf0\x90\x95\xb8"},
+{66976,"\xf0\x90\x95\xb9"}, {66977,"\xf0\x90\x95\xba"}, {66979,"\xf0\x90\x95\xbc"}, {66980,"\xf0\x90\x95\xbd"}, {66981,"\xf0\x90\x95\xbe"}, {66982,"\xf0\x90\x95\xbf"},
+{66983,"\xf0\x90\x96\x80"}, {66984,"\xf0\x90\x96\x81"}, {66985,"\xf0\x90\x96\x82"}, {66986,"\xf0\x90\x96\x83"}, {66987,"\xf0\x90\x96\x84"}, {66988,"\xf0\x90\x96\x85"},
+{66989,"\xf0\x90\x96\x86"}, {66990,"\xf0\x90\x96\x87"}, {66991,"\xf0\x90\x96\x88"}, {66992,"\xf0\x90\x96\x89"}, {66993,"\xf0\x90\x96\x8a"}, {66995,"\xf0\x90\x96\x8c"},
+{66996,"\xf0\x90\x96\x8d"}, {66997,"\xf0\x90\x96\x8e"}, {66998,"\xf0\x90\x96\x8f"}, {66999,"\xf0\x90\x96\x90"}, {67000,"\xf0\x90\x96\x91"}, {67001,"\xf0\x90\x96\x92"},
+{67003,"\xf0\x90\x96\x94"}, {67004,"\xf0\x90\x96\x95"}, {68800,"\xf0\x90\xb2\x80"}, {68801,"\xf0\x90\xb2\x81"}, {68802,"\xf0\x90\xb2\x82"}, {68803,"\xf0\x90\xb2\x83"},
+{68804,"\xf0\x90\xb2\x84"}, {68805,"\xf0\x90\xb2\x85"}, {68806,"\xf0\x90\xb2\x86"}, {68807,"\xf0\x90\xb2\x87"}, {68808,"\xf0\x90\xb2\x88"}, {68809,"\xf0\x90\xb2\x89"},
+{68810,"\xf0\x90\xb2\x8a"}, {68811,"\xf0\x90\xb2\x8b"}, {68812,"\xf0\x90\xb2\x8c"}, {68813,"\xf0\x90\xb2\x8d"}, {68814,"\xf0\x90\xb2\x8e"}, {68815,"\xf0\x90\xb2\x8f"},
+{68816,"\xf0\x90\xb2\x90"}, {68817,"\xf0\x90\xb2\x91"}, {68818,"\xf0\x90\xb2\x92"}, {68819,"\xf0\x90\xb2\x93"}, {68820,"\xf0\x90\xb2\x94"}, {68821,"\xf0\x90\xb2\x95"},
+{68822,"\xf0\x90\xb2\x96"}, {68823,"\xf0\x90\xb2\x97"}, {68824,"\xf0\x90\xb2\x98"}, {68825,"\xf0\x90\xb2\x99"}, {68826,"\xf0\x90\xb2\x9a"}, {68827,"\xf0\x90\xb2\x9b"},
+{68828,"\xf0\x90\xb2\x9c"}, {68829,"\xf0\x90\xb2\x9d"}, {68830,"\xf0\x90\xb2\x9e"}, {68831,"\xf0\x90\xb2\x9f"}, {68832,"\xf0\x90\xb2\xa0"}, {68833,"\xf0\x90\xb2\xa1"},
+{68834,"\xf0\x90\xb2\xa2"}, {68835,"\xf0\x90\xb2\xa3"}, {68836,"\xf0\x90\xb2\xa4"}, {68837,"\xf0\x90\xb2\xa5"}, {68838,"\xf0\x90\xb2\xa6"}, {68839,"\xf0\x90\xb2\xa7"},
+{68840,"\xf0\x90\xb2\xa8"}, {68841,"\xf0\x90\xb2\xa9"}, {68842,"\xf0\x90\xb2\xaa"}, {68843,"\xf0\x90\xb2\xab"}, {68844,"\xf0\x90\xb2\xac"}, {68845,"\xf0\x90\xb2\xad"},
+{68846,"\xf0\x90\xb2\xae"}, {68847,"\xf0\x90\xb2\xaf"}, {68848,"\xf0\x90\xb2\xb0"}, {68849,"\xf0\x90\xb2\xb1"}, {68850,"\xf0\x90\xb2\xb2"}, {71872,"\xf0\x91\xa2\xa0"},
+{71873,"\xf0\x91\xa2\xa1"}, {71874,"\xf0\x91\xa2\xa2"}, {71875,"\xf0\x91\xa2\xa3"}, {71876,"\xf0\x91\xa2\xa4"}, {71877,"\xf0\x91\xa2\xa5"}, {71878,"\xf0\x91\xa2\xa6"},
+{71879,"\xf0\x91\xa2\xa7"}, {71880,"\xf0\x91\xa2\xa8"}, {71881,"\xf0\x91\xa2\xa9"}, {71882,"\xf0\x91\xa2\xaa"}, {71883,"\xf0\x91\xa2\xab"}, {71884,"\xf0\x91\xa2\xac"},
+{71885,"\xf0\x91\xa2\xad"}, {71886,"\xf0\x91\xa2\xae"}, {71887,"\xf0\x91\xa2\xaf"}, {71888,"\xf0\x91\xa2\xb0"}, {71889,"\xf0\x91\xa2\xb1"}, {71890,"\xf0\x91\xa2\xb2"},
+{71891,"\xf0\x91\xa2\xb3"}, {71892,"\xf0\x91\xa2\xb4"}, {71893,"\xf0\x91\xa2\xb5"}, {71894,"\xf0\x91\xa2\xb6"}, {71895,"\xf0\x91\xa2\xb7"}, {71896,"\xf0\x91\xa2\xb8"},
+{71897,"\xf0\x91\xa2\xb9"}, {71898,"\xf0\x91\xa2\xba"}, {71899,"\xf0\x91\xa2\xbb"}, {71900,"\xf0\x91\xa2\xbc"}, {71901,"\xf0\x91\xa2\xbd"}, {71902,"\xf0\x91\xa2\xbe"},
+{71903,"\xf0\x91\xa2\xbf"}, {93792,"\xf0\x96\xb9\x80"}, {93793,"\xf0\x96\xb9\x81"}, {93794,"\xf0\x96\xb9\x82"}, {93795,"\xf0\x96\xb9\x83"}, {93796,"\xf0\x96\xb9\x84"},
+{93797,"\xf0\x96\xb9\x85"}, {93798,"\xf0\x96\xb9\x86"}, {93799,"\xf0\x96\xb9\x87"}, {93800,"\xf0\x96\xb9\x88"}, {93801,"\xf0\x96\xb9\x89"}, {93802,"\xf0\x96\xb9\x8a"},
+{93803,"\xf0\x96\xb9\x8b"}, {93804,"\xf0\x96\xb9\x8c"}, {93805,"\xf0\x96\xb9\x8d"}, {93806,"\xf0\x96\xb9\x8e"}, {93807,"\xf0\x96\xb9\x8f"}, {93808,"\xf0\x96\xb9\x90"},
+{93809,"\xf0\x96\xb9\x91"}, {93810,"\xf0\x96\xb9\x92"}, {93811,"\xf0\x96\xb9\x93"}, {93812,"\xf0\x96\xb9\x94"}, {93813,"\xf0\x96\xb9\x95"}, {93814,"\xf0\x96\xb9\x96"},
+{93815,"\xf0\x96\xb9\x97"}, {93816,"\xf0\x96\xb9\x98"}, {93817,"\xf0\x96\xb9\x99"}, {93818,"\xf0\x96\xb9\x9a"}, {93819,"\xf0\x96\xb9\x9b"}, {93820,"\xf0\x96\xb9\x9c"},
+{93821,"\xf0\x96\xb9\x9d"}, {93822,"\xf0\x96\xb9\x9e"}, {93823,"\xf0\x96\xb9\x9f"}, {125218,"\xf0\x9e\xa4\x80"}, {125219,"\xf0\x9e\xa4\x81"}, {125220,"\xf0\x9e\xa4\x82"},
+{125221,"\xf0\x9e\xa4\x83"}, {125222,"\xf0\x9e\xa4\x84"}, {125223,"\xf0\x9e\xa4\x85"}, {125224,"\xf0\x9e\xa4\x86"}, {125225,"\xf0\x9e\xa4\x87"}, {125226,"\xf0\x9e\xa4\x88"},
+{125227,"\xf0\x9e\xa4\x89"}, {125228,"\xf0\x9e\xa4\x8a"}, {125229,"\xf0\x9e\xa4\x8b"}, {125230,"\xf0\x9e\xa4\x8c"}, {125231,"\xf0\x9e\xa4\x8d"}, {125232,"\xf0\x9e\xa4\x8e"},
+{125233,"\xf0\x9e\xa4\x8f"}, {125234,"\xf0\x9e\xa4\x90"}, {125235,"\xf0\x9e\xa4\x91"}, {125236,"\xf0\x9e\xa4\x92"}, {125237,"\xf0\x9e\xa4\x93"}, {125238,"\xf0\x9e\xa4\x94"},
+{125239,"\xf0\x9e\xa4\x95"}, {125240,"\xf0\x9e\xa4\x96"}, {125241,"\xf0\x9e\xa4\x97"}, {125242,"\xf0\x9e\xa4\x98"}, {125243,"\xf0\x9e\xa4\x99"}, {125244,"\xf0\x9e\xa4\x9a"},
+{125245,"\xf0\x9e\xa4\x9b"}, {125246,"\xf0\x9e\xa4\x9c"}, {125247,"\xf0\x9e\xa4\x9d"}, {125248,"\xf0\x9e\xa4\x9e"}, {125249,"\xf0\x9e\xa4\x9f"}, {125250,"\xf0\x9e\xa4\xa0"},
+{125251,"\xf0\x9e\xa4\xa1"},
 //--Autogenerated -- end of section automatically generated
-;
+};
 
-// Maximum length of a case conversion result is 6 bytes in UTF-8
-constexpr size_t maxConversionLength = 6;
+constexpr CharacterConversion lowerConversions[] = {
+//++Autogenerated -- start of section automatically generated
+{65,"a"}, {66,"b"}, {67,"c"}, {68,"d"}, {69,"e"}, {70,"f"},
+{71,"g"}, {72,"h"}, {73,"i"}, {74,"j"}, {75,"k"}, {76,"l"},
+{77,"m"}, {78,"n"}, {79,"o"}, {80,"p"}, {81,"q"}, {82,"r"},
+{83,"s"}, {84,"t"}, {85,"u"}, {86,"v"}, {87,"w"}, {88,"x"},
+{89,"y"}, {90,"z"}, {192,"\xc3\xa0"}, {193,"\xc3\xa1"}, {194,"\xc3\xa2"}, {195,"\xc3\xa3"},
+{196,"\xc3\xa4"}, {197,"\xc3\xa5"}, {198,"\xc3\xa6"}, {199,"\xc3\xa7"}, {200,"\xc3\xa8"}, {201,"\xc3\xa9"},
+{202,"\xc3\xaa"}, {203,"\xc3\xab"}, {204,"\xc3\xac"}, {205,"\xc3\xad"}, {206,"\xc3\xae"}, {207,"\xc3\xaf"},
+{208,"\xc3\xb0"}, {209,"\xc3\xb1"}, {210,"\xc3\xb2"}, {211,"\xc3\xb3"}, {212,"\xc3\xb4"}, {213,"\xc3\xb5"},
+{214,"\xc3\xb6"}, {216,"\xc3\xb8"}, {217,"\xc3\xb9"}, {218,"\xc3\xba"}, {219,"\xc3\xbb"}, {220,"\xc3\xbc"},
+{221,"\xc3\xbd"}, {222,"\xc3\xbe"}, {256,"\xc4\x81"}, {258,"\xc4\x83"}, {260,"\xc4\x85"}, {262,"\xc4\x87"},
+{264,"\xc4\x89"}, {266,"\xc4\x8b"}, {268,"\xc4\x8d"}, {270,"\xc4\x8f"}, {272,"\xc4\x91"}, {274,"\xc4\x93"},
+{276,"\xc4\x95"}, {278,"\xc4\x97"}, {280,"\xc4\x99"}, {282,"\xc4\x9b"}, {284,"\xc4\x9d"}, {286,"\xc4\x9f"},
+{288,"\xc4\xa1"}, {290,"\xc4\xa3"}, {292,"\xc4\xa5"}, {294,"\xc4\xa7"}, {296,"\xc4\xa9"}, {298,"\xc4\xab"},
+{300,"\xc4\xad"}, {302,"\xc4\xaf"}, {304,"i\xcc\x87"}, {306,"\xc4\xb3"}, {308,"\xc4\xb5"}, {310,"\xc4\xb7"},
+{313,"\xc4\xba"}, {315,"\xc4\xbc"}, {317,"\xc4\xbe"}, {319,"\xc5\x80"}, {321,"\xc5\x82"}, {323,"\xc5\x84"},
+{325,"\xc5\x86"}, {327,"\xc5\x88"}, {330,"\xc5\x8b"}, {332,"\xc5\x8d"}, {334,"\xc5\x8f"}, {336,"\xc5\x91"},
+{338,"\xc5\x93"}, {340,"\xc5\x95"}, {342,"\xc5\x97"}, {344,"\xc5\x99"}, {346,"\xc5\x9b"}, {348,"\xc5\x9d"},
+{350,"\xc5\x9f"}, {352,"\xc5\xa1"}, {354,"\xc5\xa3"}, {356,"\xc5\xa5"}, {358,"\xc5\xa7"}, {360,"\xc5\xa9"},
+{362,"\xc5\xab"}, {364,"\xc5\xad"}, {366,"\xc5\xaf"}, {368,"\xc5\xb1"}, {370,"\xc5\xb3"}, {372,"\xc5\xb5"},
+{374,"\xc5\xb7"}, {376,"\xc3\xbf"}, {377,"\xc5\xba"}, {379,"\xc5\xbc"}, {381,"\xc5\xbe"}, {385,"\xc9\x93"},
+{386,"\xc6\x83"}, {388,"\xc6\x85"}, {390,"\xc9\x94"}, {391,"\xc6\x88"}, {393,"\xc9\x96"}, {394,"\xc9\x97"},
+{395,"\xc6\x8c"}, {398,"\xc7\x9d"}, {399,"\xc9\x99"}, {400,"\xc9\x9b"}, {401,"\xc6\x92"}, {403,"\xc9\xa0"},
+{404,"\xc9\xa3"}, {406,"\xc9\xa9"}, {407,"\xc9\xa8"}, {408,"\xc6\x99"}, {412,"\xc9\xaf"}, {413,"\xc9\xb2"},
+{415,"\xc9\xb5"}, {416,"\xc6\xa1"}, {418,"\xc6\xa3"}, {420,"\xc6\xa5"}, {422,"\xca\x80"}, {423,"\xc6\xa8"},
+{425,"\xca\x83"}, {428,"\xc6\xad"}, {430,"\xca\x88"}, {431,"\xc6\xb0"}, {433,"\xca\x8a"}, {434,"\xca\x8b"},
+{435,"\xc6\xb4"}, {437,"\xc6\xb6"}, {439,"\xca\x92"}, {440,"\xc6\xb9"}, {444,"\xc6\xbd"}, {452,"\xc7\x86"},
+{453,"\xc7\x86"}, {455,"\xc7\x89"}, {456,"\xc7\x89"}, {458,"\xc7\x8c"}, {459,"\xc7\x8c"}, {461,"\xc7\x8e"},
+{463,"\xc7\x90"}, {465,"\xc7\x92"}, {467,"\xc7\x94"}, {469,"\xc7\x96"}, {471,"\xc7\x98"}, {473,"\xc7\x9a"},
+{475,"\xc7\x9c"}, {478,"\xc7\x9f"}, {480,"\xc7\xa1"}, {482,"\xc7\xa3"}, {484,"\xc7\xa5"}, {486,"\xc7\xa7"},
+{488,"\xc7\xa9"}, {490,"\xc7\xab"}, {492,"\xc7\xad"}, {494,"\xc7\xaf"}, {497,"\xc7\xb3"}, {498,"\xc7\xb3"},
+{500,"\xc7\xb5"}, {502,"\xc6\x95"}, {503,"\xc6\xbf"}, {504,"\xc7\xb9"}, {506,"\xc7\xbb"}, {508,"\xc7\xbd"},
+{510,"\xc7\xbf"}, {512,"\xc8\x81"}, {514,"\xc8\x83"}, {516,"\xc8\x85"}, {518,"\xc8\x87"}, {520,"\xc8\x89"},
+{522,"\xc8\x8b"}, {524,"\xc8\x8d"}, {526,"\xc8\x8f"}, {528,"\xc8\x91"}, {530,"\xc8\x93"}, {532,"\xc8\x95"},
+{534,"\xc8\x97"}, {536,"\xc8\x99"}, {538,"\xc8\x9b"}, {540,"\xc8\x9d"}, {542,"\xc8\x9f"}, {544,"\xc6\x9e"},
+{546,"\xc8\xa3"}, {548,"\xc8\xa5"}, {550,"\xc8\xa7"}, {552,"\xc8\xa9"}, {554,"\xc8\xab"}, {556,"\xc8\xad"},
+{558,"\xc8\xaf"}, {560,"\xc8\xb1"}, {562,"\xc8\xb3"}, {570,"\xe2\xb1\xa5"}, {571,"\xc8\xbc"}, {573,"\xc6\x9a"},
+{574,"\xe2\xb1\xa6"}, {577,"\xc9\x82"}, {579,"\xc6\x80"}, {580,"\xca\x89"}, {581,"\xca\x8c"}, {582,"\xc9\x87"},
+{584,"\xc9\x89"}, {586,"\xc9\x8b"}, {588,"\xc9\x8d"}, {590,"\xc9\x8f"}, {880,"\xcd\xb1"}, {882,"\xcd\xb3"},
+{886,"\xcd\xb7"}, {895,"\xcf\xb3"}, {902,"\xce\xac"}, {904,"\xce\xad"}, {905,"\xce\xae"}, {906,"\xce\xaf"},
+{908,"\xcf\x8c"}, {910,"\xcf\x8d"}, {911,"\xcf\x8e"}, {913,"\xce\xb1"}, {914,"\xce\xb2"}, {915,"\xce\xb3"},
+{916,"\xce\xb4"}, {917,"\xce\xb5"}, {918,"\xce\xb6"}, {919,"\xce\xb7"}, {920,"\xce\xb8"}, {921,"\xce\xb9"},
+{922,"\xce\xba"}, {923,"\xce\xbb"}, {924,"\xce\xbc"}, {925,"\xce\xbd"}, {926,"\xce\xbe"}, {927,"\xce\xbf"},
+{928,"\xcf\x80"}, {929,"\xcf\x81"}, {931,"\xcf\x83"}, {932,"\xcf\x84"}, {933,"\xcf\x85"}, {934,"\xcf\x86"},
+{935,"\xcf\x87"}, {936,"\xcf\x88"}, {937,"\xcf\x89"}, {938,"\xcf\x8a"}, {939,"\xcf\x8b"}, {975,"\xcf\x97"},
+{984,"\xcf\x99"}, {986,"\xcf\x9b"}, {988,"\xcf\x9d"}, {990,"\xcf\x9f"}, {992,"\xcf\xa1"}, {994,"\xcf\xa3"},
+{996,"\xcf\xa5"}, {998,"\xcf\xa7"}, {1000,"\xcf\xa9"}, {1002,"\xcf\xab"}, {1004,"\xcf\xad"}, {1006,"\xcf\xaf"},
+{1012,"\xce\xb8"}, {1015,"\xcf\xb8"}, {1017,"\xcf\xb2"}, {1018,"\xcf\xbb"}, {1021,"\xcd\xbb"}, {1022,"\xcd\xbc"},
+{1023,"\xcd\xbd"}, {1024,"\xd1\x90"}, {1025,"\xd1\x91"}, {1026,"\xd1\x92"}, {1027,"\xd1\x93"}, {1028,"\xd1\x94"},
+{1029,"\xd1\x95"}, {1030,"\xd1\x96"}, {1031,"\xd1\x97"}, {1032,"\xd1\x98"}, {1033,"\xd1\x99"}, {1034,"\xd1\x9a"},
+{1035,"\xd1\x9b"}, {1036,"\xd1\x9c"}, {1037,"\xd1\x9d"}, {1038,"\xd1\x9e"}, {1039,"\xd1\x9f"}, {1040,"\xd0\xb0"},
+{1041,"\xd0\xb1"}, {1042,"\xd0\xb2"}, {1043,"\xd0\xb3"}, {1044,"\xd0\xb4"}, {1045,"\xd0\xb5"}, {1046,"\xd0\xb6"},
+{1047,"\xd0\xb7"}, {1048,"\xd0\xb8"}, {1049,"\xd0\xb9"}, {1050,"\xd0\xba"}, {1051,"\xd0\xbb"}, {1052,"\xd0\xbc"},
+{1053,"\xd0\xbd"}, {1054,"\xd0\xbe"}, {1055,"\xd0\xbf"}, {1056,"\xd1\x80"}, {1057,"\xd1\x81"}, {1058,"\xd1\x82"},
+{1059,"\xd1\x83"}, {1060,"\xd1\x84"}, {1061,"\xd1\x85"}, {1062,"\xd1\x86"}, {1063,"\xd1\x87"}, {1064,"\xd1\x88"},
+{1065,"\xd1\x89"}, {1066,"\xd1\x8a"}, {1067,"\xd1\x8b"}, {1068,"\xd1\x8c"}, {1069,"\xd1\x8d"}, {1070,"\xd1\x8e"},
+{1071,"\xd1\x8f"}, {1120,"\xd1\xa1"}, {1122,"\xd1\xa3"}, {1124,"\xd1\xa5"}, {1126,"\xd1\xa7"}, {1128,"\xd1\xa9"},
+{1130,"\xd1\xab"}, {1132,"\xd1\xad"}, {1134,"\xd1\xaf"}, {1136,"\xd1\xb1"}, {1138,"\xd1\xb3"}, {1140,"\xd1\xb5"},
+{1142,"\xd1\xb7"}, {1144,"\xd1\xb9"}, {1146,"\xd1\xbb"}, {1148,"\xd1\xbd"}, {1150,"\xd1\xbf"}, {1152,"\xd2\x81"},
+{1162,"\xd2\x8b"}, {1164,"\xd2\x8d"}, {1166,"\xd2\x8f"}, {1168,"\xd2\x91"}, {1170,"\xd2\x93"}, {1172,"\xd2\x95"},
+{1174,"\xd2\x97"}, {1176,"\xd2\x99"}, {1178,"\xd2\x9b"}, {1180,"\xd2\x9d"}, {1182,"\xd2\x9f"}, {1184,"\xd2\xa1"},
+{1186,"\xd2\xa3"}, {1188,"\xd2\xa5"}, {1190,"\xd2\xa7"}, {1192,"\xd2\xa9"}, {1194,"\xd2\xab"}, {1196,"\xd2\xad"},
+{1198,"\xd2\xaf"}, {1200,"\xd2\xb1"}, {1202,"\xd2\xb3"}, {1204,"\xd2\xb5"}, {1206,"\xd2\xb7"}, {1208,"\xd2\xb9"},
+{1210,"\xd2\xbb"}, {1212,"\xd2\xbd"}, {1214,"\xd2\xbf"}, {1216,"\xd3\x8f"}, {1217,"\xd3\x82"}, {1219,"\xd3\x84"},
+{1221,"\xd3\x86"}, {1223,"\xd3\x88"}, {1225,"\xd3\x8a"}, {1227,"\xd3\x8c"}, {1229,"\xd3\x8e"}, {1232,"\xd3\x91"},
+{1234,"\xd3\x93"}, {1236,"\xd3\x95"}, {1238,"\xd3\x97"}, {1240,"\xd3\x99"}, {1242,"\xd3\x9b"}, {1244,"\xd3\x9d"},
+{1246,"\xd3\x9f"}, {1248,"\xd3\xa1"}, {1250,"\xd3\xa3"}, {1252,"\xd3\xa5"}, {1254,"\xd3\xa7"}, {1256,"\xd3\xa9"},
+{1258,"\xd3\xab"}, {1260,"\xd3\xad"}, {1262,"\xd3\xaf"}, {1264,"\xd3\xb1"}, {1266,"\xd3\xb3"}, {1268,"\xd3\xb5"},
+{1270,"\xd3\xb7"}, {1272,"\xd3\xb9"}, {1274,"\xd3\xbb"}, {1276,"\xd3\xbd"}, {1278,"\xd3\xbf"}, {1280,"\xd4\x81"},
+{1282,"\xd4\x83"}, {1284,"\xd4\x85"}, {1286,"\xd4\x87"}, {1288,"\xd4\x89"}, {1290,"\xd4\x8b"}, {1292,"\xd4\x8d"},
+{1294,"\xd4\x8f"}, {1296,"\xd4\x91"}, {1298,"\xd4\x93"}, {1300,"\xd4\x95"}, {1302,"\xd4\x97"}, {1304,"\xd4\x99"},
+{1306,"\xd4\x9b"}, {1308,"\xd4\x9d"}, {1310,"\xd4\x9f"}, {1312,"\xd4\xa1"}, {1314,"\xd4\xa3"}, {1316,"\xd4\xa5"},
+{1318,"\xd4\xa7"}, {1320,"\xd4\xa9"}, {1322,"\xd4\xab"}, {1324,"\xd4\xad"}, {1326,"\xd4\xaf"}, {1329,"\xd5\xa1"},
+{1330,"\xd5\xa2"}, {1331,"\xd5\xa3"}, {1332,"\xd5\xa4"}, {1333,"\xd5\xa5"}, {1334,"\xd5\xa6"}, {1335,"\xd5\xa7"},
+{1336,"\xd5\xa8"}, {1337,"\xd5\xa9"}, {1338,"\xd5\xaa"}, {1339,"\xd5\xab"}, {1340,"\xd5\xac"}, {1341,"\xd5\xad"},
+{1342,"\xd5\xae"}, {1343,"\xd5\xaf"}, {1344,"\xd5\xb0"}, {1345,"\xd5\xb1"}, {1346,"\xd5\xb2"}, {1347,"\xd5\xb3"},
+{1348,"\xd5\xb4"}, {1349,"\xd5\xb5"}, {1350,"\xd5\xb6"}, {1351,"\xd5\xb7"}, {1352,"\xd5\xb8"}, {1353,"\xd5\xb9"},
+{1354,"\xd5\xba"}, {1355,"\xd5\xbb"}, {1356,"\xd5\xbc"}, {1357,"\xd5\xbd"}, {1358,"\xd5\xbe"}, {1359,"\xd5\xbf"},
+{1360,"\xd6\x80"}, {1361,"\xd6\x81"}, {1362,"\xd6\x82"}, {1363,"\xd6\x83"}, {1364,"\xd6\x84"}, {1365,"\xd6\x85"},
+{1366,"\xd6\x86"}, {4256,"\xe2\xb4\x80"}, {4257,"\xe2\xb4\x81"}, {4258,"\xe2\xb4\x82"}, {4259,"\xe2\xb4\x83"}, {4260,"\xe2\xb4\x84"},
+{4261,"\xe2\xb4\x85"}, {4262,"\xe2\xb4\x86"}, {4263,"\xe2\xb4\x87"}, {4264,"\xe2\xb4\x88"}, {4265,"\xe2\xb4\x89"}, {4266,"\xe2\xb4\x8a"},
+{4267,"\xe2\xb4\x8b"}, {4268,"\xe2\xb4\x8c"}, {4269,"\xe2\xb4\x8d"}, {4270,"\xe2\xb4\x8e"}, {4271,"\xe2\xb4\x8f"}, {4272,"\xe2\xb4\x90"},
+{4273,"\xe2\xb4\x91"}, {4274,"\xe2\xb4\x92"}, {4275,"\xe2\xb4\x93"}, {4276,"\xe2\xb4\x94"}, {4277,"\xe2\xb4\x95"}, {4278,"\xe2\xb4\x96"},
+{4279,"\xe2\xb4\x97"}, {4280,"\xe2\xb4\x98"}, {4281,"\xe2\xb4\x99"}, {4282,"\xe2\xb4\x9a"}, {4283,"\xe2\xb4\x9b"}, {4284,"\xe2\xb4\x9c"},
+{4285,"\xe2\xb4\x9d"}, {4286,"\xe2\xb4\x9e"}, {4287,"\xe2\xb4\x9f"}, {4288,"\xe2\xb4\xa0"}, {4289,"\xe2\xb4\xa1"}, {4290,"\xe2\xb4\xa2"},
+{4291,"\xe2\xb4\xa3"}, {4292,"\xe2\xb4\xa4"}, {4293,"\xe2\xb4\xa5"}, {4295,"\xe2\xb4\xa7"}, {4301,"\xe2\xb4\xad"}, {5024,"\xea\xad\xb0"},
+{5025,"\xea\xad\xb1"}, {5026,"\xea\xad\xb2"}, {5027,"\xea\xad\xb3"}, {5028,"\xea\xad\xb4"}, {5029,"\xea\xad\xb5"}, {5030,"\xea\xad\xb6"},
+{5031,"\xea\xad\xb7"}, {5032,"\xea\xad\xb8"}, {5033,"\xea\xad\xb9"}, {5034,"\xea\xad\xba"}, {5035,"\xea\xad\xbb"}, {5036,"\xea\xad\xbc"},
+{5037,"\xea\xad\xbd"}, {5038,"\xea\xad\xbe"}, {5039,"\xea\xad\xbf"}, {5040,"\xea\xae\x80"}, {5041,"\xea\xae\x81"}, {5042,"\xea\xae\x82"},
+{5043,"\xea\xae\x83"}, {5044,"\xea\xae\x84"}, {5045,"\xea\xae\x85"}, {5046,"\xea\xae\x86"}, {5047,"\xea\xae\x87"}, {5048,"\xea\xae\x88"},
+{5049,"\xea\xae\x89"}, {5050,"\xea\xae\x8a"}, {5051,"\xea\xae\x8b"}, {5052,"\xea\xae\x8c"}, {5053,"\xea\xae\x8d"}, {5054,"\xea\xae\x8e"},
+{5055,"\xea\xae\x8f"}, {5056,"\xea\xae\x90"}, {5057,"\xea\xae\x91"}, {5058,"\xea\xae\x92"}, {5059,"\xea\xae\x93"}, {5060,"\xea\xae\x94"},
+{5061,"\xea\xae\x95"}, {5062,"\xea\xae\x96"}, {5063,"\xea\xae\x97"}, {5064,"\xea\xae\x98"}, {5065,"\xea\xae\x99"}, {5066,"\xea\xae\x9a"},
+{5067,"\xea\xae\x9b"}, {5068,"\xea\xae\x9c"}, {5069,"\xea\xae\x9d"}, {5070,"\xea\xae\x9e"}, {5071,"\xea\xae\x9f"}, {5072,"\xea\xae\xa0"},
+{5073,"\xea\xae\xa1"}, {5074,"\xea\xae\xa2"}, {5075,"\xea\xae\xa3"}, {5076,"\xea\xae\xa4"}, {5077,"\xea\xae\xa5"}, {5078,"\xea\xae\xa6"},
+{5079,"\xea\xae\xa7"}, {5080,"\xea\xae\xa8"}, {5081,"\xea\xae\xa9"}, {5082,"\xea\xae\xaa"}, {5083,"\xea\xae\xab"}, {5084,"\xea\xae\xac"},
+{5085,"\xea\xae\xad"}, {5086,"\xea\xae\xae"}, {5087,"\xea\xae\xaf"}, {5088,"\xea\xae\xb0"}, {5089,"\xea\xae\xb1"}, {5090,"\xea\xae\xb2"},
+{5091,"\xea\xae\xb3"}, {5092,"\xea\xae\xb4"}, {5093,"\xea\xae\xb5"}, {5094,"\xea\xae\xb6"}, {5095,"\xea\xae\xb7"}, {5096,"\xea\xae\xb8"},
+{5097,"\xea\xae\xb9"}, {5098,"\xea\xae\xba"}, {5099,"\xea\xae\xbb"}, {5100,"\xea\xae\xbc"}, {5101,"\xea\xae\xbd"}, {5102,"\xea\xae\xbe"},
+{5103,"\xea\xae\xbf"}, {5104,"\xe1\x8f\xb8"}, {5105,"\xe1\x8f\xb9"}, {5106,"\xe1\x8f\xba"}, {5107,"\xe1\x8f\xbb"}, {5108,"\xe1\x8f\xbc"},
+{5109,"\xe1\x8f\xbd"}, {7312,"\xe1\x83\x90"}, {7313,"\xe1\x83\x91"}, {7314,"\xe1\x83\x92"}, {7315,"\xe1\x83\x93"}, {7316,"\xe1\x83\x94"},
+{7317,"\xe1\x83\x95"}, {7318,"\xe1\x83\x96"}, {7319,"\xe1\x83\x97"}, {7320,"\xe1\x83\x98"}, {7321,"\xe1\x83\x99"}, {7322,"\xe1\x83\x9a"},
+{7323,"\xe1\x83\x9b"}, {7324,"\xe1\x83\x9c"}, {7325,"\xe1\x83\x9d"}, {7326,"\xe1\x83\x9e"}, {7327,"\xe1\x83\x9f"}, {7328,"\xe1\x83\xa0"},
+{7329,"\xe1\x83\xa1"}, {7330,"\xe1\x83\xa2"}, {7331,"\xe1\x83\xa3"}, {7332,"\xe1\x83\xa4"}, {7333,"\xe1\x83\xa5"}, {7334,"\xe1\x83\xa6"},
+{7335,"\xe1\x83\xa7"}, {7336,"\xe1\x83\xa8"}, {7337,"\xe1\x83\xa9"}, {7338,"\xe1\x83\xaa"}, {7339,"\xe1\x83\xab"}, {7340,"\xe1\x83\xac"},
+{7341,"\xe1\x83\xad"}, {7342,"\xe1\x83\xae"}, {7343,"\xe1\x83\xaf"}, {7344,"\xe1\x83\xb0"}, {7345,"\xe1\x83\xb1"}, {7346,"\xe1\x83\xb2"},
+{7347,"\xe1\x83\xb3"}, {7348,"\xe1\x83\xb4"}, {7349,"\xe1\x83\xb5"}, {7350,"\xe1\x83\xb6"}, {7351,"\xe1\x83\xb7"}, {7352,"\xe1\x83\xb8"},
+{7353,"\xe1\x83\xb9"}, {7354,"\xe1\x83\xba"}, {7357,"\xe1\x83\xbd"}, {7358,"\xe1\x83\xbe"}, {7359,"\xe1\x83\xbf"}, {7680,"\xe1\xb8\x81"},
+{7682,"\xe1\xb8\x83"}, {7684,"\xe1\xb8\x85"}, {7686,"\xe1\xb8\x87"}, {7688,"\xe1\xb8\x89"}, {7690,"\xe1\xb8\x8b"}, {7692,"\xe1\xb8\x8d"},
+{7694,"\xe1\xb8\x8f"}, {7696,"\xe1\xb8\x91"}, {7698,"\xe1\xb8\x93"}, {7700,"\xe1\xb8\x95"}, {7702,"\xe1\xb8\x97"}, {7704,"\xe1\xb8\x99"},
+{7706,"\xe1\xb8\x9b"}, {7708,"\xe1\xb8\x9d"}, {7710,"\xe1\xb8\x9f"}, {7712,"\xe1\xb8\xa1"}, {7714,"\xe1\xb8\xa3"}, {7716,"\xe1\xb8\xa5"},
+{7718,"\xe1\xb8\xa7"}, {7720,"\xe1\xb8\xa9"}, {7722,"\xe1\xb8\xab"}, {7724,"\xe1\xb8\xad"}, {7726,"\xe1\xb8\xaf"}, {7728,"\xe1\xb8\xb1"},
+{7730,"\xe1\xb8\xb3"}, {7732,"\xe1\xb8\xb5"}, {7734,"\xe1\xb8\xb7"}, {7736,"\xe1\xb8\xb9"}, {7738,"\xe1\xb8\xbb"}, {7740,"\xe1\xb8\xbd"},
+{7742,"\xe1\xb8\xbf"}, {7744,"\xe1\xb9\x81"}, {7746,"\xe1\xb9\x83"}, {7748,"\xe1\xb9\x85"}, {7750,"\xe1\xb9\x87"}, {7752,"\xe1\xb9\x89"},
+{7754,"\xe1\xb9\x8b"}, {7756,"\xe1\xb9\x8d"}, {7758,"\xe1\xb9\x8f"}, {7760,"\xe1\xb9\x91"}, {7762,"\xe1\xb9\x93"}, {7764,"\xe1\xb9\x95"},
+{7766,"\xe1\xb9\x97"}, {7768,"\xe1\xb9\x99"}, {7770,"\xe1\xb9\x9b"}, {7772,"\xe1\xb9\x9d"}, {7774,"\xe1\xb9\x9f"}, {7776,"\xe1\xb9\xa1"},
+{7778,"\xe1\xb9\xa3"}, {7780,"\xe1\xb9\xa5"}, {7782,"\xe1\xb9\xa7"}, {7784,"\xe1\xb9\xa9"}, {7786,"\xe1\xb9\xab"}, {7788,"\xe1\xb9\xad"},
+{7790,"\xe1\xb9\xaf"}, {7792,"\xe1\xb9\xb1"}, {7794,"\xe1\xb9\xb3"}, {7796,"\xe1\xb9\xb5"}, {7798,"\xe1\xb9\xb7"}, {7800,"\xe1\xb9\xb9"},
+{7802,"\xe1\xb9\xbb"}, {7804,"\xe1\xb9\xbd"}, {7806,"\xe1\xb9\xbf"}, {7808,"\xe1\xba\x81"}, {7810,"\xe1\xba\x83"}, {7812,"\xe1\xba\x85"},
+{7814,"\xe1\xba\x87"}, {7816,"\xe1\xba\x89"}, {7818,"\xe1\xba\x8b"}, {7820,"\xe1\xba\x8d"}, {7822,"\xe1\xba\x8f"}, {7824,"\xe1\xba\x91"},
+{7826,"\xe1\xba\x93"}, {7828,"\xe1\xba\x95"}, {7838,"\xc3\x9f"}, {7840,"\xe1\xba\xa1"}, {7842,"\xe1\xba\xa3"}, {7844,"\xe1\xba\xa5"},
+{7846,"\xe1\xba\xa7"}, {7848,"\xe1\xba\xa9"}, {7850,"\xe1\xba\xab"}, {7852,"\xe1\xba\xad"}, {7854,"\xe1\xba\xaf"}, {7856,"\xe1\xba\xb1"},
+{7858,"\xe1\xba\xb3"}, {7860,"\xe1\xba\xb5"}, {7862,"\xe1\xba\xb7"}, {7864,"\xe1\xba\xb9"}, {7866,"\xe1\xba\xbb"}, {7868,"\xe1\xba\xbd"},
+{7870,"\xe1\xba\xbf"}, {7872,"\xe1\xbb\x81"}, {7874,"\xe1\xbb\x83"}, {7876,"\xe1\xbb\x85"}, {7878,"\xe1\xbb\x87"}, {7880,"\xe1\xbb\x89"},
+{7882,"\xe1\xbb\x8b"}, {7884,"\xe1\xbb\x8d"}, {7886,"\xe1\xbb\x8f"}, {7888,"\xe1\xbb\x91"}, {7890,"\xe1\xbb\x93"}, {7892,"\xe1\xbb\x95"},
+{7894,"\xe1\xbb\x97"}, {7896,"\xe1\xbb\x99"}, {7898,"\xe1\xbb\x9b"}, {7900,"\xe1\xbb\x9d"}, {7902,"\xe1\xbb\x9f"}, {7904,"\xe1\xbb\xa1"},
+{7906,"\xe1\xbb\xa3"}, {7908,"\xe1\xbb\xa5"}, {7910,"\xe1\xbb\xa7"}, {7912,"\xe1\xbb\xa9"}, {7914,"\xe1\xbb\xab"}, {7916,"\xe1\xbb\xad"},
+{7918,"\xe1\xbb\xaf"}, {7920,"\xe1\xbb\xb1"}, {7922,"\xe1\xbb\xb3"}, {7924,"\xe1\xbb\xb5"}, {7926,"\xe1\xbb\xb7"}, {7928,"\xe1\xbb\xb9"},
+{7930,"\xe1\xbb\xbb"}, {7932,"\xe1\xbb\xbd"}, {7934,"\xe1\xbb\xbf"}, {7944,"\xe1\xbc\x80"}, {7945,"\xe1\xbc\x81"}, {7946,"\xe1\xbc\x82"},
+{7947,"\xe1\xbc\x83"}, {7948,"\xe1\xbc\x84"}, {7949,"\xe1\xbc\x85"}, {7950,"\xe1\xbc\x86"}, {7951,"\xe1\xbc\x87"}, {7960,"\xe1\xbc\x90"},
+{7961,"\xe1\xbc\x91"}, {7962,"\xe1\xbc\x92"}, {7963,"\xe1\xbc\x93"}, {7964,"\xe1\xbc\x94"}, {7965,"\xe1\xbc\x95"}, {7976,"\xe1\xbc\xa0"},
+{7977,"\xe1\xbc\xa1"}, {7978,"\xe1\xbc\xa2"}, {7979,"\xe1\xbc\xa3"}, {7980,"\xe1\xbc\xa4"}, {7981,"\xe1\xbc\xa5"}, {7982,"\xe1\xbc\xa6"},
+{7983,"\xe1\xbc\xa7"}, {7992,"\xe1\xbc\xb0"}, {7993,"\xe1\xbc\xb1"}, {7994,"\xe1\xbc\xb2"}, {7995,"\xe1\xbc\xb3"}, {7996,"\xe1\xbc\xb4"},
+{7997,"\xe1\xbc\xb5"}, {7998,"\xe1\xbc\xb6"}, {7999,"\xe1\xbc\xb7"}, {8008,"\xe1\xbd\x80"}, {8009,"\xe1\xbd\x81"}, {8010,"\xe1\xbd\x82"},
+{8011,"\xe1\xbd\x83"}, {8012,"\xe1\xbd\x84"}, {8013,"\xe1\xbd\x85"}, {8025,"\xe1\xbd\x91"}, {8027,"\xe1\xbd\x93"}, {8029,"\xe1\xbd\x95"},
+{8031,"\xe1\xbd\x97"}, {8040,"\xe1\xbd\xa0"}, {8041,"\xe1\xbd\xa1"}, {8042,"\xe1\xbd\xa2"}, {8043,"\xe1\xbd\xa3"}, {8044,"\xe1\xbd\xa4"},
+{8045,"\xe1\xbd\xa5"}, {8046,"\xe1\xbd\xa6"}, {8047,"\xe1\xbd\xa7"}, {8072,"\xe1\xbe\x80"}, {8073,"\xe1\xbe\x81"}, {8074,"\xe1\xbe\x82"},
+{8075,"\xe1\xbe\x83"}, {8076,"\xe1\xbe\x84"}, {8077,"\xe1\xbe\x85"}, {8078,"\xe1\xbe\x86"}, {8079,"\xe1\xbe\x87"}, {8088,"\xe1\xbe\x90"},
+{8089,"\xe1\xbe\x91"}, {8090,"\xe1\xbe\x92"}, {8091,"\xe1\xbe\x93"}, {8092,"\xe1\xbe\x94"}, {8093,"\xe1\xbe\x95"}, {8094,"\xe1\xbe\x96"},
+{8095,"\xe1\xbe\x97"}, {8104,"\xe1\xbe\xa0"}, {8105,"\xe1\xbe\xa1"}, {8106,"\xe1\xbe\xa2"}, {8107,"\xe1\xbe\xa3"}, {8108,"\xe1\xbe\xa4"},
+{8109,"\xe1\xbe\xa5"}, {8110,"\xe1\xbe\xa6"}, {8111,"\xe1\xbe\xa7"}, {8120,"\xe1\xbe\xb0"}, {8121,"\xe1\xbe\xb1"}, {8122,"\xe1\xbd\xb0"},
+{8123,"\xe1\xbd\xb1"}, {8124,"\xe1\xbe\xb3"}, {8136,"\xe1\xbd\xb2"}, {8137,"\xe1\xbd\xb3"}, {8138,"\xe1\xbd\xb4"}, {8139,"\xe1\xbd\xb5"},
+{8140,"\xe1\xbf\x83"}, {8152,"\xe1\xbf\x90"}, {8153,"\xe1\xbf\x91"}, {8154,"\xe1\xbd\xb6"}, {8155,"\xe1\xbd\xb7"}, {8168,"\xe1\xbf\xa0"},
+{8169,"\xe1\xbf\xa1"}, {8170,"\xe1\xbd\xba"}, {8171,"\xe1\xbd\xbb"}, {8172,"\xe1\xbf\xa5"}, {8184,"\xe1\xbd\xb8"}, {8185,"\xe1\xbd\xb9"},
+{8186,"\xe1\xbd\xbc"}, {8187,"\xe1\xbd\xbd"}, {8188,"\xe1\xbf\xb3"}, {8486,"\xcf\x89"}, {8490,"k"}, {8491,"\xc3\xa5"},
+{8498,"\xe2\x85\x8e"}, {8544,"\xe2\x85\xb0"}, {8545,"\xe2\x85\xb1"}, {8546,"\xe2\x85\xb2"}, {8547,"\xe2\x85\xb3"}, {8548,"\xe2\x85\xb4"},
+{8549,"\xe2\x85\xb5"}, {8550,"\xe2\x85\xb6"}, {8551,"\xe2\x85\xb7"}, {8552,"\xe2\x85\xb8"}, {8553,"\xe2\x85\xb9"}, {8554,"\xe2\x85\xba"},
+{8555,"\xe2\x85\xbb"}, {8556,"\xe2\x85\xbc"}, {8557,"\xe2\x85\xbd"}, {8558,"\xe2\x85\xbe"}, {8559,"\xe2\x85\xbf"}, {8579,"\xe2\x86\x84"},
+{9398,"\xe2\x93\x90"}, {9399,"\xe2\x93\x91"}, {9400,"\xe2\x93\x92"}, {9401,"\xe2\x93\x93"}, {9402,"\xe2\x93\x94"}, {9403,"\xe2\x93\x95"},
+{9404,"\xe2\x93\x96"}, {9405,"\xe2\x93\x97"}, {9406,"\xe2\x93\x98"}, {9407,"\xe2\x93\x99"}, {9408,"\xe2\x93\x9a"}, {9409,"\xe2\x93\x9b"},
+{9410,"\xe2\x93\x9c"}, {9411,"\xe2\x93\x9d"}, {9412,"\xe2\x93\x9e"}, {9413,"\xe2\x93\x9f"}, {9414,"\xe2\x93\xa0"}, {9415,"\xe2\x93\xa1"},
+{9416,"\xe2\x93\xa2"}, {9417,"\xe2\x93\xa3"}, {9418,"\xe2\x93\xa4"}, {9419,"\xe2\x93\xa5"}, {9420,"\xe2\x93\xa6"}, {9421,"\xe2\x93\xa7"},
+{9422,"\xe2\x93\xa8"}, {9423,"\xe2\x93\xa9"}, {11264,"\xe2\xb0\xb0"}, {11265,"\xe2\xb0\xb1"}, {11266,"\xe2\xb0\xb2"}, {11267,"\xe2\xb0\xb3"},
+{11268,"\xe2\xb0\xb4"}, {11269,"\xe2\xb0\xb5"}, {11270,"\xe2\xb0\xb6"}, {11271,"\xe2\xb0\xb7"}, {11272,"\xe2\xb0\xb8"}, {11273,"\xe2\xb0\xb9"},
+{11274,"\xe2\xb0\xba"}, {11275,"\xe2\xb0\xbb"}, {11276,"\xe2\xb0\xbc"}, {11277,"\xe2\xb0\xbd"}, {11278,"\xe2\xb0\xbe"}, {11279,"\xe2\xb0\xbf"},
+{11280,"\xe2\xb1\x80"}, {11281,"\xe2\xb1\x81"}, {11282,"\xe2\xb1\x82"}, {11283,"\xe2\xb1\x83"}, {11284,"\xe2\xb1\x84"}, {11285,"\xe2\xb1\x85"},
+{11286,"\xe2\xb1\x86"}, {11287,"\xe2\xb1\x87"}, {11288,"\xe2\xb1\x88"}, {11289,"\xe2\xb1\x89"}, {11290,"\xe2\xb1\x8a"}, {11291,"\xe2\xb1\x8b"},
+{11292,"\xe2\xb1\x8c"}, {11293,"\xe2\xb1\x8d"}, {11294,"\xe2\xb1\x8e"}, {11295,"\xe2\xb1\x8f"}, {11296,"\xe2\xb1\x90"}, {11297,"\xe2\xb1\x91"},
+{11298,"\xe2\xb1\x92"}, {11299,"\xe2\xb1\x93"}, {11300,"\xe2\xb1\x94"}, {11301,"\xe2\xb1\x95"}, {11302,"\xe2\xb1\x96"}, {11303,"\xe2\xb1\x97"},
+{11304,"\xe2\xb1\x98"}, {11305,"\xe2\xb1\x99"}, {11306,"\xe2\xb1\x9a"}, {11307,"\xe2\xb1\x9b"}, {11308,"\xe2\xb1\x9c"}, {11309,"\xe2\xb1\x9d"},
+{11310,"\xe2\xb1\x9e"}, {11311,"\xe2\xb1\x9f"}, {11360,"\xe2\xb1\xa1"}, {11362,"\xc9\xab"}, {11363,"\xe1\xb5\xbd"}, {11364,"\xc9\xbd"},
+{11367,"\xe2\xb1\xa8"}, {11369,"\xe2\xb1\xaa"}, {11371,"\xe2\xb1\xac"}, {11373,"\xc9\x91"}, {11374,"\xc9\xb1"}, {11375,"\xc9\x90"},
+{11376,"\xc9\x92"}, {11378,"\xe2\xb1\xb3"}, {11381,"\xe2\xb1\xb6"}, {11390,"\xc8\xbf"}, {11391,"\xc9\x80"}, {11392,"\xe2\xb2\x81"},
+{11394,"\xe2\xb2\x83"}, {11396,"\xe2\xb2\x85"}, {11398,"\xe2\xb2\x87"}, {11400,"\xe2\xb2\x89"}, {11402,"\xe2\xb2\x8b"}, {11404,"\xe2\xb2\x8d"},
+{11406,"\xe2\xb2\x8f"}, {11408,"\xe2\xb2\x91"}, {11410,"\xe2\xb2\x93"}, {11412,"\xe2\xb2\x95"}, {11414,"\xe2\xb2\x97"}, {11416,"\xe2\xb2\x99"},
+{11418,"\xe2\xb2\x9b"}, {11420,"\xe2\xb2\x9d"}, {11422,"\xe2\xb2\x9f"}, {11424,"\xe2\xb2\xa1"}, {11426,"\xe2\xb2\xa3"}, {11428,"\xe2\xb2\xa5"},
+{11430,"\xe2\xb2\xa7"}, {11432,"\xe2\xb2\xa9"}, {11434,"\xe2\xb2\xab"}, {11436,"\xe2\xb2\xad"}, {11438,"\xe2\xb2\xaf"}, {11440,"\xe2\xb2\xb1"},
+{11442,"\xe2\xb2\xb3"}, {11444,"\xe2\xb2\xb5"}, {11446,"\xe2\xb2\xb7"}, {11448,"\xe2\xb2\xb9"}, {11450,"\xe2\xb2\xbb"}, {11452,"\xe2\xb2\xbd"},
+{11454,"\xe2\xb2\xbf"}, {11456,"\xe2\xb3\x81"}, {11458,"\xe2\xb3\x83"}, {11460,"\xe2\xb3\x85"}, {11462,"\xe2\xb3\x87"}, {11464,"\xe2\xb3\x89"},
+{11466,"\xe2\xb3\x8b"}, {11468,"\xe2\xb3\x8d"}, {11470,"\xe2\xb3\x8f"}, {11472,"\xe2\xb3\x91"}, {11474,"\xe2\xb3\x93"}, {11476,"\xe2\xb3\x95"},
+{11478,"\xe2\xb3\x97"}, {11480,"\xe2\xb3\x99"}, {11482,"\xe2\xb3\x9b"}, {11484,"\xe2\xb3\x9d"}, {11486,"\xe2\xb3\x9f"}, {11488,"\xe2\xb3\xa1"},
+{11490,"\xe2\xb3\xa3"}, {11499,"\xe2\xb3\xac"}, {11501,"\xe2\xb3\xae"}, {11506,"\xe2\xb3\xb3"}, {42560,"\xea\x99\x81"}, {42562,"\xea\x99\x83"},
+{42564,"\xea\x99\x85"}, {42566,"\xea\x99\x87"}, {42568,"\xea\x99\x89"}, {42570,"\xea\x99\x8b"}, {42572,"\xea\x99\x8d"}, {42574,"\xea\x99\x8f"},
+{42576,"\xea\x99\x91"}, {42578,"\xea\x99\x93"}, {42580,"\xea\x99\x95"}, {42582,"\xea\x99\x97"}, {42584,"\xea\x99\x99"}, {42586,"\xea\x99\x9b"},
+{42588,"\xea\x99\x9d"}, {42590,"\xea\x99\x9f"}, {42592,"\xea\x99\xa1"}, {42594,"\xea\x99\xa3"}, {42596,"\xea\x99\xa5"}, {42598,"\xea\x99\xa7"},
+{42600,"\xea\x99\xa9"}, {42602,"\xea\x99\xab"}, {42604,"\xea\x99\xad"}, {42624,"\xea\x9a\x81"}, {42626,"\xea\x9a\x83"}, {42628,"\xea\x9a\x85"},
+{42630,"\xea\x9a\x87"}, {42632,"\xea\x9a\x89"}, {42634,"\xea\x9a\x8b"}, {42636,"\xea\x9a\x8d"}, {42638,"\xea\x9a\x8f"}, {42640,"\xea\x9a\x91"},
+{42642,"\xea\x9a\x93"}, {42644,"\xea\x9a\x95"}, {42646,"\xea\x9a\x97"}, {42648,"\xea\x9a\x99"}, {42650,"\xea\x9a\x9b"}, {42786,"\xea\x9c\xa3"},
+{42788,"\xea\x9c\xa5"}, {42790,"\xea\x9c\xa7"}, {42792,"\xea\x9c\xa9"}, {42794,"\xea\x9c\xab"}, {42796,"\xea\x9c\xad"}, {42798,"\xea\x9c\xaf"},
+{42802,"\xea\x9c\xb3"}, {42804,"\xea\x9c\xb5"}, {42806,"\xea\x9c\xb7"}, {42808,"\xea\x9c\xb9"}, {42810,"\xea\x9c\xbb"}, {42812,"\xea\x9c\xbd"},
+{42814,"\xea\x9c\xbf"}, {42816,"\xea\x9d\x81"}, {42818,"\xea\x9d\x83"}, {42820,"\xea\x9d\x85"}, {42822,"\xea\x9d\x87"}, {42824,"\xea\x9d\x89"},
+{42826,"\xea\x9d\x8b"}, {42828,"\xea\x9d\x8d"}, {42830,"\xea\x9d\x8f"}, {42832,"\xea\x9d\x91"}, {42834,"\xea\x9d\x93"}, {42836,"\xea\x9d\x95"},
+{42838,"\xea\x9d\x97"}, {42840,"\xea\x9d\x99"}, {42842,"\xea\x9d\x9b"}, {42844,"\xea\x9d\x9d"}, {42846,"\xea\x9d\x9f"}, {42848,"\xea\x9d\xa1"},
+{42850,"\xea\x9d\xa3"}, {42852,"\xea\x9d\xa5"}, {42854,"\xea\x9d\xa7"}, {42856,"\xea\x9d\xa9"}, {42858,"\xea\x9d\xab"}, {42860,"\xea\x9d\xad"},
+{42862,"\xea\x9d\xaf"}, {42873,"\xea\x9d\xba"}, {42875,"\xea\x9d\xbc"}, {42877,"\xe1\xb5\xb9"}, {42878,"\xea\x9d\xbf"}, {42880,"\xea\x9e\x81"},
+{42882,"\xea\x9e\x83"}, {42884,"\xea\x9e\x85"}, {42886,"\xea\x9e\x87"}, {42891,"\xea\x9e\x8c"}, {42893,"\xc9\xa5"}, {42896,"\xea\x9e\x91"},
+{42898,"\xea\x9e\x93"}, {42902,"\xea\x9e\x97"}, {42904,"\xea\x9e\x99"}, {42906,"\xea\x9e\x9b"}, {42908,"\xea\x9e\x9d"}, {42910,"\xea\x9e\x9f"},
+{42912,"\xea\x9e\xa1"}, {42914,"\xea\x9e\xa3"}, {42916,"\xea\x9e\xa5"}, {42918,"\xea\x9e\xa7"}, {42920,"\xea\x9e\xa9"}, {42922,"\xc9\xa6"},
+{42923,"\xc9\x9c"}, {42924,"\xc9\xa1"}, {42925,"\xc9\xac"}, {42926,"\xc9\xaa"}, {42928,"\xca\x9e"}, {42929,"\xca\x87"},
+{42930,"\xca\x9d"}, {42931,"\xea\xad\x93"}, {42932,"\xea\x9e\xb5"}, {42934,"\xea\x9e\xb7"}, {42936,"\xea\x9e\xb9"}, {42938,"\xea\x9e\xbb"},
+{42940,"\xea\x9e\xbd"}, {42942,"\xea\x9e\xbf"}, {42944,"\xea\x9f\x81"}, {42946,"\xea\x9f\x83"}, {42948,"\xea\x9e\x94"}, {42949,"\xca\x82"},
+{42950,"\xe1\xb6\x8e"}, {42951,"\xea\x9f\x88"}, {42953,"\xea\x9f\x8a"}, {42960,"\xea\x9f\x91"}, {42966,"\xea\x9f\x97"}, {42968,"\xea\x9f\x99"},
+{42997,"\xea\x9f\xb6"}, {65313,"\xef\xbd\x81"}, {65314,"\xef\xbd\x82"}, {65315,"\xef\xbd\x83"}, {65316,"\xef\xbd\x84"}, {65317,"\xef\xbd\x85"},
+{65318,"\xef\xbd\x86"}, {65319,"\xef\xbd\x87"}, {65320,"\xef\xbd\x88"}, {65321,"\xef\xbd\x89"}, {65322,"\xef\xbd\x8a"}, {65323,"\xef\xbd\x8b"},
+{65324,"\xef\xbd\x8c"}, {65325,"\xef\xbd\x8d"}, {65326,"\xef\xbd\x8e"}, {65327,"\xef\xbd\x8f"}, {65328,"\xef\xbd\x90"}, {65329,"\xef\xbd\x91"},
+{65330,"\xef\xbd\x92"}, {65331,"\xef\xbd\x93"}, {65332,"\xef\xbd\x94"}, {65333,"\xef\xbd\x95"}, {65334,"\xef\xbd\x96"}, {65335,"\xef\xbd\x97"},
+{65336,"\xef\xbd\x98"}, {65337,"\xef\xbd\x99"}, {65338,"\xef\xbd\x9a"}, {66560,"\xf0\x90\x90\xa8"}, {66561,"\xf0\x90\x90\xa9"}, {66562,"\xf0\x90\x90\xaa"},
+{66563,"\xf0\x90\x90\xab"}, {66564,"\xf0\x90\x90\xac"}, {66565,"\xf0\x90\x90\xad"}, {66566,"\xf0\x90\x90\xae"}, {66567,"\xf0\x90\x90\xaf"}, {66568,"\xf0\x90\x90\xb0"},
+{66569,"\xf0\x90\x90\xb1"}, {66570,"\xf0\x90\x90\xb2"}, {66571,"\xf0\x90\x90\xb3"}, {66572,"\xf0\x90\x90\xb4"}, {66573,"\xf0\x90\x90\xb5"}, {66574,"\xf0\x90\x90\xb6"},
+{66575,"\xf0\x90\x90\xb7"}, {66576,"\xf0\x90\x90\xb8"}, {66577,"\xf0\x90\x90\xb9"}, {66578,"\xf0\x90\x90\xba"}, {66579,"\xf0\x90\x90\xbb"}, {66580,"\xf0\x90\x90\xbc"},
+{66581,"\xf0\x90\x90\xbd"}, {66582,"\xf0\x90\x90\xbe"}, {66583,"\xf0\x90\x90\xbf"}, {66584,"\xf0\x90\x91\x80"}, {66585,"\xf0\x90\x91\x81"}, {66586,"\xf0\x90\x91\x82"},
+{66587,"\xf0\x90\x91\x83"}, {66588,"\xf0\x90\x91\x84"}, {66589,"\xf0\x90\x91\x85"}, {66590,"\xf0\x90\x91\x86"}, {66591,"\xf0\x90\x91\x87"}, {66592,"\xf0\x90\x91\x88"},
+{66593,"\xf0\x90\x91\x89"}, {66594,"\xf0\x90\x91\x8a"}, {66595,"\xf0\x90\x91\x8b"}, {66596,"\xf0\x90\x91\x8c"}, {66597,"\xf0\x90\x91\x8d"}, {66598,"\xf0\x90\x91\x8e"},
+{66599,"\xf0\x90\x91\x8f"}, {66736,"\xf0\x90\x93\x98"}, {66737,"\xf0\x90\x93\x99"}, {66738,"\xf0\x90\x93\x9a"}, {66739,"\xf0\x90\x93\x9b"}, {66740,"\xf0\x90\x93\x9c"},
+{66741,"\xf0\x90\x93\x9d"}, {66742,"\xf0\x90\x93\x9e"}, {66743,"\xf0\x90\x93\x9f"}, {66744,"\xf0\x90\x93\xa0"}, {66745,"\xf0\x90\x93\xa1"}, {66746,"\xf0\x90\x93\xa2"},
+{66747,"\xf0\x90\x93\xa3"}, {66748,"\xf0\x90\x93\xa4"}, {66749,"\xf0\x90\x93\xa5"}, {66750,"\xf0\x90\x93\xa6"}, {66751,"\xf0\x90\x93\xa7"}, {66752,"\xf0\x90\x93\xa8"},
+{66753,"\xf0\x90\x93\xa9"}, {66754,"\xf0\x90\x93\xaa"}, {66755,"\xf0\x90\x93\xab"}, {66756,"\xf0\x90\x93\xac"}, {66757,"\xf0\x90\x93\xad"}, {66758,"\xf0\x90\x93\xae"},
+{66759,"\xf0\x90\x93\xaf"}, {66760,"\xf0\x90\x93\xb0"}, {66761,"\xf0\x90\x93\xb1"}, {66762,"\xf0\x90\x93\xb2"}, {66763,"\xf0\x90\x93\xb3"}, {66764,"\xf0\x90\x93\xb4"},
+{66765,"\xf0\x90\x93\xb5"}, {66766,"\xf0\x90\x93\xb6"}, {66767,"\xf0\x90\x93\xb7"}, {66768,"\xf0\x90\x93\xb8"}, {66769,"\xf0\x90\x93\xb9"}, {66770,"\xf0\x90\x93\xba"},
+{66771,"\xf0\x90\x93\xbb"}, {66928,"\xf0\x90\x96\x97"}, {66929,"\xf0\x90\x96\x98"}, {66930,"\xf0\x90\x96\x99"}, {66931,"\xf0\x90\x96\x9a"}, {66932,"\xf0\x90\x96\x9b"},
+{66933,"\xf0\x90\x96\x9c"}, {66934,"\xf0\x90\x96\x9d"}, {66935,"\xf0\x90\x96\x9e"}, {66936,"\xf0\x90\x96\x9f"}, {66937,"\xf0\x90\x96\xa0"}, {66938,"\xf0\x90\x96\xa1"},
+{66940,"\xf0\x90\x96\xa3"}, {66941,"\xf0\x90\x96\xa4"}, {66942,"\xf0\x90\x96\xa5"}, {66943,"\xf0\x90\x96\xa6"}, {66944,"\xf0\x90\x96\xa7"}, {66945,"\xf0\x90\x96\xa8"},
+{66946,"\xf0\x90\x96\xa9"}, {66947,"\xf0\x90\x96\xaa"}, {66948,"\xf0\x90\x96\xab"}, {66949,"\xf0\x90\x96\xac"}, {66950,"\xf0\x90\x96\xad"}, {66951,"\xf0\x90\x96\xae"},
+{66952,"\xf0\x90\x96\xaf"}, {66953,"\xf0\x90\x96\xb0"}, {66954,"\xf0\x90\x96\xb1"}, {66956,"\xf0\x90\x96\xb3"}, {66957,"\xf0\x90\x96\xb4"}, {66958,"\xf0\x90\x96\xb5"},
+{66959,"\xf0\x90\x96\xb6"}, {66960,"\xf0\x90\x96\xb7"}, {66961,"\xf0\x90\x96\xb8"}, {66962,"\xf0\x90\x96\xb9"}, {66964,"\xf0\x90\x96\xbb"}, {66965,"\xf0\x90\x96\xbc"},
+{68736,"\xf0\x90\xb3\x80"}, {68737,"\xf0\x90\xb3\x81"}, {68738,"\xf0\x90\xb3\x82"}, {68739,"\xf0\x90\xb3\x83"}, {68740,"\xf0\x90\xb3\x84"}, {68741,"\xf0\x90\xb3\x85"},
+{68742,"\xf0\x90\xb3\x86"}, {68743,"\xf0\x90\xb3\x87"}, {68744,"\xf0\x90\xb3\x88"}, {68745,"\xf0\x90\xb3\x89"}, {68746,"\xf0\x90\xb3\x8a"}, {68747,"\xf0\x90\xb3\x8b"},
+{68748,"\xf0\x90\xb3\x8c"}, {68749,"\xf0\x90\xb3\x8d"}, {68750,"\xf0\x90\xb3\x8e"}, {68751,"\xf0\x90\xb3\x8f"}, {68752,"\xf0\x90\xb3\x90"}, {68753,"\xf0\x90\xb3\x91"},
+{68754,"\xf0\x90\xb3\x92"}, {68755,"\xf0\x90\xb3\x93"}, {68756,"\xf0\x90\xb3\x94"}, {68757,"\xf0\x90\xb3\x95"}, {68758,"\xf0\x90\xb3\x96"}, {68759,"\xf0\x90\xb3\x97"},
+{68760,"\xf0\x90\xb3\x98"}, {68761,"\xf0\x90\xb3\x99"}, {68762,"\xf0\x90\xb3\x9a"}, {68763,"\xf0\x90\xb3\x9b"}, {68764,"\xf0\x90\xb3\x9c"}, {68765,"\xf0\x90\xb3\x9d"},
+{68766,"\xf0\x90\xb3\x9e"}, {68767,"\xf0\x90\xb3\x9f"}, {68768,"\xf0\x90\xb3\xa0"}, {68769,"\xf0\x90\xb3\xa1"}, {68770,"\xf0\x90\xb3\xa2"}, {68771,"\xf0\x90\xb3\xa3"},
+{68772,"\xf0\x90\xb3\xa4"}, {68773,"\xf0\x90\xb3\xa5"}, {68774,"\xf0\x90\xb3\xa6"}, {68775,"\xf0\x90\xb3\xa7"}, {68776,"\xf0\x90\xb3\xa8"}, {68777,"\xf0\x90\xb3\xa9"},
+{68778,"\xf0\x90\xb3\xaa"}, {68779,"\xf0\x90\xb3\xab"}, {68780,"\xf0\x90\xb3\xac"}, {68781,"\xf0\x90\xb3\xad"}, {68782,"\xf0\x90\xb3\xae"}, {68783,"\xf0\x90\xb3\xaf"},
+{68784,"\xf0\x90\xb3\xb0"}, {68785,"\xf0\x90\xb3\xb1"}, {68786,"\xf0\x90\xb3\xb2"}, {71840,"\xf0\x91\xa3\x80"}, {71841,"\xf0\x91\xa3\x81"}, {71842,"\xf0\x91\xa3\x82"},
+{71843,"\xf0\x91\xa3\x83"}, {71844,"\xf0\x91\xa3\x84"}, {71845,"\xf0\x91\xa3\x85"}, {71846,"\xf0\x91\xa3\x86"}, {71847,"\xf0\x91\xa3\x87"}, {71848,"\xf0\x91\xa3\x88"},
+{71849,"\xf0\x91\xa3\x89"}, {71850,"\xf0\x91\xa3\x8a"}, {71851,"\xf0\x91\xa3\x8b"}, {71852,"\xf0\x91\xa3\x8c"}, {71853,"\xf0\x91\xa3\x8d"}, {71854,"\xf0\x91\xa3\x8e"},
+{71855,"\xf0\x91\xa3\x8f"}, {71856,"\xf0\x91\xa3\x90"}, {71857,"\xf0\x91\xa3\x91"}, {71858,"\xf0\x91\xa3\x92"}, {71859,"\xf0\x91\xa3\x93"}, {71860,"\xf0\x91\xa3\x94"},
+{71861,"\xf0\x91\xa3\x95"}, {71862,"\xf0\x91\xa3\x96"}, {71863,"\xf0\x91\xa3\x97"}, {71864,"\xf0\x91\xa3\x98"}, {71865,"\xf0\x91\xa3\x99"}, {71866,"\xf0\x91\xa3\x9a"},
+{71867,"\xf0\x91\xa3\x9b"}, {71868,"\xf0\x91\xa3\x9c"}, {71869,"\xf0\x91\xa3\x9d"}, {71870,"\xf0\x91\xa3\x9e"}, {71871,"\xf0\x91\xa3\x9f"}, {93760,"\xf0\x96\xb9\xa0"},
+{93761,"\xf0\x96\xb9\xa1"}, {93762,"\xf0\x96\xb9\xa2"}, {93763,"\xf0\x96\xb9\xa3"}, {93764,"\xf0\x96\xb9\xa4"}, {93765,"\xf0\x96\xb9\xa5"}, {93766,"\xf0\x96\xb9\xa6"},
+{93767,"\xf0\x96\xb9\xa7"}, {93768,"\xf0\x96\xb9\xa8"}, {93769,"\xf0\x96\xb9\xa9"}, {93770,"\xf0\x96\xb9\xaa"}, {93771,"\xf0\x96\xb9\xab"}, {93772,"\xf0\x96\xb9\xac"},
+{93773,"\xf0\x96\xb9\xad"}, {93774,"\xf0\x96\xb9\xae"}, {93775,"\xf0\x96\xb9\xaf"}, {93776,"\xf0\x96\xb9\xb0"}, {93777,"\xf0\x96\xb9\xb1"}, {93778,"\xf0\x96\xb9\xb2"},
+{93779,"\xf0\x96\xb9\xb3"}, {93780,"\xf0\x96\xb9\xb4"}, {93781,"\xf0\x96\xb9\xb5"}, {93782,"\xf0\x96\xb9\xb6"}, {93783,"\xf0\x96\xb9\xb7"}, {93784,"\xf0\x96\xb9\xb8"},
+{93785,"\xf0\x96\xb9\xb9"}, {93786,"\xf0\x96\xb9\xba"}, {93787,"\xf0\x96\xb9\xbb"}, {93788,"\xf0\x96\xb9\xbc"}, {93789,"\xf0\x96\xb9\xbd"}, {93790,"\xf0\x96\xb9\xbe"},
+{93791,"\xf0\x96\xb9\xbf"}, {125184,"\xf0\x9e\xa4\xa2"}, {125185,"\xf0\x9e\xa4\xa3"}, {125186,"\xf0\x9e\xa4\xa4"}, {125187,"\xf0\x9e\xa4\xa5"}, {125188,"\xf0\x9e\xa4\xa6"},
+{125189,"\xf0\x9e\xa4\xa7"}, {125190,"\xf0\x9e\xa4\xa8"}, {125191,"\xf0\x9e\xa4\xa9"}, {125192,"\xf0\x9e\xa4\xaa"}, {125193,"\xf0\x9e\xa4\xab"}, {125194,"\xf0\x9e\xa4\xac"},
+{125195,"\xf0\x9e\xa4\xad"}, {125196,"\xf0\x9e\xa4\xae"}, {125197,"\xf0\x9e\xa4\xaf"}, {125198,"\xf0\x9e\xa4\xb0"}, {125199,"\xf0\x9e\xa4\xb1"}, {125200,"\xf0\x9e\xa4\xb2"},
+{125201,"\xf0\x9e\xa4\xb3"}, {125202,"\xf0\x9e\xa4\xb4"}, {125203,"\xf0\x9e\xa4\xb5"}, {125204,"\xf0\x9e\xa4\xb6"}, {125205,"\xf0\x9e\xa4\xb7"}, {125206,"\xf0\x9e\xa4\xb8"},
+{125207,"\xf0\x9e\xa4\xb9"}, {125208,"\xf0\x9e\xa4\xba"}, {125209,"\xf0\x9e\xa4\xbb"}, {125210,"\xf0\x9e\xa4\xbc"}, {125211,"\xf0\x9e\xa4\xbd"}, {125212,"\xf0\x9e\xa4\xbe"},
+{125213,"\xf0\x9e\xa4\xbf"}, {125214,"\xf0\x9e\xa5\x80"}, {125215,"\xf0\x9e\xa5\x81"}, {125216,"\xf0\x9e\xa5\x82"}, {125217,"\xf0\x9e\xa5\x83"},
+//--Autogenerated -- end of section automatically generated
+};
 
-class CaseConverter final : public ICaseConverter {
-	struct ConversionString {
-		char conversion[maxConversionLength+1]{};
-	};
-	// Conversions are initially store in a vector of structs but then decomposed into
-	// parallel arrays as that is about 10% faster to search.
-	struct CharacterConversion {
-		int character = 0;
-		ConversionString conversion;
-		// Empty case: NUL -> "".
-		CharacterConversion() noexcept = default;
-		CharacterConversion(int character_, std::string_view conversion_) noexcept : character(character_) {
-			assert(conversion_.length() <= maxConversionLength);
-			try {
-				// This can never fail as std::string_view::copy should only throw
-				// std::out_of_range if pos > size() and pos == 0 here
-				conversion_.copy(conversion.conversion, conversion_.length());
-			} catch (...) {
-				// Ignore any exception
-			}
+template <size_t N>
+constexpr bool SortedByCharacter(const CharacterConversion (&table)[N]) noexcept {
+	for (size_t i = 1; i < N; i++) {
+		if (table[i - 1].character >= table[i].character) {
+			return false;
 		}
-		bool operator<(const CharacterConversion &other) const noexcept {
-			return character < other.character;
-		}
-	};
-	using CharacterToConversion = std::vector<CharacterConversion>;
-	CharacterToConversion characterToConversion;
-	// The parallel arrays
-	std::vector<int> characters;
-	std::vector<ConversionString> conversions;
+	}
+	return true;
+}
 
+static_assert(SortedByCharacter(foldConversions));
+static_assert(SortedByCharacter(upperConversions));
+static_assert(SortedByCharacter(lowerConversions));
+
+class CaseConverter final : public ICaseConverter {
+	const CharacterConversion *first;
+	const CharacterConversion *last;
+	CaseConversion conversion;
 public:
-	CaseConverter() noexcept = default;
-	[[nodiscard]] bool Initialised() const noexcept {
-		return !characters.empty();
-	}
-	void Add(int character, std::string_view conversion_) {
-		characterToConversion.emplace_back(character, conversion_);
+	template <size_t N>
+	constexpr CaseConverter(const CharacterConversion (&table)[N], CaseConversion conversion_) noexcept :
+		first(table), last(table + N), conversion(conversion_) {
 	}
-	const char *Find(int character) {
-		const std::vector<int>::iterator it = std::lower_bound(characters.begin(), characters.end(), character);
-		if (it == characters.end())
-			return nullptr;
-		else if (*it == character)
-			return conversions[it - characters.begin()].conversion;
-		else
+	const char *Find(int character) const {
+		const CharacterConversion *it = std::lower_bound(first, last, character,
+			[](const CharacterConversion &chConv, int ch) noexcept {
+				return chConv.character < ch;
+			});
+		if (it == last || it->character != character)
 			return nullptr;
+		return it->conversion;
 	}
 	size_t CaseConvertString(char *converted, size_t sizeConverted, const char *mixed, size_t lenMixed) override {
 		size_t lenConverted = 0;
 		size_t mixedPos = 0;
 		unsigned char bytes[UTF8MaxBytes + 1]{};
 		while (mixedPos < lenMixed) {
+			// Runs of ASCII are converted many bytes at a time
+			const size_t lenASCII = UTF8AsciiPrefix(std::string_view(mixed + mixedPos, lenMixed - mixedPos));
+			if (lenASCII > 0) {
+				if (lenConverted + lenASCII >= sizeConverted)
+					return 0;
+				CaseConvertASCII(converted + lenConverted, mixed + mixedPos, lenASCII, conversion);
+				lenConverted += lenASCII;
+				mixedPos += lenASCII;
+				continue;
+			}
 			const unsigned char leadByte = mixed[mixedPos];
 			const char *caseConverted = nullptr;
 			size_t lenMixedChar = 1;
-			if (UTF8IsAscii(leadByte)) {
-				caseConverted = Find(leadByte);
-			} else {
-				bytes[0] = leadByte;
-				const int widthCharBytes = UTF8BytesOfLead[leadByte];
-				for (int b=1; b<widthCharBytes; b++) {
-					bytes[b] = (mixedPos+b < lenMixed) ? mixed[mixedPos+b] : 0;
-				}
-				const int classified = UTF8Classify(bytes, widthCharBytes);
-				if (!(classified & UTF8MaskInvalid)) {
-					// valid UTF-8
-					lenMixedChar = classified & UTF8MaskWidth;
-					const int character = UnicodeFromUTF8(bytes);
-					caseConverted = Find(character);
-				}
+			bytes[0] = leadByte;
+			const int widthCharBytes = UTF8BytesOfLead[leadByte];
+			for (int b=1; b<widthCharBytes; b++) {
+				bytes[b] = (mixedPos+b < lenMixed) ? mixed[mixedPos+b] : 0;
+			}
+			const int classified = UTF8Classify(bytes, widthCharBytes);
+			if (!(classified & UTF8MaskInvalid)) {
+				// valid UTF-8
+				lenMixedChar = classified & UTF8MaskWidth;
+				const int character = UnicodeFromUTF8(bytes);
+				caseConverted = Find(character);
 			}
 			if (caseConverted) {
 				// Character has a conversion so copy that conversion in
@@ -671,100 +890,18 @@ public:
 		}
 		return lenConverted;
 	}
-	void FinishedAdding() {
-		std::sort(characterToConversion.begin(), characterToConversion.end());
-		characters.reserve(characterToConversion.size());
-		conversions.reserve(characterToConversion.size());
-		for (const CharacterConversion &chConv : characterToConversion) {
-			characters.push_back(chConv.character);
-			conversions.push_back(chConv.conversion);
-		}
-		// Empty the original calculated data completely
-		CharacterToConversion().swap(characterToConversion);
-	}
-	void AddSymmetric(CaseConversion conversion, int lower, int upper);
-	void SetupConversions(CaseConversion conversion);
 };
 
-CaseConverter caseConvList[3];
-
-void CaseConverter::AddSymmetric(CaseConversion conversion, int lower, int upper) {
-	const int character = (conversion == CaseConversion::upper) ? lower : upper;
-	const int source = (conversion == CaseConversion::upper) ? upper : lower;
-	char converted[maxConversionLength+1]{};
-	UTF8FromUTF32Character(source, converted);
-	Add(character, converted);
-}
-
-// Return the next '|' separated field and remove from view.
-std::string_view NextField(std::string_view &view) {
-	const size_t separatorPosition = view.find_first_of('|');
-	const std::string_view field = view.substr(0, separatorPosition);
-	if (separatorPosition == std::string_view::npos) {
-		// Reached the end so empty the view
-		view.remove_prefix(view.length());
-	} else {
-		// Remove the '|' from the view as well as the field
-		view.remove_prefix(separatorPosition + 1);
-	}
-	return field;
-}
-
-void CaseConverter::SetupConversions(CaseConversion conversion) {
-	// First initialize for the symmetric ranges
-	for (size_t i=0; i<std::size(symmetricCaseConversionRanges);) {
-		const int lower = symmetricCaseConversionRanges[i++];
-		const int upper = symmetricCaseConversionRanges[i++];
-		const int length = symmetricCaseConversionRanges[i++];
-		const int pitch = symmetricCaseConversionRanges[i++];
-		for (int j=0; j<length*pitch; j+=pitch) {
-			AddSymmetric(conversion, lower+j, upper+j);
-		}
-	}
-	// Add the symmetric singletons
-	for (size_t i=0; i<std::size(symmetricCaseConversions);) {
-		const int lower = symmetricCaseConversions[i++];
-		const int upper = symmetricCaseConversions[i++];
-		AddSymmetric(conversion, lower, upper);
-	}
-	// Add the complex cases
-	std::string_view sComplex = complexCaseConversions;
-	while (!sComplex.empty()) {
-		const std::string_view originUTF8 = NextField(sComplex);
-		const std::string_view foldedUTF8 = NextField(sComplex);
-		const std::string_view upperUTF8 = NextField(sComplex);
-		const std::string_view lowerUTF8 = NextField(sComplex);
-
-		std::string_view converted;
-		switch (conversion) {
-		case CaseConversion::fold:
-			converted = foldedUTF8;
-			break;
-		case CaseConversion::upper:
-			converted = upperUTF8;
-			break;
-		case CaseConversion::lower:
-		default:
-			converted = lowerUTF8;
-			break;
-		}
-		if (!converted.empty()) {
-			const int character = UnicodeFromUTF8(originUTF8);
-			Add(character, converted);
-		}
-	}
-
-	FinishedAdding();
-}
+CaseConverter caseConvList[] = {
+	{ foldConversions, CaseConversion::fold },
+	{ upperConversions, CaseConversion::upper },
+	{ lowerConversions, CaseConversion::lower },
+};
 
-CaseConverter *ConverterForConversion(CaseConversion conversion) {
+CaseConverter *ConverterForConversion(CaseConversion conversion) noexcept {
 	const unsigned index = static_cast<unsigned>(conversion);
 	assert(index < std::size(caseConvList));
-	CaseConverter *pCaseConv = &caseConvList[index];
-	if (!pCaseConv->Initialised()) {
-		pCaseConv->SetupConversions(conversion);
-	}
-	return pCaseConv;
+	return &caseConvList[index];
 }
 
 }
@@ -776,7 +913,7 @@ ICaseConverter *ConverterFor(CaseConversion conversion) {
 }
 
 const char *CaseConvert(int character, CaseConversion conversion) {
-	CaseConverter *pCaseConv = ConverterForConversion(conversion);
+	const CaseConverter *pCaseConv = ConverterForConversion(conversion);
 	return pCaseConv->Find(character);
 }
 
@@ -793,4 +930,25 @@ std::string CaseConvertString(const std::string &s, CaseConversion conversion) {
 	return retMapped;
 }
 
+void CaseConvertASCII(char *converted, const char *mixed, size_t length, CaseConversion conversion) noexcept {
+	// Only the letters of one case change: others, including non-ASCII bytes, are copied
+	const char first = (conversion == CaseConversion::upper) ? 'a' : 'A';
+	size_t i = 0;
+#if defined(HYPERION_SSE2)
+	// Signed comparisons so bytes over 0x7F are below the range
+	const __m128i beforeFirst = _mm_set1_epi8(static_cast<char>(first - 1));
+	const __m128i afterLast = _mm_set1_epi8(static_cast<char>(first + 26));
+	const __m128i caseBit = _mm_set1_epi8(0x20);
+	for (; i + 16 <= length; i += 16) {
+		const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mixed + i));
+		const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(input, beforeFirst), _mm_cmplt_epi8(input, afterLast));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(converted + i), _mm_xor_si128(input, _mm_and_si128(letters, caseBit)));
+	}
+#endif
+	for (; i < length; i++) {
+		const char ch = mixed[i];
+		converted[i] = (ch >= first && ch < first + 26) ? static_cast<char>(ch ^ 0x20) : ch;
+	}
+}
+
 }
@@ -39,4 +39,8 @@ size_t CaseConvertString(char *converted, size_t sizeConverted, const char *mixe
 // Converts a mixed case string using a particular conversion.
 std::string CaseConvertString(const std::string &s, CaseConversion conversion);
 
+// Converts the ASCII letters in a string of length bytes to lower case for fold and lower or to
+// upper case for upper. Other bytes are copied unchanged. converted may be the same as mixed.
+void CaseConvertASCII(char *converted, const char *mixed, size_t length, CaseConversion conversion) noexcept;
+
 }
\ No newline at end of file
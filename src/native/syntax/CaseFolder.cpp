@@ -5,13 +5,19 @@
 // Copyright 1998-2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstddef>
+
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
 #include "CharacterType.hpp"
 #include "CaseFolder.hpp"
 #include "CaseConvert.hpp"
+#include "UniConversion.hpp"
+#include "UTF8Scan.hpp"
 
 using namespace Hyperion::Internal;
 
@@ -23,7 +29,7 @@ constexpr unsigned char IndexFromChar(char ch) {
 
 }
 
-CaseFolderTable::CaseFolderTable() noexcept : mapping{}  {
+CaseFolderTable::CaseFolderTable() noexcept : mapping{}, standardASCII(true)  {
 	StandardASCII();
 }
 
@@ -31,7 +37,19 @@ size_t CaseFolderTable::Fold(char *folded, size_t sizeFolded, const char *mixed,
 	if (lenMixed > sizeFolded) {
 		return 0;
 	}
-	for (size_t i=0; i<lenMixed; i++) {
+	size_t i = 0;
+	if (standardASCII) {
+		// Fold runs of ASCII many bytes at a time with the table only used for other bytes
+		while (i < lenMixed) {
+			const size_t lenASCII = UTF8AsciiPrefix(std::string_view(mixed + i, lenMixed - i));
+			CaseConvertASCII(folded + i, mixed + i, lenASCII, CaseConversion::fold);
+			i += lenASCII;
+			for (; i < lenMixed && !UTF8IsAscii(mixed[i]); i++) {
+				folded[i] = mapping[IndexFromChar(mixed[i])];
+			}
+		}
+	}
+	for (; i<lenMixed; i++) {
 		folded[i] = mapping[IndexFromChar(mixed[i])];
 	}
 	return lenMixed;
@@ -39,12 +57,16 @@ size_t CaseFolderTable::Fold(char *folded, size_t sizeFolded, const char *mixed,
 
 void CaseFolderTable::SetTranslation(char ch, char chTranslation) noexcept {
 	mapping[IndexFromChar(ch)] = chTranslation;
+	if (UTF8IsAscii(ch) && chTranslation != MakeLowerCase(ch)) {
+		standardASCII = false;
+	}
 }
 
 void CaseFolderTable::StandardASCII() noexcept {
 	for (size_t iChar=0; iChar<std::size(mapping); iChar++) {
 		mapping[iChar] = static_cast<char>(MakeLowerCase(iChar));
 	}
+	standardASCII = true;
 }
 
 CaseFolderUnicode::CaseFolderUnicode() {
@@ -23,6 +23,7 @@ public:
 class CaseFolderTable : public CaseFolder {
 protected:
 	char mapping[256];
+	bool standardASCII;	// ASCII maps as for StandardASCII so can be folded many bytes at a time
 public:
 	CaseFolderTable() noexcept;
 	size_t Fold(char *folded, size_t sizeFolded, const char *mixed, size_t lenMixed) override;
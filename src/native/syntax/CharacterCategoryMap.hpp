@@ -30,19 +30,13 @@ bool IsXidContinue(int character) noexcept;
 
 class CharacterCategoryMap {
 private:
-	std::vector<unsigned char> dense;
+	int optimizedSize = 256;
 public:
-	CharacterCategoryMap();
 	CharacterCategory CategoryFor(int character) const noexcept {
-		if (static_cast<size_t>(character) < dense.size()) {
-			return static_cast<CharacterCategory>(dense[character]);
-		} else {
-			// binary search through ranges
-			return CategoriseCharacter(character);
-		}
+		return CategoriseCharacter(character);
 	}
 	int Size() const noexcept;
-	void Optimize(int countCharacters);
+	void Optimize(int countCharacters) noexcept;
 };
 
 }
@@ -0,0 +1,360 @@
+// Hyperion source code edit control
+/** @file UTF8Scan.cpp
+ ** Validate and count UTF-8 text many bytes at a time.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <string_view>
+#include <algorithm>
+
+#include "../platform/CpuFeatures.hpp"
+
+#if defined(HYPERION_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(HYPERION_AVX2)
+#include <immintrin.h>
+#endif
+
+#include "UniConversion.hpp"
+#include "UTF8Scan.hpp"
+
+namespace Hyperion::Internal {
+
+// Silence 'magic' number warning as UTF-8 needs to distinguish byte values and byte value ranges.
+// NOLINTBEGIN(*-magic-numbers)
+
+namespace {
+
+// After a vector kernel stops, characters are checked one at a time for at least this many
+// bytes so the scan moves past whatever stopped the kernel before trying it again.
+constexpr size_t scalarSpan = 40;
+
+size_t AsciiPrefixScalar(const unsigned char *s, size_t length) noexcept {
+	size_t i = 0;
+	for (; i + 8 <= length; i += 8) {
+		uint64_t word = 0;
+		memcpy(&word, s + i, sizeof(word));
+		if (word & 0x8080808080808080ULL) {
+			break;
+		}
+	}
+	while (i < length && UTF8IsAscii(s[i])) {
+		i++;
+	}
+	return i;
+}
+
+UTF8Counts CountValidScalar(const unsigned char *s, size_t length) noexcept {
+	UTF8Counts counts;
+	for (size_t i = 0; i < length; i++) {
+		counts.characters += !UTF8IsTrailByte(s[i]);
+		counts.otherPlanes += s[i] >= 0xF0;
+	}
+	return counts;
+}
+
+// Bytes before position passed the vector checks apart from a character at the end that
+// may be incomplete or have an invalid lead. Returns the start of that character so it is
+// checked again, or position when the last character is ASCII or 4 bytes long.
+size_t BackToCharacterStart(const unsigned char *s, size_t position) noexcept {
+	for (size_t back = 1; back <= 3 && back <= position; back++) {
+		const unsigned char ch = s[position - back];
+		if (!UTF8IsTrailByte(ch)) {
+			return UTF8IsAscii(ch) ? position : position - back;
+		}
+	}
+	return position;
+}
+
+#if defined(HYPERION_SSE2)
+
+size_t AsciiPrefixSSE2(const unsigned char *s, size_t length) noexcept {
+	size_t i = 0;
+	for (; i + 64 <= length; i += 64) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 16));
+		const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 32));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 48));
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+			break;
+		}
+	}
+	for (; i + 16 <= length; i += 16) {
+		if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)))) {
+			break;
+		}
+	}
+	return i + AsciiPrefixScalar(s + i, length - i);
+}
+
+UTF8Counts CountValidSSE2(const unsigned char *s, size_t length) noexcept {
+	// Per byte counters are summed into 64-bit lanes before they can overflow
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i lastTrail = _mm_set1_epi8(static_cast<char>(0xBF));
+	const __m128i firstOtherPlanes = _mm_set1_epi8(static_cast<char>(0xF0));
+	__m128i totalCharacters = zero;
+	__m128i totalOtherPlanes = zero;
+	size_t i = 0;
+	while (i + 16 <= length) {
+		__m128i characters = zero;
+		__m128i otherPlanes = zero;
+		for (int block = 0; block < 255 && i + 16 <= length; block++, i += 16) {
+			const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+			// Signed comparison: ASCII and lead bytes are greater than 0xBF
+			characters = _mm_sub_epi8(characters, _mm_cmpgt_epi8(input, lastTrail));
+			otherPlanes = _mm_sub_epi8(otherPlanes, _mm_cmpeq_epi8(_mm_max_epu8(input, firstOtherPlanes), input));
+		}
+		totalCharacters = _mm_add_epi64(totalCharacters, _mm_sad_epu8(characters, zero));
+		totalOtherPlanes = _mm_add_epi64(totalOtherPlanes, _mm_sad_epu8(otherPlanes, zero));
+	}
+	uint64_t sums[2] {};
+	UTF8Counts counts = CountValidScalar(s + i, length - i);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(sums), totalCharacters);
+	counts.characters += static_cast<size_t>(sums[0] + sums[1]);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(sums), totalOtherPlanes);
+	counts.otherPlanes += static_cast<size_t>(sums[0] + sums[1]);
+	return counts;
+}
+
+#endif
+
+#if defined(HYPERION_AVX2)
+
+HYPERION_TARGET_AVX2
+size_t AsciiPrefixAVX2(const unsigned char *s, size_t length) noexcept {
+	size_t i = 0;
+	for (; i + 64 <= length; i += 64) {
+		const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+		const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i + 32));
+		if (_mm256_movemask_epi8(_mm256_or_si256(a, b))) {
+			break;
+		}
+	}
+	for (; i + 32 <= length; i += 32) {
+		if (_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i)))) {
+			break;
+		}
+	}
+	return i + AsciiPrefixScalar(s + i, length - i);
+}
+
+// The bytes of input preceded by the last N bytes of previous
+template <int N>
+HYPERION_TARGET_AVX2
+__m256i Previous(__m256i input, __m256i previous) noexcept {
+	return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+}
+
+HYPERION_TARGET_AVX2
+__m256i Table(char b0, char b1, char b2, char b3, char b4, char b5, char b6, char b7,
+	char b8, char b9, char b10, char b11, char b12, char b13, char b14, char b15) noexcept {
+	return _mm256_broadcastsi128_si256(_mm_setr_epi8(b0, b1, b2, b3, b4, b5, b6, b7,
+		b8, b9, b10, b11, b12, b13, b14, b15));
+}
+
+HYPERION_TARGET_AVX2
+__m256i HighNibbles(__m256i input) noexcept {
+	return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+}
+
+// Validation after "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser
+// and Daniel Lemire: each error is recognised from the high and low nibbles of a byte and the
+// high nibble of the byte after it by intersecting three 16 entry tables. The expected
+// continuation bytes of 3 and 4 byte sequences are checked separately.
+// Returns the length of a valid prefix that ends at a character boundary.
+HYPERION_TARGET_AVX2
+size_t ValidPrefixAVX2(const unsigned char *s, size_t length) noexcept {
+	constexpr char tooShort = 1 << 0;	// 11______ 0_______ or 11______ 11______
+	constexpr char tooLong = 1 << 1;	// 0_______ 10______
+	constexpr char overlong3 = 1 << 2;	// 11100000 100_____
+	constexpr char tooLarge = 1 << 3;	// 11110100 1001____ or 11110100 101_____ or 11110101 ...
+	constexpr char surrogate = 1 << 4;	// 11101101 101_____
+	constexpr char overlong2 = 1 << 5;	// 1100000_ 10______
+	constexpr char tooLarge1000 = 1 << 6;	// 11110101 1000____ or 1111011_ 1000____ or 11111___ 1000____
+	constexpr char overlong4 = 1 << 6;	// 11110000 1000____
+	constexpr char twoConts = static_cast<char>(1 << 7);	// 10______ 10______
+	constexpr char carry = tooShort | tooLong | twoConts;
+
+	const __m256i byte1High = Table(
+		// 0_______ ________ ASCII
+		tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+		// 10______ ________ continuation
+		twoConts, twoConts, twoConts, twoConts,
+		// 1100____ ________ two byte lead
+		tooShort | overlong2,
+		// 1101____ ________ two byte lead
+		tooShort,
+		// 1110____ ________ three byte lead
+		tooShort | overlong3 | surrogate,
+		// 1111____ ________ four byte lead
+		tooShort | tooLarge | tooLarge1000 | overlong4);
+	const __m256i byte1Low = Table(
+		carry | overlong3 | overlong2 | overlong4,	// ____0000
+		carry | overlong2,	// ____0001
+		carry, carry,	// ____001_
+		carry | tooLarge,	// ____0100
+		carry | tooLarge | tooLarge1000,	// ____0101
+		carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,	// ____011_
+		carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,	// ____1___
+		carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+		carry | tooLarge | tooLarge1000,
+		carry | tooLarge | tooLarge1000 | surrogate,	// ____1101
+		carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000);
+	const __m256i byte2High = Table(
+		// ________ 0_______ ASCII
+		tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+		// ________ 1000____
+		tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+		// ________ 1001____
+		tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+		// ________ 101_____
+		tooLong | overlong2 | twoConts | surrogate | tooLarge,
+		tooLong | overlong2 | twoConts | surrogate | tooLarge,
+		// ________ 11______
+		tooShort, tooShort, tooShort, tooShort);
+	// Bytes at the end of a block that must be followed by continuation bytes
+	const __m256i lastComplete = _mm256_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i byteBF = _mm256_set1_epi8(static_cast<char>(0xBF));
+
+	__m256i previous = _mm256_setzero_si256();
+	__m256i incomplete = _mm256_setzero_si256();
+	size_t position = 0;
+	for (; position + 32 <= length; position += 32) {
+		const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + position));
+		__m256i error = incomplete;
+		if (_mm256_movemask_epi8(input) == 0) {
+			incomplete = _mm256_setzero_si256();
+		} else {
+			const __m256i prev1 = Previous<1>(input, previous);
+			const __m256i prev2 = Previous<2>(input, previous);
+			const __m256i prev3 = Previous<3>(input, previous);
+			const __m256i special = _mm256_and_si256(_mm256_and_si256(
+				_mm256_shuffle_epi8(byte1High, HighNibbles(prev1)),
+				_mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, nibble))),
+				_mm256_shuffle_epi8(byte2High, HighNibbles(input)));
+			const __m256i must23 = _mm256_or_si256(
+				_mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+				_mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+			error = _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80))), special);
+			// UTF8Classify also rejects the noncharacters U+FDD0..U+FDEF and U+nFFFE, U+nFFFF
+			// so blocks that may contain them are left for the scalar check.
+			const __m256i endFFFE = _mm256_and_si256(_mm256_cmpeq_epi8(prev1, byteBF),
+				_mm256_cmpeq_epi8(_mm256_or_si256(input, _mm256_set1_epi8(1)), byteBF));
+			const __m256i inFDD0 = _mm256_and_si256(_mm256_cmpeq_epi8(prev2, _mm256_set1_epi8(static_cast<char>(0xEF))),
+				_mm256_cmpeq_epi8(prev1, _mm256_set1_epi8(static_cast<char>(0xB7))));
+			error = _mm256_or_si256(error, _mm256_or_si256(endFFFE, inFDD0));
+			incomplete = _mm256_subs_epu8(input, lastComplete);
+		}
+		if (!_mm256_testz_si256(error, error)) {
+			break;
+		}
+		previous = input;
+	}
+	return BackToCharacterStart(s, position);
+}
+
+HYPERION_TARGET_AVX2
+UTF8Counts CountValidAVX2(const unsigned char *s, size_t length) noexcept {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i lastTrail = _mm256_set1_epi8(static_cast<char>(0xBF));
+	const __m256i firstOtherPlanes = _mm256_set1_epi8(static_cast<char>(0xF0));
+	__m256i totalCharacters = zero;
+	__m256i totalOtherPlanes = zero;
+	size_t i = 0;
+	while (i + 32 <= length) {
+		__m256i characters = zero;
+		__m256i otherPlanes = zero;
+		for (int block = 0; block < 255 && i + 32 <= length; block++, i += 32) {
+			const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+			characters = _mm256_sub_epi8(characters, _mm256_cmpgt_epi8(input, lastTrail));
+			otherPlanes = _mm256_sub_epi8(otherPlanes, _mm256_cmpeq_epi8(_mm256_max_epu8(input, firstOtherPlanes), input));
+		}
+		totalCharacters = _mm256_add_epi64(totalCharacters, _mm256_sad_epu8(characters, zero));
+		totalOtherPlanes = _mm256_add_epi64(totalOtherPlanes, _mm256_sad_epu8(otherPlanes, zero));
+	}
+	uint64_t sums[4] {};
+	UTF8Counts counts = CountValidScalar(s + i, length - i);
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), totalCharacters);
+	counts.characters += static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), totalOtherPlanes);
+	counts.otherPlanes += static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+	return counts;
+}
+
+#endif
+
+size_t AsciiPrefix(const unsigned char *s, size_t length) noexcept {
+#if defined(HYPERION_AVX2)
+	if (CpuHasAVX2()) {
+		return AsciiPrefixAVX2(s, length);
+	}
+#endif
+#if defined(HYPERION_SSE2)
+	return AsciiPrefixSSE2(s, length);
+#else
+	return AsciiPrefixScalar(s, length);
+#endif
+}
+
+}
+
+size_t UTF8AsciiPrefix(std::string_view svu8) noexcept {
+	return AsciiPrefix(reinterpret_cast<const unsigned char *>(svu8.data()), svu8.length());
+}
+
+size_t UTF8ValidPrefix(std::string_view svu8) noexcept {
+	const unsigned char *s = reinterpret_cast<const unsigned char *>(svu8.data());
+	const size_t length = svu8.length();
+#if defined(HYPERION_AVX2)
+	const bool validateVector = CpuHasAVX2();
+#endif
+	size_t position = 0;
+	while (position < length) {
+		// Vector kernels skip text that is certainly valid: without AVX2 that is only ASCII
+#if defined(HYPERION_AVX2)
+		if (validateVector) {
+			position += ValidPrefixAVX2(s + position, length - position);
+		} else
+#endif
+		{
+			position += AsciiPrefix(s + position, length - position);
+		}
+		const size_t limit = std::min(length, position + scalarSpan);
+		while (position < limit) {
+			const int utf8Status = UTF8Classify(s + position, length - position);
+			if (utf8Status & UTF8MaskInvalid) {
+				return position;
+			}
+			position += utf8Status & UTF8MaskWidth;
+		}
+	}
+	return position;
+}
+
+UTF8Counts UTF8CountValid(std::string_view svu8) noexcept {
+	const unsigned char *s = reinterpret_cast<const unsigned char *>(svu8.data());
+#if defined(HYPERION_AVX2)
+	if (CpuHasAVX2()) {
+		return CountValidAVX2(s, svu8.length());
+	}
+#endif
+#if defined(HYPERION_SSE2)
+	return CountValidSSE2(s, svu8.length());
+#else
+	return CountValidScalar(s, svu8.length());
+#endif
+}
+
+// NOLINTEND(*-magic-numbers)
+
+}
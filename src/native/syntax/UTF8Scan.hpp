@@ -0,0 +1,29 @@
+// Hyperion source code edit control
+/** @file UTF8Scan.hpp
+ ** Validate and count UTF-8 text many bytes at a time.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/// Length of the initial run of ASCII bytes.
+size_t UTF8AsciiPrefix(std::string_view svu8) noexcept;
+
+/// Length of the initial run of complete characters that UTF8Classify accepts as valid.
+/// The whole length when svu8 is valid.
+size_t UTF8ValidPrefix(std::string_view svu8) noexcept;
+
+struct UTF8Counts {
+	size_t characters = 0;
+	size_t otherPlanes = 0;	///< Characters outside the Basic Multilingual Plane that need 2 UTF-16 code units
+	size_t UTF16() const noexcept {
+		return characters + otherPlanes;
+	}
+};
+
+/// Count the characters of text that UTF8ValidPrefix found valid.
+UTF8Counts UTF8CountValid(std::string_view svu8) noexcept;
+
+}
@@ -12,6 +12,7 @@
 #include <string_view>
 
 #include "UniConversion.hpp"
+#include "UTF8Scan.hpp"
 
 namespace Hyperion::Internal {
 
@@ -138,12 +139,18 @@ void UTF8FromUTF32Character(int uch, char *putf) noexcept {
 
 size_t UTF16Length(std::string_view svu8) noexcept {
 	size_t ulen = 0;
-	for (size_t i = 0; i< svu8.length();) {
-		const unsigned char ch = svu8[i];
-		const unsigned int byteCount = UTF8BytesOfLead[ch];
-		const unsigned int utf16Len = UTF16LengthFromUTF8ByteCount(byteCount);
-		i += byteCount;
-		ulen += (i > svu8.length()) ? 1 : utf16Len;
+	for (size_t i = 0; i < svu8.length();) {
+		// Count valid runs in bulk then step over an invalid character by its lead byte
+		const std::string_view valid = svu8.substr(i, UTF8ValidPrefix(svu8.substr(i)));
+		ulen += UTF8CountValid(valid).UTF16();
+		i += valid.length();
+		if (i < svu8.length()) {
+			const unsigned char ch = svu8[i];
+			const unsigned int byteCount = UTF8BytesOfLead[ch];
+			const unsigned int utf16Len = UTF16LengthFromUTF8ByteCount(byteCount);
+			i += byteCount;
+			ulen += (i > svu8.length()) ? 1 : utf16Len;
+		}
 	}
 	return ulen;
 }
@@ -210,10 +217,14 @@ size_t UTF16FromUTF8(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
 size_t UTF32Length(std::string_view svu8) noexcept {
 	size_t ulen = 0;
 	for (size_t i = 0; i < svu8.length();) {
-		const unsigned char ch = svu8[i];
-		const unsigned int byteCount = UTF8BytesOfLead[ch];
-		i += byteCount;
-		ulen++;
+		const std::string_view valid = svu8.substr(i, UTF8ValidPrefix(svu8.substr(i)));
+		ulen += UTF8CountValid(valid).characters;
+		i += valid.length();
+		if (i < svu8.length()) {
+			const unsigned char ch = svu8[i];
+			i += UTF8BytesOfLead[ch];
+			ulen++;
+		}
 	}
 	return ulen;
 }
@@ -419,18 +430,7 @@ int UTF8DrawBytes(const char *s, size_t len) noexcept {
 }
 
 bool UTF8IsValid(std::string_view svu8) noexcept {
-	const char *s = svu8.data();
-	size_t remaining = svu8.length();
-	while (remaining > 0) {
-		const int utf8Status = UTF8Classify(s, remaining);
-		if (utf8Status & UTF8MaskInvalid) {
-			return false;
-		}
-		const int lenChar = utf8Status & UTF8MaskWidth;
-		s += lenChar;
-		remaining -= lenChar;
-	}
-	return true;
+	return UTF8ValidPrefix(svu8) == svu8.length();
 }
 
 // Replace invalid bytes in UTF-8 with the replacement character
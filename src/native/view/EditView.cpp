@@ -60,6 +60,7 @@
 #include "PositionCache.hpp"
 #include "MarginView.hpp"
 #include "EditView.hpp"
+#include "ElasticTabstops.hpp"
 #include "Indicator.hpp"
 #include "LineMarker.hpp"
 #include "Style.hpp"
@@ -228,6 +229,9 @@ unsigned int EditView::GetLayoutThreads() const noexcept {
 
 void EditView::ClearAllTabstops() noexcept {
 	ldTabstops.reset();
+	if (elasticTabstops) {
+		elasticTabstops->ChangedAll();
+	}
 }
 
 XYPOSITION EditView::NextTabstopPos(Sci::Line line, XYPOSITION x, XYPOSITION tabWidth) const noexcept {
@@ -268,6 +272,59 @@ void EditView::LinesAddedOrRemoved(Sci::Line lineOfPos, Sci::Line linesAdded) {
 			}
 		}
 	}
+	if (elasticTabstops) {
+		if (linesAdded > 0) {
+			elasticTabstops->InsertLines(lineOfPos, linesAdded);
+		} else {
+			elasticTabstops->RemoveLines(lineOfPos, -linesAdded);
+		}
+	}
+}
+
+// Padding in pixels after the widest cell of each column, 0 turns elastic tabstops off
+// and drops all tabstops.
+void EditView::SetElasticTabstops(int padding) {
+	if (padding <= 0) {
+		if (elasticTabstops) {
+			elasticTabstops.reset();
+			ldTabstops.reset();
+		}
+	} else if (elasticTabstops) {
+		elasticTabstops->padding = padding;
+		elasticTabstops->ChangedAll();
+	} else {
+		elasticTabstops = std::make_unique<ElasticTabstops>(padding);
+	}
+}
+
+int EditView::GetElasticTabstops() const noexcept {
+	return elasticTabstops ? elasticTabstops->padding : 0;
+}
+
+void EditView::ElasticTabstopsChanged(Sci::Line lineStart, Sci::Line lineEnd) noexcept {
+	if (elasticTabstops) {
+		elasticTabstops->Changed(lineStart, lineEnd);
+	}
+}
+
+bool EditView::ElasticTabstopsNeedUpdate() const noexcept {
+	return elasticTabstops && elasticTabstops->NeedsUpdate();
+}
+
+// Returns the lines whose tabstops moved. Their layouts are discarded.
+Range EditView::UpdateElasticTabstops(Surface *surface, const EditModel &model, const ViewStyle &vstyle) {
+	if (!ElasticTabstopsNeedUpdate()) {
+		return Range(0);
+	}
+	if (!ldTabstops) {
+		ldTabstops = std::make_unique<LineTabstops>();
+	}
+	const Range linesMoved = elasticTabstops->Update(surface, model, vstyle, posCache.get(), *ldTabstops,
+		tabWidthMinimumPixels, maxLayoutThreads);
+	if (!linesMoved.Empty()) {
+		llc.Invalidate(LineLayout::ValidLevel::invalid);
+	}
+	return linesMoved;
 }
 
 void EditView::DropGraphics() noexcept {
@@ -43,6 +43,7 @@ typedef void (*DrawTabArrowFn)(Surface *surface, PRectangle rcTab, int ymid,
 	const ViewStyle &vsDraw, Stroke stroke);
 
 class LineTabstops;
+class ElasticTabstops;
 
 /**
 * EditView draws the main text area.
@@ -51,6 +52,7 @@ class EditView {
 public:
 	PrintParameters printParameters;
 	std::unique_ptr<LineTabstops> ldTabstops;
+	std::unique_ptr<ElasticTabstops> elasticTabstops;
 	int tabWidthMinimumPixels;
 
 	bool drawOverstrikeCaret; // used by the curses platform
@@ -111,6 +113,11 @@ public:
 	bool AddTabstop(Sci::Line line, int x);
 	int GetNextTabstop(Sci::Line line, int x) const noexcept;
 	void LinesAddedOrRemoved(Sci::Line lineOfPos, Sci::Line linesAdded);
+	void SetElasticTabstops(int padding);
+	int GetElasticTabstops() const noexcept;
+	void ElasticTabstopsChanged(Sci::Line lineStart, Sci::Line lineEnd) noexcept;
+	bool ElasticTabstopsNeedUpdate() const noexcept;
+	Range UpdateElasticTabstops(Surface *surface, const EditModel &model, const ViewStyle &vstyle);
 
 	void DropGraphics() noexcept;
 	void RefreshPixMaps(Surface *surfaceWindow, const ViewStyle &vsDraw);
@@ -0,0 +1,349 @@
+// Hyperion source code edit control
+/** @file ElasticTabstops.cpp
+ ** Place tab stops so that the cells of a column line up over consecutive lines.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+#include <cmath>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <forward_list>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <future>
+
+#include "../include/HyperionTypes.hpp"
+#include "../include/HyperionMessages.hpp"
+#include "../include/HyperionStructures.hpp"
+#include "../include/ILoader.hpp"
+#include "../include/ILexer.hpp"
+#include "../platform/Debugging.hpp"
+#include "../platform/Geometry.hpp"
+#include "../platform/Platform.hpp"
+#include "../syntax/CharacterType.hpp"
+#include "../syntax/CharacterCategoryMap.hpp"
+#include "../platform/Position.hpp"
+#include "../syntax/UniqueString.hpp"
+#include "../core/SplitVector.hpp"
+#include "../core/Partitioning.hpp"
+#include "../core/RunStyles.hpp"
+#include "../core/ContractionState.hpp"
+#include "../core/CellBuffer.hpp"
+#include "../core/PerLine.hpp"
+#include "../core/KeyMap.hpp"
+#include "../syntax/CharClassify.hpp"
+#include "../syntax/CaseFolder.hpp"
+#include "../core/Document.hpp"
+#include "../core/Selection.hpp"
+#include "../platform/ElapsedPeriod.hpp"
+#include "../core/EditModel.hpp"
+
+#include "PositionCache.hpp"
+#include "Style.hpp"
+#include "ViewStyle.hpp"
+#include "ElasticTabstops.hpp"
+
+using namespace Hyperion;
+
+namespace Hyperion::Internal {
+
+namespace {
+
+// Fewer changed lines than this are measured on the calling thread.
+constexpr Sci::Line linesToMeasureInParallel = 0x1000;
+
+struct ColumnBlock {
+	Sci::Line end;
+	int widest;
+};
+
+// Buffers reused between lines measured on one thread.
+struct LineText {
+	std::string chars;
+	std::vector<unsigned char> styles;
+	std::vector<XYPOSITION> positions;
+};
+
+std::unique_ptr<std::vector<int>> MeasureCells(Surface *surface, const Document *pdoc, const ViewStyle &vstyle,
+	IPositionCache *pCache, Sci::Line line, LineText &text, bool multiThreaded) {
+	const Sci::Position lineStart = pdoc->LineStart(line);
+	const size_t length = pdoc->LineEnd(line) - lineStart;
+	text.chars.resize(length);
+	pdoc->GetCharRange(text.chars.data(), lineStart, length);
+	const size_t lastTab = text.chars.rfind('\t');
+	if (lastTab == std::string::npos) {
+		return {};
+	}
+	text.styles.resize(lastTab);
+	pdoc->GetStyleRange(text.styles.data(), lineStart, lastTab);
+	if (text.positions.size() < lastTab) {
+		text.positions.resize(lastTab);
+	}
+
+	const bool unicode = CpUtf8 == pdoc->dbcsCodePage;
+	const std::string_view sv(text.chars);
+	std::unique_ptr<std::vector<int>> widths = std::make_unique<std::vector<int>>();
+	size_t cellStart = 0;
+	while (cellStart <= lastTab) {
+		const size_t tab = sv.find('\t', cellStart);
+		// Each run of one style is measured separately, as when laying out the line
+		XYPOSITION width = 0.0;
+		size_t runStart = cellStart;
+		while (runStart < tab) {
+			const unsigned char style = text.styles[runStart];
+			size_t runEnd = runStart + 1;
+			while ((runEnd < tab) && (text.styles[runEnd] == style)) {
+				runEnd++;
+			}
+			pCache->MeasureWidths(surface, vstyle, style, unicode, sv.substr(runStart, runEnd - runStart),
+				text.positions.data(), multiThreaded);
+			width += text.positions[runEnd - runStart - 1];
+			runStart = runEnd;
+		}
+		widths->push_back(static_cast<int>(std::ceil(width)));
+		cellStart = tab + 1;
+	}
+	return widths;
+}
+
+}
+
+ElasticTabstops::ElasticTabstops(int padding_) :
+	changedStart(0), changedEnd(0), changedAll(true), linesAddedOrRemoved(true), padding(padding_) {
+}
+
+bool ElasticTabstops::HasCells(Sci::Line line) const noexcept {
+	return static_cast<bool>(cells[line]);
+}
+
+void ElasticTabstops::Measure(Surface *surface, const EditModel &model, const ViewStyle &vstyle, IPositionCache *pCache,
+	Sci::Line lineStart, Sci::Line lineEnd, unsigned int maxThreads) {
+	const Sci::Line lines = lineEnd - lineStart;
+	size_t threads = std::min<size_t>(lines / linesToMeasureInParallel + 1, maxThreads);
+	if (!surface->SupportsFeature(Supports::ThreadSafeMeasureWidths)) {
+		threads = 1;
+	}
+	const bool multiThreaded = threads > 1;
+	const std::launch policy = multiThreaded ? std::launch::async : std::launch::deferred;
+
+	std::atomic<Sci::Line> nextLine = lineStart;
+	std::vector<std::future<void>> futures;
+	for (size_t th = 0; th < threads; th++) {
+		futures.push_back(std::async(policy, [this, surface, &model, &vstyle, pCache, &nextLine, lineEnd, multiThreaded]() {
+			LineText text;
+			while (true) {
+				const Sci::Line line = nextLine.fetch_add(1, std::memory_order_acq_rel);
+				if (line >= lineEnd) {
+					break;
+				}
+				// Each line is written by one thread and the vector is not resized here
+				cells[line] = MeasureCells(surface, model.pdoc, vstyle, pCache, line, text, multiThreaded);
+			}
+		}));
+	}
+	for (std::future<void> &f : futures) {
+		f.wait();
+	}
+	for (std::future<void> &f : futures) {
+		f.get();
+	}
+}
+
+void ElasticTabstops::InsertLines(Sci::Line line, Sci::Line lines) {
+	if (changedAll || (line > cells.Length())) {
+		return;
+	}
+	cells.InsertEmpty(line, lines);
+	linesAddedOrRemoved = true;
+	if (changedStart >= line) {
+		changedStart += lines;
+	}
+	if (changedEnd > line) {
+		changedEnd += lines;
+	}
+	Changed(line, line + lines);
+}
+
+void ElasticTabstops::RemoveLines(Sci::Line line, Sci::Line lines) {
+	if (changedAll || (line + lines > cells.Length())) {
+		return;
+	}
+	for (Sci::Line lineRemoved = line; lineRemoved < line + lines; lineRemoved++) {
+		cells[lineRemoved].reset();
+	}
+	cells.DeleteRange(line, lines);
+	linesAddedOrRemoved = true;
+	const auto moveForRemoval = [line, lines](Sci::Line &lineMoved) noexcept {
+		if (lineMoved >= line + lines) {
+			lineMoved -= lines;
+		} else if (lineMoved > line) {
+			lineMoved = line;
+		}
+	};
+	moveForRemoval(changedStart);
+	moveForRemoval(changedEnd);
+	// The lines on either side of the removal may now be in one block
+	Changed(line, line + 1);
+}
+
+void ElasticTabstops::Changed(Sci::Line lineStart, Sci::Line lineEnd) noexcept {
+	if (changedStart >= changedEnd) {
+		changedStart = lineStart;
+		changedEnd = lineEnd;
+	} else {
+		changedStart = std::min(changedStart, lineStart);
+		changedEnd = std::max(changedEnd, lineEnd);
+	}
+}
+
+void ElasticTabstops::ChangedAll() noexcept {
+	changedAll = true;
+}
+
+// Changed lines have the same number of cells as before and no cell was or becomes the
+// widest in its column block so no block changes width. Lines must not have been added or removed.
+bool ElasticTabstops::SameStops(const LineTabstops &tabstops, const std::vector<std::unique_ptr<CellWidths>> &cellsBefore,
+	int gap) const noexcept {
+	for (size_t i = 0; i < cellsBefore.size(); i++) {
+		const Sci::Line line = changedStart + i;
+		const CellWidths *before = cellsBefore[i].get();
+		const CellWidths *after = cells[line].get();
+		if (!before || !after) {
+			if (before || after) {
+				return false;
+			}
+			continue;
+		}
+		if (before->size() != after->size()) {
+			return false;
+		}
+		int stop = 0;
+		for (size_t column = 0; column < after->size(); column++) {
+			const int stopNext = tabstops.GetNextTabstop(line, stop);
+			const int widest = stopNext - stop - gap;
+			if (((*after)[column] > widest) || (((*before)[column] == widest) && ((*after)[column] != widest))) {
+				return false;
+			}
+			stop = stopNext;
+		}
+	}
+	return true;
+}
+
+bool ElasticTabstops::NeedsUpdate() const noexcept {
+	return changedAll || (changedStart < changedEnd);
+}
+
+Range ElasticTabstops::Update(Surface *surface, const EditModel &model, const ViewStyle &vstyle, IPositionCache *pCache,
+	LineTabstops &tabstops, int tabWidthMinimum, unsigned int maxThreads) {
+	const Sci::Line lines = model.pdoc->LinesTotal();
+	if (changedAll || (cells.Length() != lines)) {
+		cells.DeleteAll();
+		cells.InsertEmpty(0, lines);
+		changedStart = 0;
+		changedEnd = lines;
+		changedAll = false;
+		linesAddedOrRemoved = true;
+	}
+	changedEnd = std::min(changedEnd, lines);
+	changedStart = std::min(changedStart, changedEnd);
+	if (changedStart >= changedEnd) {
+		return Range(0);
+	}
+
+	// Text after a stop must be further than the minimum tab width from the next stop
+	const int gap = std::max(padding, tabWidthMinimum + 1);
+
+	std::vector<std::unique_ptr<CellWidths>> cellsBefore;
+	if (!linesAddedOrRemoved) {
+		for (Sci::Line line = changedStart; line < changedEnd; line++) {
+			cellsBefore.push_back(std::move(cells[line]));
+		}
+	}
+	Measure(surface, model, vstyle, pCache, changedStart, changedEnd, maxThreads);
+	if (!linesAddedOrRemoved && SameStops(tabstops, cellsBefore, gap)) {
+		changedStart = 0;
+		changedEnd = 0;
+		return Range(0);
+	}
+	linesAddedOrRemoved = false;
+
+	// Widen to whole column 0 blocks, including any block just before or after the
+	// changed lines as a line that lost or gained its tabs may have split or joined them.
+	Sci::Line blockStart = std::max<Sci::Line>(changedStart - 1, 0);
+	while ((blockStart > 0) && HasCells(blockStart - 1)) {
+		blockStart--;
+	}
+	Sci::Line blockEnd = std::min(changedEnd + 1, lines);
+	while ((blockEnd < lines) && HasCells(blockEnd)) {
+		blockEnd++;
+	}
+	changedStart = 0;
+	changedEnd = 0;
+
+	// Find the blocks of each column in one pass over the lines. The blocks of a column
+	// are nested inside blocks of the previous column.
+	std::vector<std::vector<ColumnBlock>> columnBlocks;
+	for (Sci::Line line = blockStart; line < blockEnd; line++) {
+		if (!HasCells(line)) {
+			continue;
+		}
+		const CellWidths &widths = *cells[line];
+		if (columnBlocks.size() < widths.size()) {
+			columnBlocks.resize(widths.size());
+		}
+		for (size_t column = 0; column < widths.size(); column++) {
+			std::vector<ColumnBlock> &blocks = columnBlocks[column];
+			if (blocks.empty() || (blocks.back().end != line)) {
+				blocks.push_back({ line + 1, widths[column] });
+			} else {
+				blocks.back().end = line + 1;
+				blocks.back().widest = std::max(blocks.back().widest, widths[column]);
+			}
+		}
+	}
+
+	Sci::Line lineFirstMoved = -1;
+	Sci::Line lineLastMoved = -1;
+	std::vector<size_t> blockCurrent(columnBlocks.size());
+	TabstopList stops;
+	for (Sci::Line line = blockStart; line < blockEnd; line++) {
+		stops.clear();
+		const size_t columns = HasCells(line) ? cells[line]->size() : 0;
+		for (size_t column = 0; column < columns; column++) {
+			while (columnBlocks[column][blockCurrent[column]].end <= line) {
+				blockCurrent[column]++;
+			}
+			const int stopPrevious = (column > 0) ? stops.back() : 0;
+			stops.push_back(stopPrevious + columnBlocks[column][blockCurrent[column]].widest + gap);
+		}
+		if (tabstops.SetTabstops(line, stops)) {
+			if (lineFirstMoved < 0) {
+				lineFirstMoved = line;
+			}
+			lineLastMoved = line;
+		}
+	}
+	if (lineFirstMoved < 0) {
+		return Range(0);
+	}
+	return Range(lineFirstMoved, lineLastMoved + 1);
+}
+
+}
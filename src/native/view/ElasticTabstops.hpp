@@ -0,0 +1,51 @@
+// Hyperion source code edit control
+/** @file ElasticTabstops.hpp
+ ** Place tab stops so that the cells of a column line up over consecutive lines.
+ **/
+// Copyright 2026 by Ariz Kamizuki <ariz@mikofure.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#pragma once
+namespace Hyperion::Internal {
+
+/**
+ * Keeps the measured width of each tab terminated cell of each line and turns them into
+ * tab stops. Consecutive lines that have a cell in a column form a block for that column
+ * and the column is as wide as the widest cell of the block plus padding.
+ * Edits mark lines as changed and only the column 0 blocks around changed lines are
+ * measured and recomputed on the next update. When no changed cell was or becomes the
+ * widest of its column block, the stops can not move and the blocks are not examined.
+ */
+class ElasticTabstops {
+	typedef std::vector<int> CellWidths;
+	/// Widths of the cells ending with a tab on each line, null for lines without tabs
+	SplitVector<std::unique_ptr<CellWidths>> cells;
+	Sci::Line changedStart;
+	Sci::Line changedEnd;
+	bool changedAll;
+	bool linesAddedOrRemoved;
+
+	bool HasCells(Sci::Line line) const noexcept;
+	bool SameStops(const LineTabstops &tabstops, const std::vector<std::unique_ptr<CellWidths>> &cellsBefore,
+		int gap) const noexcept;
+	void Measure(Surface *surface, const EditModel &model, const ViewStyle &vstyle, IPositionCache *pCache,
+		Sci::Line lineStart, Sci::Line lineEnd, unsigned int maxThreads);
+
+public:
+	int padding;
+
+	explicit ElasticTabstops(int padding_);
+
+	void InsertLines(Sci::Line line, Sci::Line lines);
+	void RemoveLines(Sci::Line line, Sci::Line lines);
+	void Changed(Sci::Line lineStart, Sci::Line lineEnd) noexcept;
+	void ChangedAll() noexcept;
+	bool NeedsUpdate() const noexcept;
+
+	/// Measure changed lines and write the stops of the blocks around them into tabstops.
+	/// Returns the range of lines whose stops moved, empty when none did.
+	Range Update(Surface *surface, const EditModel &model, const ViewStyle &vstyle, IPositionCache *pCache,
+		LineTabstops &tabstops, int tabWidthMinimum, unsigned int maxThreads);
+};
+
+}
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstdint>
+#include <cassert>
 #include <cstring>
 #include <cmath>
 
@@ -320,22 +321,38 @@ int LineLayout::EndLineStyle() const noexcept {
 	return styles[numCharsBeforeEOL > 0 ? numCharsBeforeEOL-1 : 0];
 }
 
-void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap wrapState, XYPOSITION wrapWidth) {
+namespace {
+
+// Find wrap points with character stepping specialized for the family of encodings.
+// Moving back over a single byte character is resolved from the layout's copy of the text
+// and only multi-byte characters need the document.
+template <EncodingFamily family>
+void WrapLayout(LineLayout &ll, const Document *pdoc, Sci::Position posLineStart, Wrap wrapState, XYPOSITION wrapWidth) {
 	// Document wants document positions but simpler to work in line positions
 	// so take care of adding and subtracting line start in a lambda.
-	auto CharacterBoundary = [=](Sci::Position i, int moveDir) noexcept -> Sci::Position {
-		return pdoc->NextPosition(i + posLineStart, moveDir) - posLineStart;
+	auto CharacterBoundary = [&](Sci::Position i, int moveDir) noexcept -> Sci::Position {
+		if constexpr (family == EncodingFamily::eightBit) {
+			return i + moveDir;
+		} else {
+			if constexpr (family == EncodingFamily::unicode) {
+				// Case forcing only changes ASCII so trail bytes in the layout match the document
+				if (moveDir < 0 && !UTF8IsTrailByte(ll.chars[i - 1])) {
+					return i - 1;
+				}
+			}
+			return pdoc->NextPosition(i + posLineStart, moveDir) - posLineStart;
+		}
 	};
-	lines = 0;
+	ll.lines = 0;
 	// Calculate line start positions based upon width.
 	Sci::Position lastLineStart = 0;
 	XYPOSITION startOffset = wrapWidth;
 	Sci::Position p = 0;
-	while (p < numCharsInLine) {
-		while (p < numCharsInLine && positions[p + 1] < startOffset) {
+	while (p < ll.numCharsInLine) {
+		while (p < ll.numCharsInLine && ll.positions[p + 1] < startOffset) {
 			p++;
 		}
-		if (p < numCharsInLine) {
+		if (p < ll.numCharsInLine) {
 			// backtrack to find lastGoodBreak
 			Sci::Position lastGoodBreak = p;
 			// Try moving to start of last character
@@ -347,10 +364,10 @@ void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap
 				Sci::Position pos = lastGoodBreak;
 				while (pos > lastLineStart) {
 					// style boundary and space
-					if (wrapState != Wrap::WhiteSpace && (styles[pos - 1] != styles[pos])) {
+					if (wrapState != Wrap::WhiteSpace && (ll.styles[pos - 1] != ll.styles[pos])) {
 						break;
 					}
-					if (IsBreakSpace(chars[pos - 1]) && !IsBreakSpace(chars[pos])) {
+					if (IsBreakSpace(ll.chars[pos - 1]) && !IsBreakSpace(ll.chars[pos])) {
 						break;
 					}
 					pos = CharacterBoundary(pos, -1);
@@ -361,10 +378,10 @@ void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap
 				}
 			}
 			if (!foundBreak) {
-				if (CpUtf8 == pdoc->dbcsCodePage) {
+				if constexpr (family == EncodingFamily::unicode) {
 					// Go back before a base character, commonly a letter as modifiers are after the letter they modify
 					const Sci::Position afterWrap = CharacterBoundary(lastGoodBreak, 1);
-					std::string_view svWithoutLast(&chars[lastLineStart], afterWrap - lastLineStart);
+					std::string_view svWithoutLast(&ll.chars[lastLineStart], afterWrap - lastLineStart);
 					if (DiscardLastCombinedCharacter(svWithoutLast) && !svWithoutLast.empty()) {
 						lastGoodBreak = lastLineStart + static_cast<Sci::Position>(svWithoutLast.length());
 					}
@@ -374,15 +391,31 @@ void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap
 					lastGoodBreak = CharacterBoundary(lastGoodBreak, 1);
 				}
 			}
-			AddLineStart(lastGoodBreak);
+			ll.AddLineStart(lastGoodBreak);
 			lastLineStart = lastGoodBreak;
-			startOffset = positions[lastLineStart];
+			startOffset = ll.positions[lastLineStart];
 			// take into account the space for start wrap mark and indent
-			startOffset += wrapWidth - wrapIndent;
+			startOffset += wrapWidth - ll.wrapIndent;
 			p = lastLineStart + 1;
 		}
 	}
-	lines++;
+	ll.lines++;
+}
+
+}
+
+void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap wrapState, XYPOSITION wrapWidth) {
+	switch (pdoc->CodePageFamily()) {
+	case EncodingFamily::unicode:
+		WrapLayout<EncodingFamily::unicode>(*this, pdoc, posLineStart, wrapState, wrapWidth);
+		break;
+	case EncodingFamily::dbcs:
+		WrapLayout<EncodingFamily::dbcs>(*this, pdoc, posLineStart, wrapState, wrapWidth);
+		break;
+	default:
+		WrapLayout<EncodingFamily::eightBit>(*this, pdoc, posLineStart, wrapState, wrapWidth);
+		break;
+	}
 }
 
 ScreenLine::ScreenLine(